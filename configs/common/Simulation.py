@@ -87,8 +87,13 @@ def setCPUClass(options):
         )
         test_mem_mode = "atomic"
 
-    # Ruby only supports atomic accesses in noncaching mode
-    if test_mem_mode == "atomic" and options.ruby:
+    # Ruby only supports atomic accesses in noncaching mode, unless its
+    # caches are functionally warmed
+    if (
+        test_mem_mode == "atomic"
+        and options.ruby
+        and not getattr(options, "ruby_functional_warming", False)
+    ):
         warn("Memory mode will be changed to atomic_noncaching")
         test_mem_mode = "atomic_noncaching"
 
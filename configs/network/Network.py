@@ -116,6 +116,14 @@ def define_options(parser):
         default=50000,
         help="network-level deadlock threshold.",
     )
+    parser.add_argument(
+        "--garnet-router-threads",
+        action="store",
+        type=int,
+        default=0,
+        help="""number of host threads evaluating the garnet routers
+            of a cycle; 0 wakes up each router as a separate event.""",
+    )
     parser.add_argument(
         "--simple-physical-channels",
         action="store_true",
@@ -172,6 +180,7 @@ def init_network(options, network, InterfaceClass):
         network.ni_flit_size = options.link_width_bits / 8
         network.routing_algorithm = options.routing_algorithm
         network.garnet_deadlock_threshold = options.garnet_deadlock_threshold
+        network.router_threads = options.garnet_router_threads
 
         # Create Bridges and connect them to the corresponding links
         for intLink in network.int_links:
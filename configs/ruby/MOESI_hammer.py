@@ -126,6 +126,7 @@ def create_system(
             L2cache=l2_cache,
             no_mig_atomic=not options.allow_atomic_migration,
             send_evictions=send_evicts(options),
+            install_trace_blocks=not (options.pf_on or options.dir_on),
             transitions_per_cycle=options.ports,
             clk_domain=clk_domain,
             ruby_system=ruby_system,
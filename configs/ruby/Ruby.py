@@ -79,6 +79,13 @@ def define_options(parser):
         default=False,
         help="Should ruby maintain a second copy of memory",
     )
+    parser.add_argument(
+        "--ruby-functional-warming",
+        action="store_true",
+        default=False,
+        help="Warm the ruby caches with the accesses of atomic CPUs "
+        "(implies --access-backing-store)",
+    )
 
     # Options related to cache structure
     parser.add_argument(
@@ -230,6 +237,12 @@ def create_system(
     system.ruby = RubySystem()
     ruby = system.ruby
 
+    # While the caches are functionally warmed, the data lives in the
+    # backing copy of memory.
+    if getattr(options, "ruby_functional_warming", False):
+        ruby.functional_warming = True
+        options.access_backing_store = True
+
     # Generate pseudo filesystem
     FileSystemConfig.config_filesystem(system, options)
 
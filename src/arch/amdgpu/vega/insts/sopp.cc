@@ -699,10 +699,10 @@ namespace VegaISA
 
         gpuDynInst->resetEntireStatusVector();
         gpuDynInst->setStatusVector(0, 1);
-        RequestPtr req = std::make_shared<Request>(0, 0, 0,
-                                   gpuDynInst->computeUnit()->
-                                   requestorId(), 0,
-                                   gpuDynInst->wfDynId);
+        RequestPtr req = Request::create(0, 0, 0,
+                                         gpuDynInst->computeUnit()->
+                                         requestorId(), 0,
+                                         gpuDynInst->wfDynId);
         gpuDynInst->setRequestFlags(req);
         gpuDynInst->computeUnit()->scalarMemoryPipe.
             injectScalarMemFence(gpuDynInst, false, req);
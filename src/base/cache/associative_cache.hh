@@ -198,7 +198,8 @@ class AssociativeCache : public Named
     {
         auto tag = getTag(addr);
 
-        auto candidates = indexingPolicy->getPossibleEntries(addr);
+        const ReplacementCandidates candidates =
+            indexingPolicy->getCandidates(addr);
 
         for (auto candidate : candidates) {
             Entry *entry = static_cast<Entry*>(candidate);
@@ -218,7 +219,8 @@ class AssociativeCache : public Named
     virtual Entry*
     findVictim(const Addr addr)
     {
-        auto candidates = indexingPolicy->getPossibleEntries(addr);
+        const ReplacementCandidates candidates =
+            indexingPolicy->getCandidates(addr);
 
         auto victim = static_cast<Entry*>(replPolicy->getVictim(candidates));
 
@@ -260,8 +262,8 @@ class AssociativeCache : public Named
     std::vector<Entry *>
     getPossibleEntries(const Addr addr) const
     {
-        std::vector<ReplaceableEntry *> selected_entries =
-            indexingPolicy->getPossibleEntries(addr);
+        const ReplacementCandidates selected_entries =
+            indexingPolicy->getCandidates(addr);
 
         std::vector<Entry *> entries;
 
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/pool_alloc.hh"
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace
+{
+
+#if defined(__SANITIZE_ADDRESS__)
+constexpr bool defaultPooling = false;
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+constexpr bool defaultPooling = false;
+#else
+constexpr bool defaultPooling = true;
+#endif
+#else
+constexpr bool defaultPooling = true;
+#endif
+
+/** Book keeping shared by all pools, only touched on slow paths. */
+struct PoolRegistry
+{
+    std::mutex lock;
+    std::vector<const SlabPool *> pools;
+    std::vector<std::unique_ptr<char[]>> slabs;
+    /**
+     * Batches of free objects (list head and length) spilled by pools,
+     * by object size.
+     */
+    std::map<std::size_t, std::vector<std::pair<void *, std::size_t>>>
+        depots;
+    /** Counts of pools that belonged to threads which have exited. */
+    SlabPool::Counts retired;
+    bool used = false;
+};
+
+PoolRegistry &
+registry()
+{
+    // Never destroyed, since thread local pools may outlive it.
+    static PoolRegistry *reg = new PoolRegistry;
+    return *reg;
+}
+
+} // anonymous namespace
+
+bool SlabPool::_enabled = defaultPooling;
+
+SlabPool::SlabPool(std::size_t obj_size, std::size_t objs_per_slab)
+    : objSize(std::max(obj_size, sizeof(FreeObject))),
+      objsPerSlab(objs_per_slab)
+{
+    fatal_if(objs_per_slab == 0, "Slab pools need at least one object "
+             "per slab.");
+
+    PoolRegistry &reg = registry();
+    std::lock_guard<std::mutex> guard(reg.lock);
+    reg.pools.push_back(this);
+}
+
+SlabPool::~SlabPool()
+{
+    // Objects still on the free list or handed out to other threads
+    // live in slabs owned by the registry, so they stay valid.
+    flush();
+
+    PoolRegistry &reg = registry();
+    std::lock_guard<std::mutex> guard(reg.lock);
+    Counts c = counts();
+    reg.retired.hits += c.hits;
+    reg.retired.misses += c.misses;
+    reg.pools.erase(std::find(reg.pools.begin(), reg.pools.end(), this));
+}
+
+void
+SlabPool::refill()
+{
+    PoolRegistry &reg = registry();
+    std::lock_guard<std::mutex> guard(reg.lock);
+    reg.used = true;
+
+    auto &depot = reg.depots[objSize];
+    if (!depot.empty()) {
+        freeList = static_cast<FreeObject *>(depot.back().first);
+        numFree = depot.back().second;
+        depot.pop_back();
+        return;
+    }
+
+    const std::size_t bytes = objSize * objsPerSlab;
+    reg.slabs.emplace_back(new char[bytes]);
+    slabCur = reg.slabs.back().get();
+    slabEnd = slabCur + bytes;
+}
+
+void
+SlabPool::spill()
+{
+    // Keep the most recently freed objects, which are likely still in
+    // the host caches, and hand the tail of the list to the depot.
+    const std::size_t keep = numFree - objsPerSlab;
+    FreeObject *last_kept = freeList;
+    for (std::size_t i = 1; i < keep; i++)
+        last_kept = last_kept->next;
+
+    FreeObject *batch = last_kept->next;
+    last_kept->next = nullptr;
+    numFree = keep;
+
+    PoolRegistry &reg = registry();
+    std::lock_guard<std::mutex> guard(reg.lock);
+    reg.depots[objSize].emplace_back(batch, objsPerSlab);
+}
+
+void
+SlabPool::flush()
+{
+    if (!freeList)
+        return;
+
+    PoolRegistry &reg = registry();
+    std::lock_guard<std::mutex> guard(reg.lock);
+    reg.depots[objSize].emplace_back(freeList, numFree);
+    freeList = nullptr;
+    numFree = 0;
+}
+
+void
+SlabPool::setEnabled(bool enable)
+{
+    PoolRegistry &reg = registry();
+    std::lock_guard<std::mutex> guard(reg.lock);
+    fatal_if(reg.used && enable != _enabled,
+             "Pooled allocation can't be toggled after objects have been "
+             "allocated from a pool.");
+    _enabled = enable;
+}
+
+SlabPool::Counts
+SlabPool::totals()
+{
+    PoolRegistry &reg = registry();
+    std::lock_guard<std::mutex> guard(reg.lock);
+    Counts total = reg.retired;
+    for (const SlabPool *pool : reg.pools) {
+        Counts c = pool->counts();
+        total.hits += c.hits;
+        total.misses += c.misses;
+    }
+    return total;
+}
+
+} // namespace gem5
@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_POOL_ALLOC_HH__
+#define __BASE_POOL_ALLOC_HH__
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+
+namespace gem5
+{
+
+/**
+ * Fixed-size object allocator. Objects are carved out of large slabs
+ * and, once freed, recycled through an intrusive free list, so that
+ * the steady state of an allocate/free heavy workload (such as packets
+ * flowing through the memory system) never reaches the global heap.
+ *
+ * A pool is not thread safe; use threadSlabPool() to get the pool of
+ * the calling thread. An object may be freed by a different thread
+ * than the one that allocated it, in which case it migrates to the
+ * free list of the freeing thread. Free lists are capped: once a pool
+ * holds more than two slabs worth of free objects, a slab's worth is
+ * moved to a depot shared by all pools of the same object size, which
+ * pools draw from before carving a new slab. Objects that are produced
+ * on one thread and consumed on another therefore flow back to the
+ * producer instead of growing the memory footprint without bound.
+ * Slabs are never returned to the system; they are kept on a global
+ * list so that they remain reachable for leak checkers.
+ *
+ * Pooling can be globally disabled (and is disabled by default in
+ * Address Sanitizer builds), in which case all users fall back to the
+ * global heap so that individual allocations can be tracked.
+ */
+class SlabPool
+{
+  public:
+    /** Allocation counts, summed over all pools. */
+    struct Counts
+    {
+        /** Allocations served from a recycled object. */
+        uint64_t hits = 0;
+        /** Allocations that needed fresh slab memory. */
+        uint64_t misses = 0;
+    };
+
+    /**
+     * @param obj_size Size of each object in bytes.
+     * @param objs_per_slab Number of objects to carve out of each slab.
+     */
+    SlabPool(std::size_t obj_size, std::size_t objs_per_slab=256);
+    ~SlabPool();
+
+    SlabPool(const SlabPool &) = delete;
+    SlabPool &operator=(const SlabPool &) = delete;
+
+    void *
+    allocate()
+    {
+        if (!freeList && slabCur == slabEnd)
+            refill();
+
+        if (freeList) {
+            bump(_hits);
+            FreeObject *obj = freeList;
+            freeList = obj->next;
+            --numFree;
+            return obj;
+        }
+
+        bump(_misses);
+        void *obj = slabCur;
+        slabCur += objSize;
+        return obj;
+    }
+
+    void
+    deallocate(void *p)
+    {
+        auto *obj = static_cast<FreeObject *>(p);
+        obj->next = freeList;
+        freeList = obj;
+        if (++numFree > 2 * objsPerSlab)
+            spill();
+    }
+
+    /**
+     * Hand all free objects to the depot, e.g., because the thread
+     * owning the pool is about to exit.
+     */
+    void flush();
+
+    std::size_t objectSize() const { return objSize; }
+
+    Counts
+    counts() const
+    {
+        return { _hits.load(std::memory_order_relaxed),
+                 _misses.load(std::memory_order_relaxed) };
+    }
+
+    /** Whether pooled allocation is enabled. */
+    static bool enabled() { return _enabled; }
+
+    /**
+     * Enable or disable pooled allocation. This has to be decided
+     * before the first pooled allocation takes place, since objects
+     * must be freed to the allocator they came from.
+     */
+    static void setEnabled(bool enable);
+
+    /** Counts summed over all live and retired pools. */
+    static Counts totals();
+
+  private:
+    struct FreeObject
+    {
+        FreeObject *next;
+    };
+
+    /**
+     * Increment a counter that is only ever written by the owning
+     * thread, but which may be read by others when stats are dumped.
+     */
+    static void
+    bump(std::atomic<uint64_t> &c)
+    {
+        c.store(c.load(std::memory_order_relaxed) + 1,
+                std::memory_order_relaxed);
+    }
+
+    /**
+     * Take a batch of free objects from the depot, or carve a new slab
+     * if there is none.
+     */
+    void refill();
+
+    /** Move the coldest slab's worth of free objects to the depot. */
+    void spill();
+
+    const std::size_t objSize;
+    const std::size_t objsPerSlab;
+
+    FreeObject *freeList = nullptr;
+    std::size_t numFree = 0;
+    char *slabCur = nullptr;
+    char *slabEnd = nullptr;
+
+    std::atomic<uint64_t> _hits{0};
+    std::atomic<uint64_t> _misses{0};
+
+    static bool _enabled;
+};
+
+/**
+ * Get the calling thread's pool for objects of the given size. Sizes
+ * are rounded up so that every object is suitably aligned for any
+ * fundamental type.
+ */
+template <std::size_t Size>
+SlabPool &
+threadSlabPool()
+{
+    constexpr std::size_t align = alignof(std::max_align_t);
+    constexpr std::size_t size = (Size + align - 1) / align * align;
+
+    // The pool is deliberately never destroyed, since pooled objects may
+    // still be freed during static destruction. Its free objects are
+    // handed to the depot when the thread exits though, so that threads
+    // which come and go don't strand them.
+    struct Holder
+    {
+        SlabPool *pool = new SlabPool(size);
+        ~Holder() { pool->flush(); }
+    };
+    thread_local Holder holder;
+    return *holder.pool;
+}
+
+/**
+ * Standard allocator backed by the thread's slab pools. This is mainly
+ * intended for std::allocate_shared, which allocates the object and
+ * its control block in one piece of a size only known inside the
+ * standard library. Array allocations, over-aligned types and
+ * allocations made while pooling is disabled go to the global heap.
+ */
+template <typename T>
+class PoolAllocator
+{
+  public:
+    typedef T value_type;
+
+    PoolAllocator() = default;
+    template <typename U>
+    PoolAllocator(const PoolAllocator<U> &) {}
+
+    T *
+    allocate(std::size_t n)
+    {
+        if (pooled(n))
+            return static_cast<T *>(threadSlabPool<sizeof(T)>().allocate());
+        return std::allocator<T>().allocate(n);
+    }
+
+    void
+    deallocate(T *p, std::size_t n)
+    {
+        if (pooled(n))
+            threadSlabPool<sizeof(T)>().deallocate(p);
+        else
+            std::allocator<T>().deallocate(p, n);
+    }
+
+    template <typename U>
+    bool operator==(const PoolAllocator<U> &) const { return true; }
+    template <typename U>
+    bool operator!=(const PoolAllocator<U> &) const { return false; }
+
+  private:
+    static bool
+    pooled(std::size_t n)
+    {
+        return n == 1 && alignof(T) <= alignof(std::max_align_t) &&
+            SlabPool::enabled();
+    }
+};
+
+} // namespace gem5
+
+#endif // __BASE_POOL_ALLOC_HH__
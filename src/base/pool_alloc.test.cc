@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "base/pool_alloc.hh"
+
+using namespace gem5;
+
+/** Freed objects are handed out again before any fresh memory. */
+TEST(SlabPoolTest, RecyclesObjects)
+{
+    SlabPool pool(48, 4);
+
+    void *a = pool.allocate();
+    void *b = pool.allocate();
+    EXPECT_NE(a, b);
+    EXPECT_EQ(pool.counts().misses, 2U);
+    EXPECT_EQ(pool.counts().hits, 0U);
+
+    pool.deallocate(a);
+    EXPECT_EQ(pool.allocate(), a);
+    EXPECT_EQ(pool.counts().hits, 1U);
+}
+
+/** Objects never overlap, also across slab boundaries. */
+TEST(SlabPoolTest, DistinctObjects)
+{
+    SlabPool pool(24, 3);
+    std::set<char *> seen;
+    for (int i = 0; i < 100; i++) {
+        auto *p = static_cast<char *>(pool.allocate());
+        for (char *q : seen)
+            EXPECT_TRUE(p + 24 <= q || q + 24 <= p);
+        seen.insert(p);
+    }
+    EXPECT_EQ(pool.counts().misses, 100U);
+}
+
+/** Objects smaller than a pointer still fit the free list link. */
+TEST(SlabPoolTest, TinyObjects)
+{
+    SlabPool pool(1, 8);
+    EXPECT_EQ(pool.objectSize(), sizeof(void *));
+}
+
+/** Counts of pools that have been destroyed are kept in the totals. */
+TEST(SlabPoolTest, Totals)
+{
+    SlabPool::Counts before = SlabPool::totals();
+    {
+        SlabPool pool(32);
+        pool.deallocate(pool.allocate());
+        pool.allocate();
+    }
+    SlabPool::Counts after = SlabPool::totals();
+    EXPECT_EQ(after.hits - before.hits, 1U);
+    EXPECT_EQ(after.misses - before.misses, 1U);
+}
+
+/**
+ * Objects allocated by one pool and freed to another flow back through
+ * the depot instead of making the allocating pool carve new slabs.
+ */
+TEST(SlabPoolTest, ProducerConsumer)
+{
+    SlabPool producer(40, 4);
+    SlabPool consumer(40, 4);
+
+    std::vector<void *> objs;
+    for (int round = 0; round < 100; round++) {
+        for (int i = 0; i < 16; i++)
+            objs.push_back(producer.allocate());
+        for (void *obj : objs)
+            consumer.deallocate(obj);
+        objs.clear();
+    }
+
+    // The consumer keeps at most two slabs worth of free objects, the
+    // rest comes back to the producer.
+    EXPECT_LE(producer.counts().misses, 16U + 2 * 4U);
+    EXPECT_EQ(consumer.counts().misses, 0U);
+}
+
+/** Free objects of a destroyed pool are reused by other pools. */
+TEST(SlabPoolTest, Flush)
+{
+    void *obj;
+    {
+        SlabPool pool(56, 2);
+        obj = pool.allocate();
+        pool.deallocate(obj);
+    }
+
+    SlabPool pool(56, 2);
+    EXPECT_EQ(pool.allocate(), obj);
+    EXPECT_EQ(pool.counts().hits, 1U);
+}
+
+/** Shared pointers allocated through the pool allocator are recycled. */
+TEST(PoolAllocatorTest, AllocateShared)
+{
+    struct Obj
+    {
+        int a, b;
+    };
+
+    if (!SlabPool::enabled())
+        GTEST_SKIP() << "Pooled allocation is disabled in this build.";
+
+    auto first = std::allocate_shared<Obj>(PoolAllocator<Obj>(), Obj{1, 2});
+    const void *addr = first.get();
+    first.reset();
+
+    auto second = std::allocate_shared<Obj>(PoolAllocator<Obj>(), Obj{3, 4});
+    EXPECT_EQ(second.get(), addr);
+    EXPECT_EQ(second->a, 3);
+}
+
+/** Objects may be freed by a different thread than their allocator. */
+TEST(PoolAllocatorTest, CrossThreadFree)
+{
+    PoolAllocator<uint64_t> alloc;
+    std::vector<uint64_t *> objs;
+    for (uint64_t i = 0; i < 1000; i++) {
+        objs.push_back(alloc.allocate(1));
+        *objs.back() = i;
+    }
+
+    std::thread t([&]() {
+        for (uint64_t i = 0; i < 1000; i++) {
+            EXPECT_EQ(*objs[i], i);
+            alloc.deallocate(objs[i], 1);
+        }
+        // The freeing thread reuses what it was given.
+        if (SlabPool::enabled())
+            EXPECT_EQ(alloc.allocate(1), objs.back());
+    });
+    t.join();
+}
@@ -71,6 +71,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <type_traits>
 #include <vector>
 
 #include "base/cast.hh"
@@ -112,6 +113,8 @@ class InfoProxy : public Base
         visitor.visit(*static_cast<Base *>(this));
     }
     bool zero() const { return s.zero(); }
+    size_type flatSize() const { return s.flatSize(); }
+    void flatten(StatStor *dst) { s.flatten(dst); }
 };
 
 template <class Stat>
@@ -294,6 +297,10 @@ class DataWrap : public InfoAccess
     }
     const std::string &name() const { return this->info()->name; }
 
+    /** Stats keep their storage to themselves unless they hide these. */
+    size_type flatSize() const { return 0; }
+    void flatten(StatStor *dst) {}
+
     /**
      * Set the character(s) used between the name and vector number
      * on vectors, dist, etc.
@@ -525,6 +532,8 @@ class ScalarBase : public DataWrap<Derived, ScalarInfoProxy>
   protected:
     /** The storage of this stat. */
     GEM5_ALIGNED(8) char storage[sizeof(Storage)];
+    /** The storage in use, which flatten() moves out of this stat. */
+    Storage *stor;
 
   protected:
     /**
@@ -535,7 +544,7 @@ class ScalarBase : public DataWrap<Derived, ScalarInfoProxy>
     Storage *
     data()
     {
-        return reinterpret_cast<Storage *>(storage);
+        return stor;
     }
 
     /**
@@ -547,13 +556,13 @@ class ScalarBase : public DataWrap<Derived, ScalarInfoProxy>
     const Storage *
     data() const
     {
-        return reinterpret_cast<const Storage *>(storage);
+        return stor;
     }
 
     void
     doInit()
     {
-        new (storage) Storage(this->info()->getStorageParams());
+        stor = new (storage) Storage(this->info()->getStorageParams());
         this->setInit();
     }
 
@@ -628,6 +637,17 @@ class ScalarBase : public DataWrap<Derived, ScalarInfoProxy>
 
     void reset() { data()->reset(this->info()->getStorageParams()); }
     void prepare() { data()->prepare(this->info()->getStorageParams()); }
+
+    size_type flatSize() const { return std::is_same_v<Stor, StatStor>; }
+
+    void
+    flatten(StatStor *dst)
+    {
+        if constexpr (std::is_same_v<Stor, StatStor>) {
+            *dst = *stor;
+            stor = dst;
+        }
+    }
 };
 
 class ProxyInfo : public ScalarInfo
@@ -932,6 +952,8 @@ class VectorBase : public DataWrapVec<Derived, VectorInfoProxy>
   protected:
     /** The storage of this stat. */
     std::vector<Storage*> storage;
+    /** False once flatten() has moved the storage out of this stat. */
+    bool ownsStorage = true;
 
   protected:
     /**
@@ -1025,11 +1047,32 @@ class VectorBase : public DataWrapVec<Derived, VectorInfoProxy>
 
     ~VectorBase()
     {
+        if (!ownsStorage)
+            return;
         for (auto& stor : storage) {
             delete stor;
         }
     }
 
+    size_type
+    flatSize() const
+    {
+        return std::is_same_v<Stor, StatStor> ? size() : 0;
+    }
+
+    void
+    flatten(StatStor *dst)
+    {
+        if constexpr (std::is_same_v<Stor, StatStor>) {
+            for (auto &stor : storage) {
+                *dst = *stor;
+                delete stor;
+                stor = dst++;
+            }
+            ownsStorage = false;
+        }
+    }
+
     /**
      * Set this vector to have the given size.
      * @param size The new size.
@@ -1149,6 +1192,8 @@ class Vector2dBase : public DataWrapVec2d<Derived, Vector2dInfoProxy>
     size_type x;
     size_type y;
     std::vector<Storage*> storage;
+    /** False once flatten() has moved the storage out of this stat. */
+    bool ownsStorage = true;
 
   protected:
     Storage *data(off_type index) { return storage[index]; }
@@ -1164,11 +1209,32 @@ class Vector2dBase : public DataWrapVec2d<Derived, Vector2dInfoProxy>
 
     ~Vector2dBase()
     {
+        if (!ownsStorage)
+            return;
         for (auto& stor : storage) {
             delete stor;
         }
     }
 
+    size_type
+    flatSize() const
+    {
+        return std::is_same_v<Stor, StatStor> ? size() : 0;
+    }
+
+    void
+    flatten(StatStor *dst)
+    {
+        if constexpr (std::is_same_v<Stor, StatStor>) {
+            for (auto &stor : storage) {
+                *dst = *stor;
+                delete stor;
+                stor = dst++;
+            }
+            ownsStorage = false;
+        }
+    }
+
     Derived &
     init(size_type _x, size_type _y)
     {
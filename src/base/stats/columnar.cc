@@ -0,0 +1,357 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/stats/columnar.hh"
+
+#include <cassert>
+#include <cstring>
+#include <ostream>
+
+#include "base/logging.hh"
+#include "base/output.hh"
+#include "base/stats/info.hh"
+#include "base/stats/units.hh"
+#include "sim/cur_tick.hh"
+
+namespace gem5
+{
+
+namespace statistics
+{
+
+namespace
+{
+
+/** Values written for every distribution before its buckets. */
+const char *const distFields[] = {
+    "bucket_size", "min_bucket", "max_bucket", "samples", "sum",
+    "squares", "min_value", "max_value", "underflows", "overflows",
+};
+constexpr size_type numDistFields = std::size(distFields);
+
+void
+appendLE(std::string &out, uint64_t value, int bytes)
+{
+    for (int i = 0; i < bytes; i++)
+        out.push_back(char(value >> (8 * i)));
+}
+
+void
+appendString(std::string &out, const std::string &str)
+{
+    appendLE(out, str.size(), 4);
+    out += str;
+}
+
+std::string
+elementLabel(const std::vector<std::string> &names, size_type i)
+{
+    return i < names.size() && !names[i].empty() ?
+        names[i] : std::to_string(i);
+}
+
+} // anonymous namespace
+
+Columnar::Columnar(OutputStream *_file, bool desc)
+    : file(_file), userStream(nullptr), enableDescriptions(desc)
+{
+}
+
+Columnar::Columnar(std::ostream &stream, bool desc)
+    : file(nullptr), userStream(&stream), enableDescriptions(desc)
+{
+}
+
+std::ostream &
+Columnar::stream() const
+{
+    return file ? *file->stream() : *userStream;
+}
+
+bool
+Columnar::valid() const
+{
+    return stream().good();
+}
+
+void
+Columnar::begin()
+{
+    std::ostream &os = stream();
+
+    // The file starts out empty, and is recreated empty when the output
+    // directory changes after a fork. Either way the new file needs its
+    // own header and column definitions.
+    if (os.tellp() == 0) {
+        columns.clear();
+        numColumns = 0;
+        layouts.clear();
+
+        std::string header(Magic, sizeof(Magic) - 1);
+        appendLE(header, Version, 4);
+        appendLE(header, 0, 4);
+        os.write(header.data(), header.size());
+    }
+
+    dumpColumns.clear();
+    dumpValues.clear();
+}
+
+void
+Columnar::end()
+{
+    assert(path.empty());
+
+    uint32_t layout;
+    auto it = layouts.find(dumpColumns);
+    if (it == layouts.end()) {
+        layout = layouts.size();
+        layouts.emplace(dumpColumns, layout);
+
+        std::string payload;
+        appendLE(payload, layout, 4);
+        appendLE(payload, dumpColumns.size(), 4);
+        for (uint32_t id : dumpColumns)
+            appendLE(payload, id, 4);
+        writeRecord(LayoutRecord, payload);
+    } else {
+        layout = it->second;
+    }
+
+    std::string payload;
+    payload.reserve(12 + 8 * dumpValues.size());
+    appendLE(payload, layout, 4);
+    appendLE(payload, curTick(), 8);
+    for (double value : dumpValues) {
+        uint64_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        appendLE(payload, bits, 8);
+    }
+    writeRecord(DumpRecord, payload);
+
+    stream().flush();
+}
+
+void
+Columnar::beginGroup(const char *name)
+{
+    if (path.empty())
+        path.push(name);
+    else
+        path.push(path.top() + "." + name);
+}
+
+void
+Columnar::endGroup()
+{
+    assert(!path.empty());
+    path.pop();
+}
+
+void
+Columnar::writeRecord(RecordType type, const std::string &payload)
+{
+    std::string header;
+    appendLE(header, type, 1);
+    appendLE(header, payload.size(), 8);
+
+    std::ostream &os = stream();
+    os.write(header.data(), header.size());
+    os.write(payload.data(), payload.size());
+}
+
+double *
+Columnar::addColumn(const Info &info, Kind kind, size_type size,
+                    const std::vector<std::string> &labels)
+{
+    auto it = columns.find(&info);
+    if (it == columns.end() || it->second.size != size) {
+        assert(labels.size() == size);
+        const Column column{numColumns++, size};
+        columns[&info] = column;
+
+        std::string payload;
+        appendLE(payload, column.id, 4);
+        appendLE(payload, kind, 1);
+        appendString(payload,
+                     path.empty() ? info.name : path.top() + "." + info.name);
+        appendString(payload, enableDescriptions ? info.desc : "");
+        appendString(payload, info.unit->getUnitString());
+        appendLE(payload, size, 4);
+        for (const auto &label : labels)
+            appendString(payload, label);
+        writeRecord(ColumnRecord, payload);
+
+        it = columns.find(&info);
+    }
+
+    dumpColumns.push_back(it->second.id);
+    dumpValues.resize(dumpValues.size() + size);
+    return dumpValues.data() + dumpValues.size() - size;
+}
+
+void
+Columnar::visit(const ScalarInfo &info)
+{
+    static const std::vector<std::string> labels{""};
+
+    if (!info.flags.isSet(display))
+        return;
+
+    *addColumn(info, ScalarKind, 1, labels) = info.result();
+}
+
+void
+Columnar::visit(const VectorInfo &info)
+{
+    if (!info.flags.isSet(display))
+        return;
+
+    const VResult &vr = info.result();
+    std::vector<std::string> labels;
+    if (columns.count(&info) == 0 || columns[&info].size != vr.size()) {
+        for (size_type i = 0; i < vr.size(); i++)
+            labels.push_back(elementLabel(info.subnames, i));
+    }
+
+    const bool formula = dynamic_cast<const FormulaInfo *>(&info);
+    std::copy(vr.begin(), vr.end(),
+              addColumn(info, formula ? FormulaKind : VectorKind,
+                        vr.size(), labels));
+}
+
+void
+Columnar::visit(const FormulaInfo &info)
+{
+    visit(static_cast<const VectorInfo &>(info));
+}
+
+void
+Columnar::visit(const Vector2dInfo &info)
+{
+    if (!info.flags.isSet(display))
+        return;
+
+    const size_type size = info.x * info.y;
+    assert(info.cvec.size() == size);
+    std::vector<std::string> labels;
+    if (columns.count(&info) == 0 || columns[&info].size != size) {
+        for (size_type i = 0; i < info.x; i++) {
+            for (size_type j = 0; j < info.y; j++) {
+                labels.push_back(elementLabel(info.subnames, i) + "::" +
+                                 elementLabel(info.y_subnames, j));
+            }
+        }
+    }
+
+    std::copy(info.cvec.begin(), info.cvec.end(),
+              addColumn(info, Vector2dKind, size, labels));
+}
+
+void
+Columnar::distLabels(const DistData &data, const std::string &prefix,
+                     std::vector<std::string> &labels) const
+{
+    for (const char *field : distFields)
+        labels.push_back(prefix + field);
+    // The buckets are only numbered, since the range they cover changes
+    // whenever a histogram grows. It follows from the first fields.
+    for (size_type i = 0; i < data.cvec.size(); i++)
+        labels.push_back(prefix + std::to_string(i));
+}
+
+void
+Columnar::appendDist(const DistData &data, double *out) const
+{
+    const Counter fields[] = {
+        data.bucket_size, data.min, data.max, data.samples, data.sum,
+        data.squares, data.min_val, data.max_val, data.underflow,
+        data.overflow,
+    };
+    static_assert(std::size(fields) == numDistFields);
+
+    out = std::copy(std::begin(fields), std::end(fields), out);
+    std::copy(data.cvec.begin(), data.cvec.end(), out);
+}
+
+void
+Columnar::visit(const DistInfo &info)
+{
+    if (!info.flags.isSet(display))
+        return;
+
+    const size_type size = numDistFields + info.data.cvec.size();
+    std::vector<std::string> labels;
+    if (columns.count(&info) == 0 || columns[&info].size != size)
+        distLabels(info.data, "", labels);
+
+    appendDist(info.data, addColumn(info, DistKind, size, labels));
+}
+
+void
+Columnar::visit(const VectorDistInfo &info)
+{
+    if (!info.flags.isSet(display))
+        return;
+
+    size_type size = 0;
+    for (const auto &data : info.data)
+        size += numDistFields + data.cvec.size();
+
+    std::vector<std::string> labels;
+    if (columns.count(&info) == 0 || columns[&info].size != size) {
+        for (size_type i = 0; i < info.data.size(); i++) {
+            distLabels(info.data[i],
+                       elementLabel(info.subnames, i) + "::", labels);
+        }
+    }
+
+    double *out = addColumn(info, VectorDistKind, size, labels);
+    for (const auto &data : info.data) {
+        appendDist(data, out);
+        out += numDistFields + data.cvec.size();
+    }
+}
+
+void
+Columnar::visit(const SparseHistInfo &info)
+{
+    warn_once("Columnar stat files don't support sparse histograms.\n");
+}
+
+std::unique_ptr<Output>
+initColumnar(const std::string &filename, bool desc)
+{
+    OutputStream *file = simout.create(filename, true, true);
+    if (!file->stream()->good())
+        fatal("Unable to open statistics file '%s' for writing\n", filename);
+    return std::make_unique<Columnar>(file, desc);
+}
+
+} // namespace statistics
+} // namespace gem5
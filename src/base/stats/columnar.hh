@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_STATS_COLUMNAR_HH__
+#define __BASE_STATS_COLUMNAR_HH__
+
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <stack>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "base/stats/output.hh"
+#include "base/stats/types.hh"
+
+namespace gem5
+{
+
+class OutputStream;
+
+namespace statistics
+{
+
+class Info;
+
+/**
+ * Binary columnar statistics output.
+ *
+ * The names, descriptions and element labels of the stats are written
+ * the first time they are dumped. Each dump after that only consists of
+ * the current tick followed by the packed values, which makes frequent
+ * (e.g., periodic) dumps cheap both in time and in space. Dumps are
+ * appended as they happen, so a file can be read while the simulation
+ * is still running. util/columnar_stats.py loads a file into arrays.
+ *
+ * All numbers are little-endian. The file starts with the magic string
+ * "gem5stcl", a 32-bit version and 32 reserved bits, followed by
+ * records. Every record has an 8-bit type and a 64-bit payload size.
+ *
+ *   Column: u32 id, u8 kind, then the name, description and unit as
+ *           strings (u32 length and characters), and a u32 number of
+ *           values followed by one label per value.
+ *   Layout: u32 id, u32 number of columns, u32 column ids.
+ *   Dump:   u32 layout id, u64 tick, f64 values of the columns of the
+ *           layout, in order.
+ *
+ * A new layout is only needed when a dump visits a different set of
+ * stats than the dumps before it, e.g., when only a sub-tree is dumped.
+ * Unlike the text output, stats are not dropped because they are zero
+ * or their prerequisite is, so the layout of full dumps never changes.
+ */
+class Columnar : public Output
+{
+  public:
+    static constexpr char Magic[] = "gem5stcl";
+    static constexpr uint32_t Version = 1;
+
+    enum RecordType : uint8_t
+    {
+        ColumnRecord = 1,
+        LayoutRecord = 2,
+        DumpRecord = 3,
+    };
+
+    enum Kind : uint8_t
+    {
+        ScalarKind = 0,
+        VectorKind = 1,
+        Vector2dKind = 2,
+        FormulaKind = 3,
+        DistKind = 4,
+        VectorDistKind = 5,
+    };
+
+    /** Write to a file managed by the simulator output directory. */
+    Columnar(OutputStream *file, bool desc);
+    /** Write to a stream owned by the caller, e.g., for testing. */
+    Columnar(std::ostream &stream, bool desc);
+
+    Columnar() = delete;
+    Columnar(const Columnar &other) = delete;
+
+  public: // Output interface
+    void begin() override;
+    void end() override;
+    bool valid() const override;
+
+    void beginGroup(const char *name) override;
+    void endGroup() override;
+
+    void visit(const ScalarInfo &info) override;
+    void visit(const VectorInfo &info) override;
+    void visit(const DistInfo &info) override;
+    void visit(const VectorDistInfo &info) override;
+    void visit(const Vector2dInfo &info) override;
+    void visit(const FormulaInfo &info) override;
+    void visit(const SparseHistInfo &info) override;
+
+  private:
+    struct Column
+    {
+        uint32_t id;
+        size_type size;
+    };
+
+    std::ostream &stream() const;
+
+    /**
+     * Add the column of a stat to the current dump, defining it first
+     * if the stat has not been dumped before.
+     *
+     * @param labels Labels of the values, only used for a new column.
+     * @return Where the values of the column go in the dump.
+     */
+    double *addColumn(const Info &info, Kind kind, size_type size,
+                      const std::vector<std::string> &labels);
+
+    void appendDist(const DistData &data, double *out) const;
+    void distLabels(const DistData &data, const std::string &prefix,
+                    std::vector<std::string> &labels) const;
+
+    void writeRecord(RecordType type, const std::string &payload);
+
+    OutputStream *const file;
+    std::ostream *const userStream;
+    const bool enableDescriptions;
+
+    std::stack<std::string> path;
+
+    /** Columns by stat, or rather by stat and value count. */
+    std::unordered_map<const Info *, Column> columns;
+    uint32_t numColumns = 0;
+
+    /** Layouts by the columns they contain. */
+    std::map<std::vector<uint32_t>, uint32_t> layouts;
+
+    /** Columns and values of the dump in progress. */
+    std::vector<uint32_t> dumpColumns;
+    std::vector<double> dumpValues;
+};
+
+std::unique_ptr<Output> initColumnar(const std::string &filename,
+                                     bool desc = true);
+
+} // namespace statistics
+} // namespace gem5
+
+#endif // __BASE_STATS_COLUMNAR_HH__
@@ -0,0 +1,399 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "base/gtest/cur_tick_fake.hh"
+#include "base/stats/columnar.hh"
+#include "base/stats/info.hh"
+
+using namespace gem5;
+
+// Instantiate the fake class to have a valid curTick of 0
+GTestTickHandler tickHandler;
+
+namespace
+{
+
+class TestScalarInfo : public statistics::ScalarInfo
+{
+  public:
+    double val = 0;
+
+    explicit TestScalarInfo(const std::string &name)
+    {
+        setName(name, false);
+        flags.set(statistics::display);
+    }
+
+    bool check() const override { return true; }
+    void prepare() override {}
+    void reset() override { val = 0; }
+    bool zero() const override { return val == 0; }
+    void visit(statistics::Output &visitor) override { visitor.visit(*this); }
+
+    statistics::Counter value() const override { return val; }
+    statistics::Result result() const override { return val; }
+    statistics::Result total() const override { return val; }
+};
+
+class TestVectorInfo : public statistics::VectorInfo
+{
+  public:
+    statistics::VCounter counters;
+    mutable statistics::VResult results;
+
+    TestVectorInfo(const std::string &name, size_t size)
+        : counters(size, 0)
+    {
+        setName(name, false);
+        flags.set(statistics::display);
+    }
+
+    bool check() const override { return true; }
+    void prepare() override {}
+    void reset() override { std::fill(counters.begin(), counters.end(), 0); }
+    bool zero() const override { return false; }
+    void visit(statistics::Output &visitor) override { visitor.visit(*this); }
+
+    statistics::size_type size() const override { return counters.size(); }
+    const statistics::VCounter &value() const override { return counters; }
+
+    const statistics::VResult &
+    result() const override
+    {
+        results.assign(counters.begin(), counters.end());
+        return results;
+    }
+
+    statistics::Result
+    total() const override
+    {
+        statistics::Result sum = 0;
+        for (auto c : counters)
+            sum += c;
+        return sum;
+    }
+};
+
+class TestDistInfo : public statistics::DistInfo
+{
+  public:
+    explicit TestDistInfo(const std::string &name)
+    {
+        setName(name, false);
+        flags.set(statistics::display);
+    }
+
+    bool check() const override { return true; }
+    void prepare() override {}
+    void reset() override {}
+    bool zero() const override { return false; }
+    void visit(statistics::Output &visitor) override { visitor.visit(*this); }
+};
+
+/** Minimal reader for the records of a columnar stats file. */
+struct Parsed
+{
+    struct Column
+    {
+        uint8_t kind;
+        std::string name;
+        std::vector<std::string> labels;
+    };
+
+    struct Dump
+    {
+        uint32_t layout;
+        uint64_t tick;
+        std::vector<double> values;
+    };
+
+    std::vector<Column> columns;
+    std::vector<std::vector<uint32_t>> layouts;
+    std::vector<Dump> dumps;
+
+    explicit Parsed(const std::string &data)
+    {
+        const size_t magic_size = sizeof(statistics::Columnar::Magic) - 1;
+        EXPECT_EQ(data.substr(0, magic_size),
+                  std::string(statistics::Columnar::Magic));
+        EXPECT_EQ(get(data, magic_size, 4), statistics::Columnar::Version);
+
+        size_t pos = magic_size + 8;
+        while (pos < data.size()) {
+            const uint8_t type = data[pos];
+            const uint64_t size = get(data, pos + 1, 8);
+            size_t p = pos + 9;
+            pos = p + size;
+
+            switch (type) {
+              case statistics::Columnar::ColumnRecord: {
+                EXPECT_EQ(get(data, p, 4), columns.size());
+                Column column;
+                column.kind = data[p + 4];
+                p += 5;
+                column.name = string(data, p);
+                string(data, p); // description
+                string(data, p); // unit
+                uint32_t n = get(data, p, 4);
+                p += 4;
+                for (uint32_t i = 0; i < n; i++)
+                    column.labels.push_back(string(data, p));
+                columns.push_back(column);
+                break;
+              }
+              case statistics::Columnar::LayoutRecord: {
+                EXPECT_EQ(get(data, p, 4), layouts.size());
+                uint32_t n = get(data, p + 4, 4);
+                std::vector<uint32_t> ids;
+                for (uint32_t i = 0; i < n; i++)
+                    ids.push_back(get(data, p + 8 + 4 * i, 4));
+                layouts.push_back(ids);
+                break;
+              }
+              case statistics::Columnar::DumpRecord: {
+                Dump dump;
+                dump.layout = get(data, p, 4);
+                dump.tick = get(data, p + 4, 8);
+                for (p += 12; p < pos; p += 8) {
+                    uint64_t bits = get(data, p, 8);
+                    double value;
+                    std::memcpy(&value, &bits, sizeof(value));
+                    dump.values.push_back(value);
+                }
+                dumps.push_back(dump);
+                break;
+              }
+              default:
+                ADD_FAILURE() << "Unknown record type " << int(type);
+            }
+        }
+        EXPECT_EQ(pos, data.size());
+    }
+
+    static uint64_t
+    get(const std::string &data, size_t pos, int bytes)
+    {
+        uint64_t value = 0;
+        for (int i = 0; i < bytes; i++)
+            value |= uint64_t(uint8_t(data[pos + i])) << (8 * i);
+        return value;
+    }
+
+    static std::string
+    string(const std::string &data, size_t &pos)
+    {
+        uint32_t len = get(data, pos, 4);
+        std::string str = data.substr(pos + 4, len);
+        pos += 4 + len;
+        return str;
+    }
+};
+
+} // anonymous namespace
+
+/**
+ * The stats are only described by the first dump, later dumps only hold
+ * the tick and the values.
+ */
+TEST(StatsColumnarTest, SchemaWrittenOnce)
+{
+    std::ostringstream os;
+    statistics::Columnar columnar(os, true);
+
+    TestScalarInfo scalar("scalar");
+    TestVectorInfo vector("vector", 3);
+    vector.subnames = {"a", "", "c"};
+
+    for (int i = 0; i < 3; i++) {
+        tickHandler.setCurTick(100 * i);
+        scalar.val = i;
+        vector.counters = {1.0 * i, 2.0 * i, 3.0 * i};
+
+        columnar.begin();
+        columnar.beginGroup("system");
+        columnar.beginGroup("cpu");
+        scalar.visit(columnar);
+        columnar.endGroup();
+        vector.visit(columnar);
+        columnar.endGroup();
+        columnar.end();
+    }
+
+    Parsed parsed(os.str());
+    ASSERT_EQ(parsed.columns.size(), 2);
+    EXPECT_EQ(parsed.columns[0].kind, statistics::Columnar::ScalarKind);
+    EXPECT_EQ(parsed.columns[0].name, "system.cpu.scalar");
+    EXPECT_EQ(parsed.columns[1].kind, statistics::Columnar::VectorKind);
+    EXPECT_EQ(parsed.columns[1].name, "system.vector");
+    EXPECT_EQ(parsed.columns[1].labels,
+              std::vector<std::string>({"a", "1", "c"}));
+
+    ASSERT_EQ(parsed.layouts.size(), 1);
+    EXPECT_EQ(parsed.layouts[0], std::vector<uint32_t>({0, 1}));
+
+    ASSERT_EQ(parsed.dumps.size(), 3);
+    for (int i = 0; i < 3; i++) {
+        EXPECT_EQ(parsed.dumps[i].layout, 0);
+        EXPECT_EQ(parsed.dumps[i].tick, 100 * i);
+        EXPECT_EQ(parsed.dumps[i].values,
+                  std::vector<double>({1.0 * i, 1.0 * i, 2.0 * i, 3.0 * i}));
+    }
+}
+
+/** Dumps of a different set of stats get their own layout. */
+TEST(StatsColumnarTest, PartialDumps)
+{
+    std::ostringstream os;
+    statistics::Columnar columnar(os, false);
+
+    TestScalarInfo a("a"), b("b");
+    a.val = 1;
+    b.val = 2;
+
+    auto dump = [&](bool with_a) {
+        columnar.begin();
+        if (with_a)
+            a.visit(columnar);
+        b.visit(columnar);
+        columnar.end();
+    };
+    dump(true);
+    dump(false);
+    dump(true);
+    dump(false);
+
+    Parsed parsed(os.str());
+    ASSERT_EQ(parsed.columns.size(), 2);
+    ASSERT_EQ(parsed.layouts.size(), 2);
+    EXPECT_EQ(parsed.layouts[0], std::vector<uint32_t>({0, 1}));
+    EXPECT_EQ(parsed.layouts[1], std::vector<uint32_t>({1}));
+
+    ASSERT_EQ(parsed.dumps.size(), 4);
+    EXPECT_EQ(parsed.dumps[0].layout, 0);
+    EXPECT_EQ(parsed.dumps[1].layout, 1);
+    EXPECT_EQ(parsed.dumps[2].layout, 0);
+    EXPECT_EQ(parsed.dumps[3].layout, 1);
+    EXPECT_EQ(parsed.dumps[3].values, std::vector<double>({2}));
+}
+
+/** A stat whose number of values changes is described again. */
+TEST(StatsColumnarTest, ResizedStat)
+{
+    std::ostringstream os;
+    statistics::Columnar columnar(os, true);
+
+    TestVectorInfo vector("vector", 2);
+    columnar.begin();
+    vector.visit(columnar);
+    columnar.end();
+
+    vector.counters.resize(4, 1);
+    columnar.begin();
+    vector.visit(columnar);
+    columnar.end();
+
+    Parsed parsed(os.str());
+    ASSERT_EQ(parsed.columns.size(), 2);
+    EXPECT_EQ(parsed.columns[1].name, "vector");
+    EXPECT_EQ(parsed.columns[1].labels.size(), 4);
+    ASSERT_EQ(parsed.dumps.size(), 2);
+    EXPECT_EQ(parsed.dumps[1].layout, 1);
+    EXPECT_EQ(parsed.dumps[1].values, std::vector<double>({0, 0, 1, 1}));
+}
+
+/**
+ * An output file that was truncated, e.g., when it is recreated in the
+ * output directory of a forked child, starts with a complete schema.
+ */
+TEST(StatsColumnarTest, TruncatedFile)
+{
+    std::ostringstream os;
+    statistics::Columnar columnar(os, true);
+
+    TestScalarInfo scalar("scalar");
+    columnar.begin();
+    scalar.visit(columnar);
+    columnar.end();
+
+    os.str("");
+    scalar.val = 7;
+    columnar.begin();
+    scalar.visit(columnar);
+    columnar.end();
+
+    Parsed parsed(os.str());
+    ASSERT_EQ(parsed.columns.size(), 1);
+    ASSERT_EQ(parsed.layouts.size(), 1);
+    ASSERT_EQ(parsed.dumps.size(), 1);
+    EXPECT_EQ(parsed.dumps[0].values, std::vector<double>({7}));
+}
+
+/** Distributions hold their parameters and summary before the buckets. */
+TEST(StatsColumnarTest, Distribution)
+{
+    std::ostringstream os;
+    statistics::Columnar columnar(os, true);
+
+    TestDistInfo dist("dist");
+    dist.data.type = statistics::Dist;
+    dist.data.min = 0;
+    dist.data.max = 19;
+    dist.data.bucket_size = 10;
+    dist.data.min_val = 3;
+    dist.data.max_val = 12;
+    dist.data.underflow = 0;
+    dist.data.overflow = 0;
+    dist.data.cvec = {1, 1};
+    dist.data.sum = 15;
+    dist.data.squares = 153;
+    dist.data.logs = 0;
+    dist.data.samples = 2;
+
+    columnar.begin();
+    dist.visit(columnar);
+    columnar.end();
+
+    Parsed parsed(os.str());
+    ASSERT_EQ(parsed.columns.size(), 1);
+    EXPECT_EQ(parsed.columns[0].kind, statistics::Columnar::DistKind);
+    EXPECT_EQ(parsed.columns[0].labels,
+              std::vector<std::string>({"bucket_size", "min_bucket",
+                  "max_bucket", "samples", "sum", "squares", "min_value",
+                  "max_value", "underflows", "overflows", "0", "1"}));
+    ASSERT_EQ(parsed.dumps.size(), 1);
+    EXPECT_EQ(parsed.dumps[0].values,
+              std::vector<double>({10, 0, 19, 2, 15, 153, 3, 12, 0, 0,
+                                   1, 1}));
+}
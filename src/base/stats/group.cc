@@ -37,10 +37,17 @@
 
 #include "base/stats/group.hh"
 
+#include <algorithm>
+#include <cassert>
+#include <functional>
+#include <unordered_map>
+#include <unordered_set>
+
 #include "base/compiler.hh"
 #include "base/logging.hh"
 #include "base/named.hh"
 #include "base/stats/info.hh"
+#include "base/stats/storage.hh"
 #include "base/trace.hh"
 #include "debug/Stats.hh"
 
@@ -85,8 +92,15 @@ Group::regStats()
 void
 Group::resetStats()
 {
-    for (auto &s : stats)
-        s->reset();
+    if (flattened) {
+        for (const auto &[counters, count] : flatCounters)
+            std::fill_n(counters, count, StatStor(nullptr));
+        for (auto &s : unflatStats)
+            s->reset();
+    } else {
+        for (auto &s : stats)
+            s->reset();
+    }
 
     for (auto &g : mergedStatGroups)
         g->resetStats();
@@ -109,6 +123,8 @@ void
 Group::addStat(statistics::Info *info)
 {
     stats.push_back(info);
+    if (flattened)
+        unflatStats.push_back(info);
     if (mergedParent)
         mergedParent->addStat(info);
 }
@@ -189,5 +205,76 @@ Group::getStats() const
     return stats;
 }
 
+size_t
+flattenStats(Group &root)
+{
+    // The flat counters are never freed, the stats use them until the
+    // end of the simulation.
+    static std::vector<std::vector<StatStor>> arenas;
+
+    // Visit every group of the hierarchy once, parents before children.
+    std::unordered_set<Group *> seen_groups;
+    std::function<void(Group &, const std::function<void(Group &)> &)>
+        for_each_group = [&](Group &group, const auto &f) {
+            if (!seen_groups.insert(&group).second)
+                return;
+            f(group);
+            for (auto *g : group.mergedStatGroups)
+                for_each_group(*g, f);
+            for (auto &g : group.statGroups)
+                for_each_group(*g.second, f);
+        };
+
+    std::unordered_set<Info *> seen_stats;
+    size_t total = 0;
+    for_each_group(root, [&](Group &group) {
+        panic_if(group.flattened, "Stats flattened twice");
+        for (auto *info : group.stats) {
+            if (seen_stats.insert(info).second)
+                total += info->flatSize();
+        }
+    });
+
+    if (total == 0)
+        return 0;
+
+    // Stats that are reachable from several groups, e.g. those of
+    // merged groups, are moved along with the first one. Every group
+    // still resets all of its stats.
+    std::vector<StatStor> arena(total, StatStor(nullptr));
+    std::unordered_map<Info *, std::pair<StatStor *, size_t>> moved;
+    StatStor *next = arena.data();
+
+    seen_groups.clear();
+    for_each_group(root, [&](Group &group) {
+        group.flattened = true;
+        for (auto *info : group.stats) {
+            auto it = moved.find(info);
+            if (it == moved.end()) {
+                const size_t size = info->flatSize();
+                if (size > 0)
+                    info->flatten(next);
+                it = moved.emplace(info, std::make_pair(next, size)).first;
+                next += size;
+            }
+
+            const auto [counters, count] = it->second;
+            if (count == 0) {
+                group.unflatStats.push_back(info);
+            } else if (!group.flatCounters.empty() &&
+                       group.flatCounters.back().first +
+                       group.flatCounters.back().second == counters) {
+                group.flatCounters.back().second += count;
+            } else {
+                group.flatCounters.emplace_back(counters, count);
+            }
+        }
+    });
+    assert(next == arena.data() + total);
+
+    arenas.push_back(std::move(arena));
+    return total;
+}
+
 } // namespace statistics
 } // namespace gem5
@@ -40,6 +40,7 @@
 
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "base/compiler.hh"
@@ -78,6 +79,7 @@ namespace statistics
 {
 
 class Info;
+class StatStor;
 
 /**
  * Statistics container.
@@ -212,14 +214,39 @@ class Group
     void mergeStatGroup(Group *block);
 
   private:
+    friend size_t flattenStats(Group &root);
+
     /** Parent pointer if merged into parent */
     Group *mergedParent;
 
     std::map<std::string, Group *> statGroups;
     std::vector<Group *> mergedStatGroups;
     std::vector<Info *> stats;
+
+    /** Set once the counters of the stats have been flattened. */
+    bool flattened = false;
+    /** Runs of flat counters that belong to the stats of this group. */
+    std::vector<std::pair<StatStor *, size_t>> flatCounters;
+    /** Stats of a flattened group that are still reset one by one. */
+    std::vector<Info *> unflatStats;
 };
 
+/**
+ * Move the counters of the simple scalar, vector and 2d vector stats of
+ * a group hierarchy to one contiguous array, laid out group by group.
+ *
+ * Resetting the stats of a group then clears its counters in bulk
+ * instead of calling the reset function of each stat, and reading them
+ * for a dump walks memory linearly. Stats with other kinds of storage
+ * (e.g., averages and distributions) and formulas are left alone. This
+ * must be called after all stats have been registered and initialized,
+ * at most once per hierarchy.
+ *
+ * @param root The root of the group hierarchy.
+ * @return The number of counters that were moved.
+ */
+size_t flattenStats(Group &root);
+
 } // namespace statistics
 } // namespace gem5
 
@@ -32,6 +32,7 @@
 #include "base/stats/group.hh"
 #include "base/stats/info.hh"
 #include "base/stats/output.hh"
+#include "base/stats/storage.hh"
 
 using namespace gem5;
 
@@ -485,6 +486,101 @@ TEST(StatsGroupTest, ResetStats)
     ASSERT_EQ(info5.value, 0);
 }
 
+/** Stat whose counters can be moved to flat storage. */
+class FlatInfo : public statistics::Info
+{
+  public:
+    std::vector<statistics::StatStor> own;
+    statistics::StatStor *counters;
+    int resets = 0;
+
+    explicit FlatInfo(size_t size)
+        : own(size, statistics::StatStor(nullptr)), counters(own.data())
+    {
+        for (size_t i = 0; i < size; i++)
+            counters[i].set(i + 1);
+    }
+
+    bool check() const override { return true; }
+    void prepare() override {}
+    void
+    reset() override
+    {
+        resets++;
+        for (size_t i = 0; i < own.size(); i++)
+            counters[i].reset(nullptr);
+    }
+    bool zero() const override { return false; }
+    void visit(statistics::Output &visitor) override {}
+
+    statistics::size_type flatSize() const override { return own.size(); }
+
+    void
+    flatten(statistics::StatStor *dst) override
+    {
+        std::copy(counters, counters + own.size(), dst);
+        counters = dst;
+    }
+};
+
+/**
+ * Test that flattening moves the counters of a hierarchy to contiguous
+ * storage without changing their values, and that resetting a group
+ * still resets exactly the stats of the group, its sub-groups and its
+ * merged groups.
+ */
+TEST(StatsGroupTest, FlattenStats)
+{
+    statistics::Group root(nullptr);
+    statistics::Group node1(&root, "Node1");
+    statistics::Group node1_1(&node1);
+    statistics::Group node2(&root, "Node2");
+
+    FlatInfo info(1), info1(3), info1_1(2), info2(1);
+    info.setName("Info");
+    info1.setName("Info1");
+    info1_1.setName("Info1_1");
+    info2.setName("Info2");
+    root.addStat(&info);
+    node1.addStat(&info1);
+    node1_1.addStat(&info1_1);
+    node2.addStat(&info2);
+
+    DummyInfo dummy;
+    dummy.setName("Dummy");
+    dummy.value = 1;
+    node1.addStat(&dummy);
+
+    ASSERT_EQ(statistics::flattenStats(root), 7);
+
+    // The counters of the groups are laid out in order.
+    ASSERT_EQ(info1.counters, info.counters + 1);
+    ASSERT_EQ(info1_1.counters, info1.counters + 3);
+    ASSERT_EQ(info2.counters, info1_1.counters + 2);
+    ASSERT_EQ(info1.counters[2].value(), 3);
+    ASSERT_EQ(info1_1.counters[1].value(), 2);
+
+    // Stats added after flattening are reset one by one.
+    DummyInfo late;
+    late.setName("Late");
+    late.value = 1;
+    node1_1.addStat(&late);
+
+    node1.resetStats();
+    ASSERT_EQ(info.counters[0].value(), 1);
+    for (int i = 0; i < 3; i++)
+        ASSERT_EQ(info1.counters[i].value(), 0);
+    for (int i = 0; i < 2; i++)
+        ASSERT_EQ(info1_1.counters[i].value(), 0);
+    ASSERT_EQ(info2.counters[0].value(), 1);
+    ASSERT_EQ(dummy.value, 0);
+    ASSERT_EQ(late.value, 0);
+
+    // Flat counters are cleared in bulk, not through the stats.
+    ASSERT_EQ(info1.resets, 0);
+    ASSERT_EQ(info1_1.resets, 0);
+}
+
 /**
  * Test that calling preDumpStats calls the respective function of all sub-
  * groups and merged groups.
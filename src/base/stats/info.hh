@@ -75,6 +75,7 @@ const FlagsType __reserved =    init | display;
 
 struct StorageParams;
 struct Output;
+class StatStor;
 
 class Info
 {
@@ -161,6 +162,18 @@ class Info
      */
     virtual void visit(Output &visitor) = 0;
 
+    /**
+     * Number of counters this stat can move to flat storage.
+     * @sa flattenStats
+     */
+    virtual size_type flatSize() const { return 0; }
+
+    /**
+     * Move the counters of this stat to dst, which has room for
+     * flatSize() of them. The stat uses them from then on.
+     */
+    virtual void flatten(StatStor *dst) {}
+
     /**
      * Checks if the first stat's name is alphabetically less than the second.
      * This function breaks names up at periods and considers each subname
@@ -73,6 +73,7 @@ class BaseCPU(ClockedObject):
         PyBindMethod("getCurrentInstCount"),
         PyBindMethod("scheduleSimpointsInstStop"),
         PyBindMethod("scheduleInstStopAnyThread"),
+        PyBindMethod("clockPeriod"),
     ]
 
     @classmethod
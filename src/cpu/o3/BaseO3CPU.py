@@ -172,6 +172,17 @@ class BaseO3CPU(BaseCPU):
     numPhysCCRegs = Param.Unsigned(0, "Number of physical cc registers")
     numIQEntries = Param.Unsigned(64, "Number of instruction queue entries")
     numROBEntries = Param.Unsigned(192, "Number of reorder buffer entries")
+    dynInstArena = Param.Bool(
+        True, "Recycle dynamic instruction storage through a per-CPU arena"
+    )
+    # The stall statistics of the skipped cycles are reconstructed from
+    # the state of the pipeline when the CPU wakes up, and may differ from
+    # those of a CPU that ticked through them.
+    skipStalledCycles = Param.Bool(
+        False,
+        "Stop ticking while the pipeline only waits on a busy functional "
+        "unit or a delayed translation (single-threaded CPUs only)",
+    )
 
     smtNumFetchingThreads = Param.Unsigned(1, "SMT Number of Fetching Threads")
     smtFetchPolicy = Param.SMTFetchPolicy("RoundRobin", "SMT Fetch policy")
@@ -893,6 +893,25 @@ Commit::commit()
     }
 }
 
+void
+Commit::profileSkippedCycles(Cycles cycles)
+{
+    stats.numCommittedDist.sample(0, cycles);
+
+    if (!ppCommitStall->hasListeners())
+        return;
+
+    // The head of the ROB could not commit in any of these cycles.
+    for (ThreadID tid : *activeThreads) {
+        if (rob->isEmpty(tid))
+            continue;
+
+        const DynInstPtr &inst = rob->readHeadInst(tid);
+        for (uint64_t i = 0; i < cycles; i++)
+            ppCommitStall->notify(inst);
+    }
+}
+
 void
 Commit::commitInsts()
 {
@@ -205,6 +205,12 @@ class Commit
     /** Ticks the commit stage, which tries to commit instructions. */
     void tick();
 
+    /** Records the statistics of cycles the CPU skipped while the
+     *  pipeline was stalled, none of which committed an instruction, and
+     *  notifies the commit stall probe for each of them.
+     */
+    void profileSkippedCycles(Cycles cycles);
+
     /** Handles any squashes that are sent from IEW, and adds instructions
      * to the ROB and tries to commit instructions.
      */
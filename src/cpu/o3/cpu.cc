@@ -79,7 +79,14 @@ CPU::CPU(const BaseO3CPUParams &params)
 #ifndef NDEBUG
       instcount(0),
 #endif
+      // Instructions are in flight from the fetch queue to the ROB, which
+      // bounds how many buffers the arena has to hand out at once.
+      dynInstArena(params.dynInstArena ?
+              new DynInstArena(params.numROBEntries +
+                      params.fetchQueueSize * params.numThreads) :
+              nullptr),
       removeInstsThisCycle(false),
+      skipStalls(params.skipStalledCycles && params.numThreads == 1),
       fetch(this, params),
       decode(this, params),
       rename(this, params),
@@ -368,6 +375,7 @@ CPU::tick()
 
     ++baseStats.numCycles;
     updateCycleCounters(BaseCPU::CPU_STATE_ON);
+    stalledIdle = false;
 
 //    activity = false;
 
@@ -404,7 +412,12 @@ CPU::tick()
         } else if (!activityRec.active() || _status == Idle) {
             DPRINTF(O3CPU, "Idle!\n");
             lastRunningCycle = curCycle();
-            cpuStats.timesIdled++;
+            // Cycles spent waiting on stalled work are not idle, they are
+            // accounted to the stages once the CPU wakes up again.
+            stalledIdle = skipStalls && _status != Idle &&
+                iew.hasStalledWork();
+            if (!stalledIdle)
+                cpuStats.timesIdled++;
         } else {
             schedule(tickEvent, clockEdge(Cycles(1)));
             DPRINTF(O3CPU, "Scheduling next tick!\n");
@@ -1313,7 +1326,7 @@ CPU::wakeDependents(const DynInstPtr &inst)
 }
 */
 void
-CPU::wakeCPU()
+CPU::wakeCPU(bool after_tick)
 {
     if (activityRec.active() || tickEvent.scheduled()) {
         DPRINTF(Activity, "CPU already running.\n");
@@ -1322,15 +1335,30 @@ CPU::wakeCPU()
 
     DPRINTF(Activity, "Waking up CPU\n");
 
-    Cycles cycles(curCycle() - lastRunningCycle);
+    // A CPU skipping stalled cycles would have ticked at this edge already
+    // if it had kept running, so it resumes on the following one.
+    Cycles wake_delay(
+            stalledIdle && after_tick && clockEdge() == curTick() ? 1 : 0);
+
+    Cycles cycles(curCycle() + wake_delay - lastRunningCycle);
     // @todo: This is an oddity that is only here to match the stats
     if (cycles > 1) {
         --cycles;
-        cpuStats.idleCycles += cycles;
+        if (stalledIdle) {
+            fetch.profileSkippedCycles(cycles);
+            decode.profileSkippedCycles(cycles);
+            rename.profileSkippedCycles(cycles);
+            iew.profileSkippedCycles(cycles);
+            commit.profileSkippedCycles(cycles);
+            rob.profileSkippedCycles(cycles);
+        } else {
+            cpuStats.idleCycles += cycles;
+        }
         baseStats.numCycles += cycles;
     }
 
-    schedule(tickEvent, clockEdge());
+    stalledIdle = false;
+    schedule(tickEvent, clockEdge(wake_delay));
 }
 
 void
@@ -1457,7 +1485,7 @@ CPU::htmSendAbortSignal(ThreadID tid, uint64_t htm_uid,
 
     // notify l1 d-cache (ruby) that core has aborted transaction
     RequestPtr req =
-        std::make_shared<Request>(addr, size, flags, _dataRequestorId);
+        Request::create(addr, size, flags, _dataRequestorId);
 
     req->taskId(taskId());
     req->setContext(thread[tid]->contextId());
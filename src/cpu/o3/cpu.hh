@@ -45,6 +45,7 @@
 
 #include <iostream>
 #include <list>
+#include <memory>
 #include <queue>
 #include <set>
 #include <vector>
@@ -54,6 +55,7 @@
 #include "cpu/o3/comm.hh"
 #include "cpu/o3/commit.hh"
 #include "cpu/o3/decode.hh"
+#include "cpu/o3/dyn_inst_arena.hh"
 #include "cpu/o3/dyn_inst_ptr.hh"
 #include "cpu/o3/fetch.hh"
 #include "cpu/o3/free_list.hh"
@@ -380,6 +382,9 @@ class CPU : public BaseCPU
     int instcount;
 #endif
 
+    /** Storage recycled for the instructions of this CPU, if enabled. */
+    std::unique_ptr<DynInstArena, DynInstArena::Deleter> dynInstArena;
+
     /** List of all the instructions in flight. */
     std::list<DynInstPtr> instList;
 
@@ -400,6 +405,12 @@ class CPU : public BaseCPU
      */
     bool removeInstsThisCycle;
 
+    /** Whether the CPU stops ticking while the pipeline only waits on a
+     *  busy FU or a delayed translation. Only single-threaded CPUs skip
+     *  these cycles.
+     */
+    const bool skipStalls;
+
   protected:
     /** The fetch stage. */
     Fetch fetch;
@@ -501,8 +512,12 @@ class CPU : public BaseCPU
         activityRec.deactivateStage(idx);
     }
 
-    /** Wakes the CPU, rescheduling the CPU if it's not already active. */
-    void wakeCPU();
+    /** Wakes the CPU, rescheduling the CPU if it's not already active.
+     *  @param after_tick Whether the caller runs after the CPU would have
+     *  ticked in the current cycle, in which case a CPU that skipped
+     *  stalled cycles resumes on the next one.
+     */
+    void wakeCPU(bool after_tick = false);
 
     virtual void wakeup(ThreadID tid) override;
 
@@ -538,6 +553,11 @@ class CPU : public BaseCPU
     /** The cycle that the CPU was last running, used for statistics. */
     Cycles lastRunningCycle;
 
+    /** Whether the CPU stopped ticking with work stalled in the pipeline,
+     *  rather than for lack of any work.
+     */
+    bool stalledIdle = false;
+
     /** The cycle that the CPU was last activated by a new thread*/
     Tick lastActivatedCycle;
 
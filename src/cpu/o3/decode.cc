@@ -574,6 +574,23 @@ Decode::tick()
     }
 }
 
+void
+Decode::profileSkippedCycles(Cycles cycles)
+{
+    for (ThreadID tid : *activeThreads) {
+        if (decodeStatus[tid] == Blocked) {
+            stats.blockedCycles += cycles;
+        } else if (decodeStatus[tid] == Squashing) {
+            stats.squashCycles += cycles;
+        } else if (decodeStatus[tid] == Unblocking) {
+            stats.unblockCycles += cycles;
+        } else {
+            // Nothing arrives from fetch while the pipeline is stalled.
+            stats.idleCycles += cycles;
+        }
+    }
+}
+
 void
 Decode::decode(bool &status_change, ThreadID tid)
 {
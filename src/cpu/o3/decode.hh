@@ -136,6 +136,11 @@ class Decode
      */
     void tick();
 
+    /** Records the statistics of cycles the CPU skipped while the
+     *  pipeline was stalled, as if decode had ticked in each of them.
+     */
+    void profileSkippedCycles(Cycles cycles);
+
     /** Determines what to do based on decode's current status.
      * @param status_change decode() sets this variable if there was a status
      * change (ie switching from from blocking to unblocking).
@@ -167,8 +167,10 @@ DynInst::operator new(size_t count, Arrays &arrays)
     // Figure out how much space we need in total.
     size_t total_size = ready_src_idx + ready_src_idx_size;
 
-    // Actually allocate it.
-    uint8_t *buf = (uint8_t *)::operator new(total_size);
+    // Actually allocate it, recycling storage of retired instructions if
+    // the CPU has an arena.
+    uint8_t *buf =
+        (uint8_t *)DynInstArena::allocate(arrays.arena, total_size);
 
     // Fill in "arrays" with pointers to all the arrays.
     arrays.flatDestIdx = (RegId *)(buf + flat_dest_idx);
@@ -189,11 +191,12 @@ DynInst::operator new(size_t count, Arrays &arrays)
 
 // Because of the custom "new" operator that allocates more bytes than the
 // size of the DynInst object, AddressSanitizer throw new-delete-type-mismatch.
-// Adding a custom delete function is enough to shut down this false positive
+// Adding a custom delete function is enough to shut down this false positive.
+// It also hands the storage back to the arena it was allocated from.
 void
 DynInst::operator delete(void *ptr)
 {
-    ::operator delete(ptr);
+    DynInstArena::release(ptr);
 }
 
 DynInst::~DynInst()
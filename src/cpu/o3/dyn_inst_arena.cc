@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/o3/dyn_inst_arena.hh"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+namespace o3
+{
+
+void
+DynInstArena::Deleter::operator()(DynInstArena *arena) const
+{
+    arena->orphaned = true;
+    if (arena->numOutstanding == 0)
+        delete arena;
+}
+
+DynInstArena::DynInstArena(size_t max_insts) : maxInsts(max_insts)
+{}
+
+DynInstArena::~DynInstArena()
+{
+    for (void *chunk : chunks)
+        ::operator delete(chunk);
+}
+
+void *
+DynInstArena::allocate(DynInstArena *arena, size_t size)
+{
+    const size_t size_class =
+        (HeaderSize + size + Granularity - 1) / Granularity;
+
+    Header *header;
+    if (arena) {
+        header = (Header *)arena->allocateSlot(size_class);
+    } else {
+        header = (Header *)::operator new(size_class * Granularity);
+        header->sizeClass = size_class;
+    }
+    header->arena = arena;
+    header->magic = LiveMagic;
+
+    return (uint8_t *)header + HeaderSize;
+}
+
+void
+DynInstArena::release(void *ptr)
+{
+    Header *header = (Header *)((uint8_t *)ptr - HeaderSize);
+    panic_if(header->magic != LiveMagic,
+             "Releasing a DynInst buffer that is not live.\n");
+
+    if (header->arena) {
+        header->arena->releaseSlot(header);
+    } else {
+        header->magic = FreeMagic;
+        ::operator delete(header);
+    }
+}
+
+void *
+DynInstArena::allocateSlot(uint32_t size_class)
+{
+    if (size_class >= freeLists.size())
+        freeLists.resize(size_class + 1);
+
+    auto &free_list = freeLists[size_class];
+    if (free_list.empty())
+        refill(size_class);
+
+    Header *header = free_list.back();
+    free_list.pop_back();
+    checkFree(header);
+
+    ++numOutstanding;
+    return header;
+}
+
+void
+DynInstArena::releaseSlot(Header *header)
+{
+    markFree(header);
+    freeLists[header->sizeClass].push_back(header);
+
+    assert(numOutstanding > 0);
+    if (--numOutstanding == 0 && orphaned)
+        delete this;
+}
+
+void
+DynInstArena::markFree(Header *header)
+{
+    header->magic = FreeMagic;
+
+    uint8_t *payload = (uint8_t *)header + HeaderSize;
+    std::memcpy(payload, &Canary, sizeof(Canary));
+#ifdef GEM5_DEBUG
+    // Make stale references to the instruction fail loudly rather than
+    // read what looks like a valid instruction.
+    std::memset(payload + sizeof(Canary), Poison,
+                header->sizeClass * Granularity - HeaderSize -
+                sizeof(Canary));
+#endif
+}
+
+void
+DynInstArena::checkFree(const Header *header)
+{
+    assert(header->magic == FreeMagic);
+
+    const uint8_t *payload = (const uint8_t *)header + HeaderSize;
+    uint64_t canary;
+    std::memcpy(&canary, payload, sizeof(canary));
+    panic_if(canary != Canary,
+             "DynInst buffer written to after it was released.\n");
+#ifdef GEM5_DEBUG
+    const uint8_t *end = (const uint8_t *)header +
+        header->sizeClass * Granularity;
+    panic_if(std::any_of(payload + sizeof(Canary), end,
+                         [](uint8_t b) { return b != Poison; }),
+             "DynInst buffer written to after it was released.\n");
+#endif
+}
+
+void
+DynInstArena::refill(uint32_t size_class)
+{
+    auto &free_list = freeLists[size_class];
+    if (free_list.capacity() < maxInsts)
+        free_list.reserve(maxInsts);
+
+    const size_t slot_size = size_class * Granularity;
+    uint8_t *chunk = (uint8_t *)::operator new(slot_size * ChunkSlots);
+    chunks.push_back(chunk);
+
+    // Push the slots in reverse so they are handed out in address order.
+    for (size_t i = ChunkSlots; i > 0; i--) {
+        Header *header = (Header *)(chunk + (i - 1) * slot_size);
+        header->arena = this;
+        header->sizeClass = size_class;
+        markFree(header);
+        free_list.push_back(header);
+    }
+}
+
+} // namespace o3
+} // namespace gem5
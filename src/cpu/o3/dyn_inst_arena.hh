@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_O3_DYN_INST_ARENA_HH__
+#define __CPU_O3_DYN_INST_ARENA_HH__
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace gem5
+{
+
+namespace o3
+{
+
+/**
+ * Recycling storage for DynInsts. A DynInst and its register index arrays
+ * live in a single buffer whose size depends on the number of operands of
+ * the instruction, so buffers are handed out from per size class free
+ * lists. Buffers are carved out of contiguous chunks the first time a size
+ * class runs dry and go back on the free list when the last reference to
+ * the instruction is dropped, so a CPU in steady state stops going to the
+ * heap for instructions at all.
+ *
+ * Every buffer is preceded by a small header recording the arena it came
+ * from, which lets DynInst's operator delete return it without knowing
+ * which CPU the instruction belonged to. Instructions built without an
+ * arena get the same header with a null arena and are freed to the heap.
+ */
+class DynInstArena
+{
+  public:
+    /**
+     * Releases an arena that is no longer used to allocate. The arena
+     * itself is only destroyed once every buffer it handed out has been
+     * returned, as probes and in flight packets may still hold references
+     * to instructions of a CPU that is being torn down.
+     */
+    struct Deleter
+    {
+        void operator()(DynInstArena *arena) const;
+    };
+
+    /**
+     * @param max_insts Number of instructions the owner may have in flight
+     *        at once. Free lists are reserved to this size so recycling a
+     *        buffer never allocates either.
+     */
+    DynInstArena(size_t max_insts);
+
+    /**
+     * Get a buffer of at least size bytes.
+     *
+     * @param arena Arena to allocate from, or nullptr to use the heap.
+     * @param size Number of bytes needed.
+     * @return A buffer aligned for any DynInst.
+     */
+    static void *allocate(DynInstArena *arena, size_t size);
+
+    /** Return a buffer obtained from allocate(). */
+    static void release(void *ptr);
+
+    /** Number of buffers currently handed out. */
+    size_t outstanding() const { return numOutstanding; }
+
+  private:
+    ~DynInstArena();
+
+    struct Header
+    {
+        DynInstArena *arena;
+        uint32_t sizeClass;
+        uint32_t magic;
+    };
+
+    /** Bytes reserved in front of every buffer for its header. */
+    static constexpr size_t HeaderSize =
+        (sizeof(Header) + alignof(std::max_align_t) - 1) &
+        ~(alignof(std::max_align_t) - 1);
+
+    /** Buffer sizes are rounded up to a multiple of this. */
+    static constexpr size_t Granularity = 64;
+
+    /** Buffers carved out of the heap at once when a class runs dry. */
+    static constexpr size_t ChunkSlots = 32;
+
+    /** Header markers, used to catch double frees. */
+    static constexpr uint32_t LiveMagic = 0xd1a1f00d;
+    static constexpr uint32_t FreeMagic = 0xdeadd1a1;
+
+    /**
+     * Written at the start of the payload of free buffers, where stale
+     * references to the instruction would write, e.g., its reference
+     * count, and checked when the buffer is handed out again to catch
+     * uses after free.
+     */
+    static constexpr uint64_t Canary = 0xdbdbdbdbdeadd1a1;
+
+    /**
+     * Byte pattern written over the rest of free buffers in debug builds,
+     * which is also checked when they are handed out again.
+     */
+    static constexpr uint8_t Poison = 0xdb;
+
+    /** Mark a buffer free, writing the canary and poison over it. */
+    static void markFree(Header *header);
+    /** Check that a free buffer was not written to since markFree(). */
+    static void checkFree(const Header *header);
+
+    void *allocateSlot(uint32_t size_class);
+    void releaseSlot(Header *header);
+    void refill(uint32_t size_class);
+
+    const size_t maxInsts;
+
+    /** Free buffers, including their header, indexed by size class. */
+    std::vector<std::vector<Header *>> freeLists;
+
+    /** Chunks backing all buffers of this arena. */
+    std::vector<void *> chunks;
+
+    size_t numOutstanding = 0;
+
+    /** Set once the owner let go of the arena. */
+    bool orphaned = false;
+};
+
+} // namespace o3
+} // namespace gem5
+
+#endif // __CPU_O3_DYN_INST_ARENA_HH__
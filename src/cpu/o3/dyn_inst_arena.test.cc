@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "cpu/o3/dyn_inst_arena.hh"
+
+using namespace gem5;
+using namespace gem5::o3;
+
+namespace
+{
+
+/** Heap allocations that were not freed yet. */
+long liveAllocations = 0;
+
+using ArenaPtr = std::unique_ptr<DynInstArena, DynInstArena::Deleter>;
+
+} // anonymous namespace
+
+// Count heap allocations, to tell when an arena frees its memory.
+void *
+operator new(size_t size)
+{
+    void *ptr = std::malloc(size ? size : 1);
+    if (!ptr)
+        throw std::bad_alloc();
+    liveAllocations++;
+    return ptr;
+}
+
+void
+operator delete(void *ptr) noexcept
+{
+    if (ptr)
+        liveAllocations--;
+    std::free(ptr);
+}
+
+void
+operator delete(void *ptr, size_t) noexcept
+{
+    ::operator delete(ptr);
+}
+
+/** Released buffers are handed out again for the same size class. */
+TEST(DynInstArenaTest, SizeClassReuse)
+{
+    ArenaPtr arena(new DynInstArena(16));
+
+    void *small = DynInstArena::allocate(arena.get(), 100);
+    void *large = DynInstArena::allocate(arena.get(), 1000);
+    EXPECT_EQ(arena->outstanding(), 2);
+
+    DynInstArena::release(small);
+    DynInstArena::release(large);
+    EXPECT_EQ(arena->outstanding(), 0);
+
+    // Same size classes, even if not the same sizes.
+    EXPECT_EQ(DynInstArena::allocate(arena.get(), 90), small);
+    EXPECT_EQ(DynInstArena::allocate(arena.get(), 990), large);
+    EXPECT_EQ(arena->outstanding(), 2);
+
+    DynInstArena::release(small);
+    DynInstArena::release(large);
+}
+
+/** Buffers are aligned for any type and do not overlap. */
+TEST(DynInstArenaTest, Alignment)
+{
+    ArenaPtr arena(new DynInstArena(64));
+
+    std::vector<uint8_t *> buffers;
+    for (int i = 0; i < 64; i++) {
+        auto *buffer = (uint8_t *)DynInstArena::allocate(arena.get(), 200);
+        EXPECT_EQ((uintptr_t)buffer % alignof(std::max_align_t), 0);
+        std::fill(buffer, buffer + 200, i);
+        buffers.push_back(buffer);
+    }
+    for (int i = 0; i < 64; i++) {
+        EXPECT_EQ(buffers[i][0], i);
+        EXPECT_EQ(buffers[i][199], i);
+        DynInstArena::release(buffers[i]);
+    }
+}
+
+/** Without an arena, buffers come from and go back to the heap. */
+TEST(DynInstArenaTest, HeapWithoutArena)
+{
+    const long before = liveAllocations;
+    void *buffer = DynInstArena::allocate(nullptr, 300);
+    EXPECT_EQ(liveAllocations, before + 1);
+    EXPECT_EQ((uintptr_t)buffer % alignof(std::max_align_t), 0);
+    DynInstArena::release(buffer);
+    EXPECT_EQ(liveAllocations, before);
+}
+
+/** Releasing a buffer twice is caught. */
+TEST(DynInstArenaTest, DoubleFree)
+{
+    ArenaPtr arena(new DynInstArena(4));
+
+    void *buffer = DynInstArena::allocate(arena.get(), 100);
+    DynInstArena::release(buffer);
+    ASSERT_ANY_THROW(DynInstArena::release(buffer));
+}
+
+/** Writes to a released buffer are caught when it is handed out again. */
+TEST(DynInstArenaTest, UseAfterFree)
+{
+    ArenaPtr arena(new DynInstArena(4));
+
+    auto *buffer = (uint64_t *)DynInstArena::allocate(arena.get(), 100);
+    DynInstArena::release(buffer);
+    // E.g., dropping a stale reference to the instruction.
+    (*buffer)--;
+    ASSERT_ANY_THROW(DynInstArena::allocate(arena.get(), 100));
+}
+
+/** An orphaned arena is destroyed with its last outstanding buffer. */
+TEST(DynInstArenaTest, OrphanedArena)
+{
+    const long before = liveAllocations;
+    auto *arena = new DynInstArena(4);
+    void *first = DynInstArena::allocate(arena, 100);
+    void *second = DynInstArena::allocate(arena, 100);
+
+    DynInstArena::Deleter()(arena);
+    DynInstArena::release(first);
+    EXPECT_GT(liveAllocations, before);
+
+    DynInstArena::release(second);
+    EXPECT_EQ(liveAllocations, before);
+}
+
+/** An arena without outstanding buffers is destroyed right away. */
+TEST(DynInstArenaTest, IdleArena)
+{
+    const long before = liveAllocations;
+    {
+        ArenaPtr arena(new DynInstArena(4));
+        DynInstArena::release(DynInstArena::allocate(arena.get(), 100));
+        EXPECT_GT(liveAllocations, before);
+    }
+    EXPECT_EQ(liveAllocations, before);
+}
@@ -558,7 +558,7 @@ Fetch::fetchCacheLine(Addr vaddr, ThreadID tid, Addr pc)
     // Setup the memReq to do a read of the first instruction's address.
     // Set the appropriate read size and flags as well.
     // Build request here.
-    RequestPtr mem_req = std::make_shared<Request>(
+    RequestPtr mem_req = Request::create(
         fetchBufferBlockPC, fetchBufferSize,
         Request::INST_FETCH, cpu->instRequestorId(), pc,
         cpu->thread[tid]->contextId());
@@ -1027,6 +1027,7 @@ Fetch::buildInst(ThreadID tid, StaticInstPtr staticInst,
     DynInst::Arrays arrays;
     arrays.numSrcs = staticInst->numSrcRegs();
     arrays.numDests = staticInst->numDestRegs();
+    arrays.arena = cpu->dynInstArena.get();
 
     // Create a new DynInst from the instruction fetched.
     DynInstPtr instruction = new (arrays) DynInst(
@@ -1532,42 +1533,57 @@ Fetch::pipelineIcacheAccesses(ThreadID tid)
 }
 
 void
-Fetch::profileStall(ThreadID tid)
+Fetch::profileSkippedCycles(Cycles cycles)
+{
+    fetchStats.nisnDist.sample(0, cycles);
+
+    // Single-threaded fetch picks its thread without side effects.
+    ThreadID tid = getFetchingThread();
+
+    if (tid == InvalidThreadID) {
+        profileStall(0, cycles);
+    } else if (fetchStatus[tid] == Idle) {
+        fetchStats.idleCycles += cycles * numFetchingThreads;
+    }
+}
+
+void
+Fetch::profileStall(ThreadID tid, Cycles cycles)
 {
     DPRINTF(Fetch,"There are no more threads available to fetch from.\n");
 
     // @todo Per-thread stats
 
     if (stalls[tid].drain) {
-        ++fetchStats.pendingDrainCycles;
+        fetchStats.pendingDrainCycles += cycles;
         DPRINTF(Fetch, "Fetch is waiting for a drain!\n");
     } else if (activeThreads->empty()) {
-        ++fetchStats.noActiveThreadStallCycles;
+        fetchStats.noActiveThreadStallCycles += cycles;
         DPRINTF(Fetch, "Fetch has no active thread!\n");
     } else if (fetchStatus[tid] == Blocked) {
-        ++fetchStats.blockedCycles;
+        fetchStats.blockedCycles += cycles;
         DPRINTF(Fetch, "[tid:%i] Fetch is blocked!\n", tid);
     } else if (fetchStatus[tid] == Squashing) {
-        ++fetchStats.squashCycles;
+        fetchStats.squashCycles += cycles;
         DPRINTF(Fetch, "[tid:%i] Fetch is squashing!\n", tid);
     } else if (fetchStatus[tid] == IcacheWaitResponse) {
-        cpu->fetchStats[tid]->icacheStallCycles++;
+        cpu->fetchStats[tid]->icacheStallCycles += cycles;
         DPRINTF(Fetch, "[tid:%i] Fetch is waiting cache response!\n",
                 tid);
     } else if (fetchStatus[tid] == ItlbWait) {
-        ++fetchStats.tlbCycles;
+        fetchStats.tlbCycles += cycles;
         DPRINTF(Fetch, "[tid:%i] Fetch is waiting ITLB walk to "
                 "finish!\n", tid);
     } else if (fetchStatus[tid] == TrapPending) {
-        ++fetchStats.pendingTrapStallCycles;
+        fetchStats.pendingTrapStallCycles += cycles;
         DPRINTF(Fetch, "[tid:%i] Fetch is waiting for a pending trap!\n",
                 tid);
     } else if (fetchStatus[tid] == QuiescePending) {
-        ++fetchStats.pendingQuiesceStallCycles;
+        fetchStats.pendingQuiesceStallCycles += cycles;
         DPRINTF(Fetch, "[tid:%i] Fetch is waiting for a pending quiesce "
                 "instruction!\n", tid);
     } else if (fetchStatus[tid] == IcacheWaitRetry) {
-        ++fetchStats.icacheWaitRetryStallCycles;
+        fetchStats.icacheWaitRetryStallCycles += cycles;
         DPRINTF(Fetch, "[tid:%i] Fetch is waiting for an I-cache retry!\n",
                 tid);
     } else if (fetchStatus[tid] == NoGoodAddr) {
@@ -258,6 +258,11 @@ class Fetch
     /** Tells fetch to wake up from a quiesce instruction. */
     void wakeFromQuiesce();
 
+    /** Records the statistics of cycles the CPU skipped while the
+     *  pipeline was stalled, as if fetch had ticked in each of them.
+     */
+    void profileSkippedCycles(Cycles cycles);
+
     /** For priority-based fetch policies, need to keep update priorityList */
     void deactivateThread(ThreadID tid);
   private:
@@ -383,8 +388,10 @@ class Fetch
     /** Pipeline the next I-cache access to the current one. */
     void pipelineIcacheAccesses(ThreadID tid);
 
-    /** Profile the reasons of fetch stall. */
-    void profileStall(ThreadID tid);
+    /** Profile the reasons of fetch stall, over the given number of
+     *  cycles.
+     */
+    void profileStall(ThreadID tid, Cycles cycles = Cycles(1));
 
   private:
     /** Pointer to the O3CPU. */
@@ -206,6 +206,31 @@ FUPool::processFreeUnits()
     }
 }
 
+bool
+FUPool::isAvailable(OpClass capability)
+{
+    if (!capabilityList[capability] || !unitsToBeFreed.empty())
+        return true;
+
+    for (int i = 0; i < numFU; i++) {
+        if (!unitBusy[i] && funcUnits[i]->provides(capability))
+            return true;
+    }
+
+    return false;
+}
+
+void
+FUPool::skipBusyCycles(OpClass capability, Cycles cycles)
+{
+    if (!capabilityList[capability])
+        return;
+
+    // getUnit() goes around the whole queue and back to its first FU.
+    FUIdxQueue &queue = fuPerCapList[capability];
+    queue.skip(cycles * (queue.numFUs() + 1));
+}
+
 void
 FUPool::dump()
 {
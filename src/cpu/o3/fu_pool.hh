@@ -111,6 +111,12 @@ class FUPool : public SimObject
          */
         inline int getFU();
 
+        /** Moves the head of the queue as n calls to getFU() would. */
+        void skip(uint64_t n) { idx = (idx + n % size) % size; }
+
+        /** Returns the number of FUs in the queue. */
+        int numFUs() const { return size; }
+
       private:
         /** Circular queue index. */
         int idx;
@@ -159,6 +165,19 @@ class FUPool : public SimObject
     /** Frees all FUs on the list. */
     void processFreeUnits();
 
+    /**
+     * Could an op of the given capability get a FU next cycle? Ops the
+     * pool has no FU for never wait on one, and units that are about to
+     * be freed count as available.
+     */
+    bool isAvailable(OpClass capability);
+
+    /**
+     * Moves the round robin of the FUs of a capability as getUnit() would
+     * have on cycles it found all of them busy.
+     */
+    void skipBusyCycles(OpClass capability, Cycles cycles);
+
     /** Returns the total number of FUs. */
     int size() { return numFU; }
 
@@ -628,15 +628,20 @@ IEW::updateStatus()
     // If there are no ready instructions waiting to be scheduled by the IQ,
     // and there's no stores waiting to write back, and dispatch is not
     // unblocking, then there is no internal activity for the IEW stage.
+    // Ready instructions only waiting on busy FUs do not count if the CPU
+    // can skip those cycles, as the FU completion wakes it up again.
     instQueue.iqIOStats.intInstQueueReads++;
-    if (_status == Active && !instQueue.hasReadyInsts() &&
+    bool has_ready_insts = cpu->skipStalls ?
+        instQueue.canIssueReadyInsts() : instQueue.hasReadyInsts();
+
+    if (_status == Active && !has_ready_insts &&
         !ldstQueue.willWB() && !any_unblocking) {
         DPRINTF(IEW, "IEW switching to idle\n");
 
         deactivateStage();
 
         _status = Inactive;
-    } else if (_status == Inactive && (instQueue.hasReadyInsts() ||
+    } else if (_status == Inactive && (has_ready_insts ||
                                        ldstQueue.willWB() ||
                                        any_unblocking)) {
         // Otherwise there is internal activity.  Set to active.
@@ -762,9 +767,33 @@ IEW::emptyRenameInsts(ThreadID tid)
 }
 
 void
-IEW::wakeCPU()
+IEW::wakeCPU(bool after_tick)
+{
+    cpu->wakeCPU(after_tick);
+}
+
+bool
+IEW::hasStalledWork()
+{
+    return instQueue.hasReadyInsts() || instQueue.hasDeferredMemInsts();
+}
+
+void
+IEW::profileSkippedCycles(Cycles cycles)
 {
-    cpu->wakeCPU();
+    for (ThreadID tid : *activeThreads) {
+        if (dispatchStatus[tid] == Blocked) {
+            iewStats.blockCycles += cycles;
+        } else if (dispatchStatus[tid] == Squashing) {
+            iewStats.squashCycles += cycles;
+        } else if (dispatchStatus[tid] == Unblocking) {
+            iewStats.unblockCycles += cycles;
+        }
+    }
+
+    // Mirrors the IQ read of updateStatus() on every cycle.
+    instQueue.iqIOStats.intInstQueueReads += cycles;
+    instQueue.profileSkippedCycles(cycles);
 }
 
 void
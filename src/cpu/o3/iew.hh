@@ -206,7 +206,17 @@ class IEW
     /** Tells the CPU to wakeup if it has descheduled itself due to no
      * activity. Used mainly by the LdWritebackEvent.
      */
-    void wakeCPU();
+    void wakeCPU(bool after_tick = false);
+
+    /** Returns if the IQ holds instructions that wait on a busy FU or a
+     *  delayed translation rather than on their operands.
+     */
+    bool hasStalledWork();
+
+    /** Records the statistics of cycles the CPU skipped while IEW was
+     *  stalled.
+     */
+    void profileSkippedCycles(Cycles cycles);
 
     /** Reports to the CPU that there is activity this cycle. */
     void activityThisCycle();
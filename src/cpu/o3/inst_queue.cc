@@ -124,6 +124,16 @@ InstructionQueue::InstructionQueue(CPU *cpu_ptr, IEW *iew_ptr,
         memDepUnit[tid].setIQ(this);
     }
 
+    // An instruction leaves the ROB at commit but only leaves the IQ once
+    // the commit has travelled back over the commit to IEW time buffer, so
+    // the ROB may refill with up to a commit width per cycle meanwhile.
+    const size_t inst_list_size = params.numROBEntries +
+        params.commitWidth * (params.commitToIEWDelay + 1);
+    instList.reserve(MaxThreads);
+    for (ThreadID tid = 0; tid < MaxThreads; tid++) {
+        instList.emplace_back(tid < numThreads ? inst_list_size : 0);
+    }
+
     resetState();
 
     //Figure out resource sharing policy
@@ -396,7 +406,10 @@ InstructionQueue::resetState()
     //Initialize thread IQ counts
     for (ThreadID tid = 0; tid < MaxThreads; tid++) {
         count[tid] = 0;
-        instList[tid].clear();
+        while (!instList[tid].empty()) {
+            instList[tid].front() = nullptr;
+            instList[tid].pop_front();
+        }
     }
 
     // Initialize the number of free IQ entries.
@@ -559,6 +572,20 @@ InstructionQueue::hasReadyInsts()
     return false;
 }
 
+bool
+InstructionQueue::canIssueReadyInsts()
+{
+    for (const auto &entry : listOrder) {
+        if (entry.queueType == No_OpClass ||
+            readyInsts[entry.queueType].top()->isSquashed() ||
+            fuPool->isAvailable(entry.queueType)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 void
 InstructionQueue::insert(const DynInstPtr &new_inst)
 {
@@ -576,6 +603,9 @@ InstructionQueue::insert(const DynInstPtr &new_inst)
             new_inst->seqNum, new_inst->pcState());
 
     assert(freeEntries != 0);
+    panic_if(instList[new_inst->threadNumber].full(),
+             "IQ instruction list of thread %i overflowed.\n",
+             new_inst->threadNumber);
 
     instList[new_inst->threadNumber].push_back(new_inst);
 
@@ -626,6 +656,9 @@ InstructionQueue::insertNonSpec(const DynInstPtr &new_inst)
             new_inst->seqNum, new_inst->pcState());
 
     assert(freeEntries != 0);
+    panic_if(instList[new_inst->threadNumber].full(),
+             "IQ instruction list of thread %i overflowed.\n",
+             new_inst->threadNumber);
 
     instList[new_inst->threadNumber].push_back(new_inst);
 
@@ -733,7 +766,7 @@ InstructionQueue::processFUCompletion(const DynInstPtr &inst, int fu_idx)
     // The CPU could have been sleeping until this op completed (*extremely*
     // long latency op).  Wake it if it was.  This may be overkill.
    --wbOutstanding;
-    iewStage->wakeCPU();
+    iewStage->wakeCPU(true);
 
     if (fu_idx > -1)
         fuPool->freeUnitNextCycle(fu_idx);
@@ -908,10 +941,11 @@ InstructionQueue::scheduleReadyInsts()
     iqStats.instsIssued+= total_issued;
 
     // If we issued any instructions, tell the CPU we had activity.
-    // @todo If the way deferred memory instructions are handeled due to
-    // translation changes then the deferredMemInsts condition should be
-    // removed from the code below.
-    if (total_issued || !retryMemInsts.empty() || !deferredMemInsts.empty()) {
+    // Deferred memory instructions only need the CPU ticking when their
+    // translation completes, which wakes it up if it is skipping stalled
+    // cycles.
+    if (total_issued || !retryMemInsts.empty() ||
+        (!cpu->skipStalls && !deferredMemInsts.empty())) {
         cpu->activityThisCycle();
     } else {
         DPRINTF(IQ, "Not able to schedule any instructions.\n");
@@ -951,11 +985,9 @@ InstructionQueue::commit(const InstSeqNum &inst, ThreadID tid)
     DPRINTF(IQ, "[tid:%i] Committing instructions older than [sn:%llu]\n",
             tid,inst);
 
-    ListIt iq_it = instList[tid].begin();
-
-    while (iq_it != instList[tid].end() &&
-           (*iq_it)->seqNum <= inst) {
-        ++iq_it;
+    while (!instList[tid].empty() &&
+           instList[tid].front()->seqNum <= inst) {
+        instList[tid].front() = nullptr;
         instList[tid].pop_front();
     }
 
@@ -1131,6 +1163,34 @@ InstructionQueue::cacheUnblocked()
     cpu->wakeCPU();
 }
 
+void
+InstructionQueue::profileSkippedCycles(Cycles cycles)
+{
+    // Nothing could issue, so each cycle would have tried the oldest
+    // instruction of every op class once and found its FU busy. Only
+    // the completion of a FU, which wakes the CPU up, changes that.
+    for (const auto &entry : listOrder) {
+        const DynInstPtr &inst = readyInsts[entry.queueType].top();
+
+        if (inst->isFloating()) {
+            iqIOStats.fpInstQueueReads += cycles;
+            iqIOStats.fpAluAccesses += cycles;
+        } else if (inst->isVector()) {
+            iqIOStats.vecInstQueueReads += cycles;
+            iqIOStats.vecAluAccesses += cycles;
+        } else {
+            iqIOStats.intInstQueueReads += cycles;
+            iqIOStats.intAluAccesses += cycles;
+        }
+
+        iqStats.statFuBusy[entry.queueType] += cycles;
+        iqStats.fuBusy[inst->threadNumber] += cycles;
+        fuPool->skipBusyCycles(entry.queueType, cycles);
+    }
+
+    iqStats.numIssuedDist.sample(0, cycles);
+}
+
 DynInstPtr
 InstructionQueue::getDeferredMemInstToExecute()
 {
@@ -1184,19 +1244,15 @@ InstructionQueue::squash(ThreadID tid)
 void
 InstructionQueue::doSquash(ThreadID tid)
 {
-    // Start at the tail.
-    ListIt squash_it = instList[tid].end();
-    --squash_it;
-
     DPRINTF(IQ, "[tid:%i] Squashing until sequence number %i!\n",
             tid, squashedSeqNum[tid]);
 
     // Squash any instructions younger than the squashed sequence number
-    // given.
-    while (squash_it != instList[tid].end() &&
-           (*squash_it)->seqNum > squashedSeqNum[tid]) {
+    // given, starting at the tail.
+    while (!instList[tid].empty() &&
+           instList[tid].back()->seqNum > squashedSeqNum[tid]) {
 
-        DynInstPtr squashed_inst = (*squash_it);
+        DynInstPtr squashed_inst = instList[tid].back();
         if (squashed_inst->isFloating()) {
             iqIOStats.fpInstQueueWrites++;
         } else if (squashed_inst->isVector()) {
@@ -1205,13 +1261,10 @@ InstructionQueue::doSquash(ThreadID tid)
             iqIOStats.intInstQueueWrites++;
         }
 
-        // Only handle the instruction if it actually is in the IQ and
-        // hasn't already been squashed in the IQ.
-        if (squashed_inst->threadNumber != tid ||
-            squashed_inst->isSquashedInIQ()) {
-            --squash_it;
-            continue;
-        }
+        // Instructions are removed from their thread's list as soon as
+        // they are squashed in the IQ, so the tail is never one of them.
+        assert(squashed_inst->threadNumber == tid &&
+               !squashed_inst->isSquashedInIQ());
 
         if (!squashed_inst->isIssued() ||
             (squashed_inst->isMemRef() &&
@@ -1318,7 +1371,8 @@ InstructionQueue::doSquash(ThreadID tid)
             assert(dependGraph.empty(dest_reg->flatIndex()));
             dependGraph.clearInst(dest_reg->flatIndex());
         }
-        instList[tid].erase(squash_it--);
+        instList[tid].back() = nullptr;
+        instList[tid].pop_back();
         ++iqStats.squashedInstsExamined;
     }
 }
@@ -1505,7 +1559,7 @@ InstructionQueue::dumpInsts()
     for (ThreadID tid = 0; tid < numThreads; ++tid) {
         int num = 0;
         int valid_num = 0;
-        ListIt inst_list_it = instList[tid].begin();
+        auto inst_list_it = instList[tid].begin();
 
         while (inst_list_it != instList[tid].end()) {
             cprintf("Instruction:%i\n", num);
@@ -47,6 +47,7 @@
 #include <queue>
 #include <vector>
 
+#include "base/circular_queue.hh"
 #include "base/statistics.hh"
 #include "base/types.hh"
 #include "cpu/inst_seq.hh"
@@ -181,6 +182,14 @@ class InstructionQueue
     /** Returns if there are any ready instructions in the IQ. */
     bool hasReadyInsts();
 
+    /** Returns if any ready instruction could issue next cycle, rather
+     *  than wait on a busy non-pipelined FU to complete.
+     */
+    bool canIssueReadyInsts();
+
+    /** Returns if any memory instruction waits on a delayed translation. */
+    bool hasDeferredMemInsts() const { return !deferredMemInsts.empty(); }
+
     /** Inserts a new instruction into the IQ. */
     void insert(const DynInstPtr &new_inst);
 
@@ -262,6 +271,11 @@ class InstructionQueue
     /**  Notify instruction queue that a previous blockage has resolved */
     void cacheUnblocked();
 
+    /** Records the statistics of cycles the CPU skipped while the IQ was
+     *  stalled, as if scheduleReadyInsts() had run in each of them.
+     */
+    void profileSkippedCycles(Cycles cycles);
+
     /** Indicates an ordering violation between a store and a load. */
     void violation(const DynInstPtr &store, const DynInstPtr &faulting_load);
 
@@ -317,8 +331,11 @@ class InstructionQueue
     // Instruction lists, ready queues, and ordering
     //////////////////////////////////////
 
-    /** List of all the instructions in the IQ (some of which may be issued). */
-    std::list<DynInstPtr> instList[MaxThreads];
+    /** List of all the instructions in the IQ (some of which may be issued).
+     *  Instructions stay here until commit, so each thread's ring is sized
+     *  to the ROB plus the commits still in flight back to the IQ.
+     */
+    std::vector<CircularQueue<DynInstPtr>> instList;
 
     /** List of instructions that are ready to be executed. */
     std::list<DynInstPtr> instsToExecute;
@@ -840,7 +840,7 @@ LSQ::pushRequest(const DynInstPtr& inst, bool isLoad, uint8_t *data,
             inst->effAddrValid(true);
 
             if (cpu->checker) {
-                inst->reqToVerify = std::make_shared<Request>(*request->req());
+                inst->reqToVerify = Request::create(*request->req());
             }
             Fault fault;
             if (isLoad)
@@ -896,6 +896,9 @@ LSQ::SingleDataRequest::finish(const Fault &fault, const RequestPtr &request,
 
         LSQRequest::_inst->fault = fault;
         LSQRequest::_inst->translationCompleted(true);
+
+        if (isDelayed() && _port.skipStalls())
+            _port.wakeCPU();
     }
 }
 
@@ -942,6 +945,9 @@ LSQ::SplitDataRequest::finish(const Fault &fault, const RequestPtr &req,
                 _inst->fault = _fault[0];
                 setState(State::Fault);
             }
+
+            if (isDelayed() && _port.skipStalls())
+                _port.wakeCPU();
         }
 
     }
@@ -963,6 +969,10 @@ LSQ::SingleDataRequest::initiateTranslation()
 
         _inst->savedRequest = this;
         sendFragmentToTranslation(0);
+
+        // Not every MMU marks the translations it defers.
+        if (_port.skipStalls() && !isTranslationComplete())
+            markDelayed();
     } else {
         _inst->setMemAccPredicate(false);
     }
@@ -989,7 +999,7 @@ LSQ::SplitDataRequest::initiateTranslation()
     Addr final_addr = addrBlockAlign(_addr + _size, cacheLineSize);
     uint32_t size_so_far = 0;
 
-    _mainReq = std::make_shared<Request>(base_addr,
+    _mainReq = Request::create(base_addr,
                 _size, _flags, _inst->requestorId(),
                 _inst->pcState().instAddr(), _inst->contextId());
     _mainReq->setByteEnable(_byteEnable);
@@ -1044,6 +1054,10 @@ LSQ::SplitDataRequest::initiateTranslation()
         for (uint32_t i = 0; i < _reqs.size(); i++) {
             sendFragmentToTranslation(i);
         }
+
+        // Not every MMU marks the translations it defers.
+        if (_port.skipStalls() && !isTranslationComplete())
+            markDelayed();
     } else {
         _inst->setMemAccPredicate(false);
     }
@@ -1106,7 +1120,7 @@ LSQ::LSQRequest::addReq(Addr addr, unsigned size,
            const std::vector<bool>& byte_enable)
 {
     if (isAnyActiveElement(byte_enable.begin(), byte_enable.end())) {
-        auto req = std::make_shared<Request>(
+        auto req = Request::create(
                 addr, size, _flags, _inst->requestorId(),
                 _inst->pcState().instAddr(), _inst->contextId(),
                 std::move(_amo_op));
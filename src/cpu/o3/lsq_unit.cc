@@ -1307,6 +1307,10 @@ void LSQUnit::schedule(Event& ev, Tick when) { cpu->schedule(ev, when); }
 
 BaseMMU *LSQUnit::getMMUPtr() { return cpu->mmu; }
 
+void LSQUnit::wakeCPU() { iewStage->wakeCPU(); }
+
+bool LSQUnit::skipStalls() const { return cpu->skipStalls; }
+
 unsigned int
 LSQUnit::cacheLineSize()
 {
@@ -394,6 +394,14 @@ class LSQUnit
 
     BaseMMU *getMMUPtr();
 
+    /** Wakes the CPU once a delayed translation completes, as it may have
+     *  stopped ticking while the instruction was deferred.
+     */
+    void wakeCPU();
+
+    /** Whether the CPU skips the cycles it only spends stalled. */
+    bool skipStalls() const;
+
   private:
     /** Pointer to the CPU. */
     CPU *cpu;
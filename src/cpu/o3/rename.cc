@@ -451,6 +451,25 @@ Rename::tick()
 
 }
 
+void
+Rename::profileSkippedCycles(Cycles cycles)
+{
+    for (ThreadID tid : *activeThreads) {
+        if (renameStatus[tid] == Blocked) {
+            stats.blockCycles += cycles;
+        } else if (renameStatus[tid] == Squashing) {
+            stats.squashCycles += cycles;
+        } else if (renameStatus[tid] == SerializeStall) {
+            stats.serializeStallCycles += cycles;
+        } else if (renameStatus[tid] == Unblocking) {
+            stats.unblockCycles += cycles;
+        } else {
+            // Nothing arrives from decode while the pipeline is stalled.
+            stats.idleCycles += cycles;
+        }
+    }
+}
+
 void
 Rename::rename(bool &status_change, ThreadID tid)
 {
@@ -195,6 +195,11 @@ class Rename
      */
     void tick();
 
+    /** Records the statistics of cycles the CPU skipped while the
+     *  pipeline was stalled, as if rename had ticked in each of them.
+     */
+    void profileSkippedCycles(Cycles cycles);
+
     /** Debugging function used to dump history buffer of renamings. */
     void dumpHistory();
 
@@ -97,6 +97,13 @@ ROB::ROB(CPU *_cpu, const BaseO3CPUParams &params)
         maxEntries[tid] = 0;
     }
 
+    // Every thread may fill the entire ROB under the dynamic policy, so
+    // each ring is sized to the full ROB rather than the thread's share.
+    instList.reserve(MaxThreads);
+    for (ThreadID tid = 0; tid < MaxThreads; tid++) {
+        instList.emplace_back(tid < numThreads ? numEntries : 0);
+    }
+
     resetState();
 }
 
@@ -105,7 +112,7 @@ ROB::resetState()
 {
     for (ThreadID tid = 0; tid  < MaxThreads; tid++) {
         threadEntries[tid] = 0;
-        squashIt[tid] = instList[tid].end();
+        squashIt[tid] = InstIt();
         squashedSeqNum[tid] = 0;
         doneSquashing[tid] = true;
     }
@@ -113,8 +120,8 @@ ROB::resetState()
 
     // Initialize the "universal" ROB head & tail point to invalid
     // pointers
-    head = instList[0].end();
-    tail = instList[0].end();
+    head = InstIt();
+    tail = InstIt();
 }
 
 std::string
@@ -237,11 +244,10 @@ ROB::retireHead(ThreadID tid)
 
     assert(numInstsInROB > 0);
 
-    // Get the head ROB instruction by copying it and remove it from the list
-    InstIt head_it = instList[tid].begin();
-
-    DynInstPtr head_inst = std::move(*head_it);
-    instList[tid].erase(head_it);
+    // Get the head ROB instruction by moving it out of its slot, which
+    // leaves the slot empty so the ring holds no stale reference to it
+    DynInstPtr head_inst = std::move(instList[tid].front());
+    instList[tid].pop_front();
 
     assert(head_inst->readyToCommit());
 
@@ -275,6 +281,12 @@ ROB::isHeadReady(ThreadID tid)
     return false;
 }
 
+void
+ROB::profileSkippedCycles(Cycles cycles)
+{
+    stats.reads += cycles;
+}
+
 bool
 ROB::canCommit()
 {
@@ -312,13 +324,13 @@ ROB::doSquash(ThreadID tid)
     DPRINTF(ROB, "[tid:%i] Squashing instructions until [sn:%llu].\n",
             tid, squashedSeqNum[tid]);
 
-    assert(squashIt[tid] != instList[tid].end());
+    assert(squashIt[tid] != InstIt());
 
     if ((*squashIt[tid])->seqNum < squashedSeqNum[tid]) {
         DPRINTF(ROB, "[tid:%i] Done squashing instructions.\n",
                 tid);
 
-        squashIt[tid] = instList[tid].end();
+        squashIt[tid] = InstIt();
 
         doneSquashing[tid] = true;
         return;
@@ -338,7 +350,7 @@ ROB::doSquash(ThreadID tid)
 
     for (int numSquashed = 0;
          numSquashed < numInstsToSquash &&
-         squashIt[tid] != instList[tid].end() &&
+         squashIt[tid] != InstIt() &&
          (*squashIt[tid])->seqNum > squashedSeqNum[tid];
          ++numSquashed)
     {
@@ -358,7 +370,7 @@ ROB::doSquash(ThreadID tid)
             DPRINTF(ROB, "Reached head of instruction list while "
                     "squashing.\n");
 
-            squashIt[tid] = instList[tid].end();
+            squashIt[tid] = InstIt();
 
             doneSquashing[tid] = true;
 
@@ -380,7 +392,7 @@ ROB::doSquash(ThreadID tid)
         DPRINTF(ROB, "[tid:%i] Done squashing instructions.\n",
                 tid);
 
-        squashIt[tid] = instList[tid].end();
+        squashIt[tid] = InstIt();
 
         doneSquashing[tid] = true;
     }
@@ -427,7 +439,7 @@ ROB::updateHead()
     }
 
     if (first_valid) {
-        head = instList[0].end();
+        head = InstIt();
     }
 
 }
@@ -435,7 +447,7 @@ ROB::updateHead()
 void
 ROB::updateTail()
 {
-    tail = instList[0].end();
+    tail = InstIt();
     bool first_valid = true;
 
     std::list<ThreadID>::iterator threads = activeThreads->begin();
@@ -45,6 +45,7 @@
 #include <utility>
 #include <vector>
 
+#include "base/circular_queue.hh"
 #include "base/statistics.hh"
 #include "base/types.hh"
 #include "cpu/inst_seq.hh"
@@ -72,7 +73,7 @@ class ROB
 {
   public:
     typedef std::pair<RegIndex, RegIndex> UnmapInfo;
-    typedef typename std::list<DynInstPtr>::iterator InstIt;
+    typedef typename CircularQueue<DynInstPtr>::iterator InstIt;
 
     /** Possible ROB statuses. */
     enum Status
@@ -162,6 +163,11 @@ class ROB
     /** Is there any commitable head instruction across all threads ready. */
     bool canCommit();
 
+    /** Records the reads commit would have made while the CPU skipped
+     *  stalled cycles, checking every cycle whether the head is ready.
+     */
+    void profileSkippedCycles(Cycles cycles);
+
     /** Re-adjust ROB partitioning. */
     void resetEntries();
 
@@ -285,8 +291,10 @@ class ROB
     /** Max Insts a Thread Can Have in the ROB */
     unsigned maxEntries[MaxThreads];
 
-    /** ROB List of Instructions */
-    std::list<DynInstPtr> instList[MaxThreads];
+    /** ROB List of Instructions, one fixed-capacity ring per thread sized
+     *  to the whole ROB so that inserting an instruction never allocates.
+     */
+    std::vector<CircularQueue<DynInstPtr>> instList;
 
     /** Number of instructions that can be squashed in a single cycle. */
     unsigned squashWidth;
@@ -308,7 +316,8 @@ class ROB
      *  when squashing, the instructions are marked as squashed but not
      *  immediately removed, meaning the tail iterator remains the same before
      *  and after a squash.
-     *  This will always be set to cpu->instList.end() if it is invalid.
+     *  This will always be set to a default constructed InstIt if it is
+     *  invalid, as the end of a circular queue moves when it is filled.
      */
     InstIt squashIt[MaxThreads];
 
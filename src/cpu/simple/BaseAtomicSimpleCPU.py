@@ -61,6 +61,16 @@ class BaseAtomicSimpleCPU(BaseSimpleCPU):
     width = Param.Int(1, "CPU width")
     simulate_data_stalls = Param.Bool(False, "Simulate dcache stall cycles")
     simulate_inst_stalls = Param.Bool(False, "Simulate icache stall cycles")
+    fetch_block_cache = Param.Bool(
+        False,
+        "Keep decoded instructions by the cache line they were fetched from "
+        "and execute them again without fetching and decoding them. Speeds "
+        "up fast-forwarding, but the instruction cache does not see the "
+        "fetches of cached instructions.",
+    )
+    fetch_block_cache_size = Param.Unsigned(
+        4096, "Number of lines the fetch block cache holds before a flush"
+    )
 
     def addSimPointProbe(self, interval):
         simpoint = SimPoint()
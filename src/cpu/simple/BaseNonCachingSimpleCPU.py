@@ -52,6 +52,18 @@ class BaseNonCachingSimpleCPU(BaseAtomicSimpleCPU):
 
     numThreads = 1
 
+    direct_data_access = Param.Bool(
+        False,
+        "Do plain loads and stores to memory that offers a backdoor "
+        "straight on host memory, using a small cache of translations "
+        "from virtual addresses to host memory. The memory system does "
+        "not see these accesses, e.g., in its statistics, nor do other "
+        "CPUs, so this requires a system with a single CPU.",
+    )
+    direct_data_access_entries = Param.Unsigned(
+        64, "Number of host translations kept for direct data accesses"
+    )
+
     @classmethod
     def memory_mode(cls):
         return "atomic_noncaching"
@@ -78,16 +78,37 @@ AtomicSimpleCPU::AtomicSimpleCPU(const BaseAtomicSimpleCPUParams &p)
       width(p.width), locked(false),
       simulate_data_stalls(p.simulate_data_stalls),
       simulate_inst_stalls(p.simulate_inst_stalls),
+      fetchBlockCacheable(false),
       icachePort(name() + ".icache_port"),
       dcachePort(name() + ".dcache_port", this),
       dcache_access(false), dcache_latency(0),
       ppCommit(nullptr)
 {
     _status = Idle;
-    ifetch_req = std::make_shared<Request>();
-    data_read_req = std::make_shared<Request>();
-    data_write_req = std::make_shared<Request>();
-    data_amo_req = std::make_shared<Request>();
+    ifetch_req = Request::create();
+    data_read_req = Request::create();
+    data_write_req = Request::create();
+    data_amo_req = Request::create();
+
+    if (p.fetch_block_cache) {
+        fetchBlockCaches.reserve(numThreads);
+        for (ThreadID tid = 0; tid < numThreads; tid++) {
+            fetchBlockCaches.emplace_back(cacheLineSize(),
+                                          p.fetch_block_cache_size);
+        }
+        fetchBlockStats = std::make_unique<FetchBlockStats>(this);
+    }
+}
+
+AtomicSimpleCPU::FetchBlockStats::FetchBlockStats(statistics::Group *parent)
+    : statistics::Group(parent, "fetchBlockCache"),
+      ADD_STAT(hits, statistics::units::Count::get(),
+               "Number of instructions found in the fetch block cache"),
+      ADD_STAT(misses, statistics::units::Count::get(),
+               "Number of instructions fetched and decoded"),
+      ADD_STAT(flushes, statistics::units::Count::get(),
+               "Number of flushes of the fetch block cache")
+{
 }
 
 
@@ -148,6 +169,10 @@ AtomicSimpleCPU::drainResume()
     DPRINTF(SimpleCPU, "Resume\n");
     verifyMemoryMode();
 
+    // Anything may have changed while the system was drained, e.g., a
+    // checkpoint may have been restored.
+    flushCachedState();
+
     assert(!threadContexts.empty());
 
     _status = BaseSimpleCPU::Idle;
@@ -223,6 +248,9 @@ AtomicSimpleCPU::activateContext(ThreadID thread_num)
 
     assert(thread_num < numThreads);
 
+    if (!fetchBlockCaches.empty())
+        fetchBlockCaches[thread_num].invalidateTranslation();
+
     threadInfo[thread_num]->execContextStats.notIdleFraction = 1;
     Cycles delta = ticksToCycles(threadInfo[thread_num]->thread->lastActivate -
                                  threadInfo[thread_num]->thread->lastSuspend);
@@ -298,6 +326,7 @@ AtomicSimpleCPU::AtomicCPUDPort::recvAtomicSnoop(PacketPtr pkt)
             t_info->thread->getIsaPtr()->handleLockedSnoop(pkt,
                     cacheBlockMask);
         }
+        cpu->invalidateFetchBlocks(pkt->getAddr(), pkt->getSize());
     }
 
     return 0;
@@ -325,6 +354,9 @@ AtomicSimpleCPU::AtomicCPUDPort::recvFunctionalSnoop(PacketPtr pkt)
                     cacheBlockMask);
         }
     }
+
+    if (pkt->isInvalidate() || pkt->isWrite())
+        cpu->invalidateFetchBlocks(pkt->getAddr(), pkt->getSize());
 }
 
 bool
@@ -507,6 +539,7 @@ AtomicSimpleCPU::writeMem(uint8_t *data, unsigned size, Addr addr,
                 dcache_access = true;
                 panic_if(pkt.isError(), "Data write (%s) failed: %s",
                         pkt.getAddrRange().to_string(), pkt.print());
+                invalidateFetchBlocks(req->getPaddr(), req->getSize());
                 if (req->isSwap()) {
                     assert(res && curr_frag_id == 0);
                     memcpy(res, pkt.getConstPtr<uint8_t>(), size);
@@ -597,6 +630,7 @@ AtomicSimpleCPU::amoMem(Addr addr, uint8_t* data, unsigned size,
         panic_if(pkt.isError(), "Atomic access (%s) failed: %s",
                 pkt.getAddrRange().to_string(), pkt.print());
         assert(!req->isLLSC());
+        invalidateFetchBlocks(req->getPaddr(), req->getSize());
     }
 
     if (fault != NoFault && req->isPrefetch()) {
@@ -623,6 +657,9 @@ AtomicSimpleCPU::tick()
         data_read_req->setContext(cid);
         data_write_req->setContext(cid);
         data_amo_req->setContext(cid);
+
+        // The instruction being fetched may be another thread's.
+        fetchBlockCacheable = false;
     }
 
     SimpleExecContext &t_info = *threadInfo[curThread];
@@ -635,7 +672,8 @@ AtomicSimpleCPU::tick()
         updateCycleCounters(BaseCPU::CPU_STATE_ON);
 
         if (!curStaticInst || !curStaticInst->isDelayedCommit()) {
-            checkForInterrupts();
+            if (checkForInterrupts())
+                flushCachedState();
             checkPcEventQueue();
         }
 
@@ -652,11 +690,18 @@ AtomicSimpleCPU::tick()
         const PCStateBase &pc = thread->pcState();
 
         bool needToFetch = !isRomMicroPC(pc.microPC()) && !curMacroStaticInst;
+        const FetchBlockCache::Entry *fetch_block = nullptr;
+        if (needToFetch && !fetchBlockCaches.empty()) {
+            fetch_block = lookupFetchBlock();
+            needToFetch = !fetch_block;
+        }
         if (needToFetch) {
             ifetch_req->taskId(taskId());
             setupFetchRequest(ifetch_req);
             fault = thread->mmu->translateAtomic(ifetch_req, thread->getTC(),
                                                  BaseMMU::Execute);
+            if (fault == NoFault && !fetchBlockCaches.empty())
+                recordFetchTranslation();
         }
 
         if (fault == NoFault) {
@@ -677,7 +722,20 @@ AtomicSimpleCPU::tick()
                 //}
             }
 
-            preExecute();
+            if (fetch_block) {
+                thread->pcState(*fetch_block->decodedPC);
+                preExecute(fetch_block->inst);
+            } else {
+                preExecute();
+                if (needToFetch && fetchBlockCacheable && !t_info.stayAtPC &&
+                        curStaticInst) {
+                    // The decoder is done with the instruction, keep it.
+                    fetchBlockCaches[curThread].insert(*fetchBlockPC,
+                            thread->pcState(), curMacroStaticInst ?
+                            curMacroStaticInst : curStaticInst);
+                    fetchBlockCacheable = false;
+                }
+            }
 
             Tick stall_ticks = 0;
             if (curStaticInst) {
@@ -700,6 +758,17 @@ AtomicSimpleCPU::tick()
                 }
 
                 postExecute();
+
+                // Instructions that may change the mode of the decoder or
+                // the translations are the ones that the out-of-order
+                // CPUs also refetch after.
+                if (curStaticInst->isSerializing() ||
+                        curStaticInst->isSerializeAfter() ||
+                        curStaticInst->isSquashAfter() ||
+                        curStaticInst->isNonSpeculative() ||
+                        curStaticInst->isSyscall()) {
+                    flushCachedState();
+                }
             }
 
             // @todo remove me after debugging with legion done
@@ -723,6 +792,11 @@ AtomicSimpleCPU::tick()
             }
 
         }
+        if (fault != NoFault) {
+            // Taking the fault may change the mode of the decoder or the
+            // translations.
+            flushCachedState();
+        }
         if (fault != NoFault || !t_info.stayAtPC)
             advancePC(fault);
     }
@@ -738,6 +812,76 @@ AtomicSimpleCPU::tick()
         reschedule(tickEvent, curTick() + latency, true);
 }
 
+const FetchBlockCache::Entry *
+AtomicSimpleCPU::lookupFetchBlock()
+{
+    SimpleExecContext &t_info = *threadInfo[curThread];
+    const PCStateBase &pc = t_info.thread->pcState();
+    FetchBlockCache &fetch_blocks = fetchBlockCaches[curThread];
+
+    // Instructions are only cached as a whole.
+    if (t_info.fetchOffset != 0)
+        return nullptr;
+
+    const FetchBlockCache::Entry *entry = nullptr;
+    if (fetch_blocks.translated(pc.instAddr()))
+        entry = fetch_blocks.lookup(pc);
+
+    if (entry)
+        fetchBlockStats->hits++;
+    else
+        fetchBlockStats->misses++;
+    return entry;
+}
+
+void
+AtomicSimpleCPU::recordFetchTranslation()
+{
+    SimpleExecContext &t_info = *threadInfo[curThread];
+    SimpleThread *thread = t_info.thread;
+    FetchBlockCache &fetch_blocks = fetchBlockCaches[curThread];
+
+    const Addr vaddr = ifetch_req->getVaddr();
+    const Addr paddr = ifetch_req->getPaddr();
+    if (t_info.fetchOffset == 0) {
+        // The decoder did not see the instructions found in the cache, so
+        // let it start the new one from scratch.
+        thread->decoder->reset();
+        set(fetchBlockPC, thread->pcState());
+
+        fetchBlockCacheable = !ifetch_req->isUncacheable() &&
+            !ifetch_req->isLocalAccess();
+        if (fetchBlockCacheable)
+            fetch_blocks.setTranslation(vaddr, paddr);
+        else
+            fetch_blocks.invalidateTranslation();
+    } else {
+        // All of the instruction has to come from the line it starts in.
+        fetchBlockCacheable = fetchBlockCacheable &&
+            fetch_blocks.translated(vaddr) &&
+            fetch_blocks.translate(vaddr) == paddr;
+    }
+}
+
+void
+AtomicSimpleCPU::flushCachedState()
+{
+    if (fetchBlockCaches.empty())
+        return;
+
+    for (auto &fetch_blocks : fetchBlockCaches)
+        fetch_blocks.flush();
+    fetchBlockCacheable = false;
+    fetchBlockStats->flushes++;
+}
+
+void
+AtomicSimpleCPU::invalidateFetchBlocks(Addr paddr, Addr size)
+{
+    for (auto &fetch_blocks : fetchBlockCaches)
+        fetch_blocks.invalidate(paddr, size);
+}
+
 Tick
 AtomicSimpleCPU::fetchInstMem()
 {
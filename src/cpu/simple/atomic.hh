@@ -43,6 +43,7 @@
 
 #include "cpu/simple/base.hh"
 #include "cpu/simple/exec_context.hh"
+#include "cpu/simple/fetch_block_cache.hh"
 #include "mem/request.hh"
 #include "params/BaseAtomicSimpleCPU.hh"
 #include "sim/probe/probe.hh"
@@ -106,6 +107,57 @@ class AtomicSimpleCPU : public BaseSimpleCPU
     virtual Tick sendPacket(RequestPort &port, const PacketPtr &pkt);
     virtual Tick fetchInstMem();
 
+    /**
+     * The instructions decoded by each thread, see FetchBlockCache. Empty
+     * if the CPU does not cache decoded instructions.
+     */
+    std::vector<FetchBlockCache> fetchBlockCaches;
+
+    /** The PC state the instruction being fetched is decoded with. */
+    std::unique_ptr<PCStateBase> fetchBlockPC;
+
+    /**
+     * Can the instruction being fetched be added to the fetch block
+     * cache, i.e., does all of it come from the line it starts in?
+     */
+    bool fetchBlockCacheable;
+
+    struct FetchBlockStats : public statistics::Group
+    {
+        FetchBlockStats(statistics::Group *parent);
+
+        /** Instructions found in the fetch block cache. */
+        statistics::Scalar hits;
+        /** Instructions fetched and decoded. */
+        statistics::Scalar misses;
+        /** Flushes of the fetch block cache. */
+        statistics::Scalar flushes;
+    };
+
+    std::unique_ptr<FetchBlockStats> fetchBlockStats;
+
+    /**
+     * Look the instruction at the PC of the current thread up in the
+     * fetch block cache.
+     */
+    const FetchBlockCache::Entry *lookupFetchBlock();
+
+    /**
+     * Note the translation of an instruction fetch, which tells where in
+     * the fetch block cache the instruction goes.
+     */
+    void recordFetchTranslation();
+
+    /**
+     * Drop what the CPU derived from the translations and the mode of the
+     * decoder, e.g., the instructions in the fetch block caches, as they
+     * may have changed.
+     */
+    virtual void flushCachedState();
+
+    /** Drop the instructions decoded from a range of memory. */
+    void invalidateFetchBlocks(Addr paddr, Addr size);
+
     /**
      * An AtomicCPUPort overrides the default behaviour of the
      * recvAtomicSnoop and ignores the packet instead of panicking. It
@@ -141,7 +193,7 @@ class AtomicSimpleCPU : public BaseSimpleCPU
     {
 
       public:
-        AtomicCPUDPort(const std::string &_name, BaseSimpleCPU *_cpu)
+        AtomicCPUDPort(const std::string &_name, AtomicSimpleCPU *_cpu)
             : AtomicCPUPort(_name), cpu(_cpu)
         {
             cacheBlockMask = ~(cpu->cacheLineSize() - 1);
@@ -151,7 +203,7 @@ class AtomicSimpleCPU : public BaseSimpleCPU
 
         Addr cacheBlockMask;
       protected:
-        BaseSimpleCPU *cpu;
+        AtomicSimpleCPU *cpu;
 
         virtual Tick recvAtomicSnoop(PacketPtr pkt);
         virtual void recvFunctionalSnoop(PacketPtr pkt);
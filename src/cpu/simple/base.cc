@@ -269,7 +269,7 @@ BaseSimpleCPU::traceFault()
     }
 }
 
-void
+bool
 BaseSimpleCPU::checkForInterrupts()
 {
     SimpleExecContext&t_info = *threadInfo[curThread];
@@ -288,15 +288,18 @@ BaseSimpleCPU::checkForInterrupts()
                 DPRINTF(HtmCpu, "Deferring pending interrupt - %s -"
                     "due to transactional state\n",
                     interrupt->name());
-                return;
+                return false;
             }
 
             t_info.fetchOffset = 0;
             interrupts[curThread]->updateIntrInfo();
             interrupt->invoke(tc);
             thread->decoder->reset();
+            return true;
         }
     }
+
+    return false;
 }
 
 
@@ -325,7 +328,7 @@ BaseSimpleCPU::serviceInstCountEvents()
 }
 
 void
-BaseSimpleCPU::preExecute()
+BaseSimpleCPU::preExecute(const StaticInstPtr &decoded)
 {
     SimpleExecContext &t_info = *threadInfo[curThread];
     SimpleThread* thread = t_info.thread;
@@ -344,6 +347,18 @@ BaseSimpleCPU::preExecute()
         t_info.stayAtPC = false;
         curStaticInst = decoder->fetchRomMicroop(
                 pc_state.microPC(), curMacroStaticInst);
+    } else if (decoded) {
+        // The CPU already knows the instruction, e.g., from an earlier
+        // decode of the same code.
+        assert(!curMacroStaticInst);
+        t_info.stayAtPC = false;
+        if (decoded->isMacroop()) {
+            curMacroStaticInst = decoded;
+            curStaticInst =
+                curMacroStaticInst->fetchMicroop(pc_state.microPC());
+        } else {
+            curStaticInst = decoded;
+        }
     } else if (!curMacroStaticInst) {
         //We're not in the middle of a macro instruction
         StaticInstPtr instPtr = NULL;
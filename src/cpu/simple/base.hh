@@ -133,10 +133,21 @@ class BaseSimpleCPU : public BaseCPU
     std::unique_ptr<PCStateBase> preExecuteTempPC;
 
   public:
-    void checkForInterrupts();
+    /** @return true if an interrupt was taken. */
+    bool checkForInterrupts();
     void setupFetchRequest(const RequestPtr &req);
     void serviceInstCountEvents();
-    void preExecute();
+
+    /**
+     * Decode the instruction at the current PC, or get the next microop,
+     * and prepare executing it.
+     *
+     * @param decoded The instruction at the current PC if the CPU already
+     *        knows it, which bypasses the decoder. The PC state must
+     *        already be the one the decoder would have produced.
+     */
+    void preExecute(const StaticInstPtr &decoded=
+                    StaticInst::nullStaticInstPtr);
     void postExecute();
     void advancePC(const Fault &fault);
 
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/simple/fetch_block_cache.hh"
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+namespace gem5
+{
+
+FetchBlockCache::FetchBlockCache(Addr line_size, size_t max_blocks)
+    : lineSize(line_size), lineMask(~(line_size - 1)),
+      maxBlocks(max_blocks)
+{
+    fatal_if(!isPowerOf2(line_size),
+             "The fetch block size (%d) must be a power of two.", line_size);
+    fatal_if(max_blocks == 0, "The fetch block cache must hold blocks.");
+}
+
+void
+FetchBlockCache::setTranslation(Addr vaddr, Addr paddr)
+{
+    const Addr line = paddr & lineMask;
+    auto it = blocks.find(line);
+    if (it == blocks.end()) {
+        if (blocks.size() >= maxBlocks)
+            flush();
+        it = blocks.try_emplace(line, lineSize).first;
+    }
+
+    curBlock = &it->second;
+    curVaddr = vaddr & lineMask;
+    curPaddr = line;
+}
+
+void
+FetchBlockCache::insert(const PCStateBase &pc, const PCStateBase &decoded_pc,
+                        const StaticInstPtr &inst)
+{
+    if (!translated(pc.instAddr()))
+        return;
+
+    Entry &entry = curBlock->entries[translate(pc.instAddr()) & ~lineMask];
+    set(entry.pc, pc);
+    set(entry.decodedPC, decoded_pc);
+    entry.inst = inst;
+}
+
+void
+FetchBlockCache::invalidateBlocks(Addr paddr, Addr size)
+{
+    const Addr end = paddr + size;
+    for (Addr line = paddr & lineMask; line < end; line += lineSize) {
+        auto it = blocks.find(line);
+        if (it == blocks.end())
+            continue;
+        if (&it->second == curBlock)
+            curBlock = nullptr;
+        blocks.erase(it);
+    }
+}
+
+void
+FetchBlockCache::flush()
+{
+    blocks.clear();
+    curBlock = nullptr;
+}
+
+} // namespace gem5
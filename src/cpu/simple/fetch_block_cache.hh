@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_SIMPLE_FETCH_BLOCK_CACHE_HH__
+#define __CPU_SIMPLE_FETCH_BLOCK_CACHE_HH__
+
+#include <cassert>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "arch/generic/pcstate.hh"
+#include "base/types.hh"
+#include "cpu/static_inst.hh"
+
+namespace gem5
+{
+
+/**
+ * A cache of the instructions decoded by a simple CPU, which lets it
+ * execute code again without fetching it from memory or running it
+ * through the decoder.
+ *
+ * The instructions are grouped in blocks by the cache line they were
+ * fetched from. Blocks are indexed by the physical address of the line,
+ * so that writes to the code, whether done by the CPU itself or snooped
+ * from elsewhere, invalidate them. The cache also holds the translation
+ * of the line the CPU currently executes from: as long as the CPU stays
+ * in that line, neither the MMU nor the index are consulted, and the
+ * cost of an instruction is a comparison of its PC state.
+ *
+ * The outcome of decoding depends on more than the bytes in memory and
+ * the PC state, e.g., on the mode of the decoder, and translations
+ * change when the page tables or the TLBs do. The CPU is responsible for
+ * invalidating the translation and flushing the cache whenever they may
+ * have changed.
+ */
+class FetchBlockCache
+{
+  public:
+    struct Entry
+    {
+        /** The PC state the instruction was decoded with. */
+        std::unique_ptr<PCStateBase> pc;
+        /** The PC state the decoder produced. */
+        std::unique_ptr<PCStateBase> decodedPC;
+        /** The decoded (macro) instruction. */
+        StaticInstPtr inst;
+    };
+
+  protected:
+    struct Block
+    {
+        Block(Addr line_size) : entries(line_size) {}
+
+        /** The instructions of the line, by their offset in it. */
+        std::vector<Entry> entries;
+    };
+
+    const Addr lineSize;
+    const Addr lineMask;
+    const size_t maxBlocks;
+
+    std::unordered_map<Addr, Block> blocks;
+
+    /** The block the CPU executes from, if its translation is known. */
+    Block *curBlock = nullptr;
+    Addr curVaddr = 0;
+    Addr curPaddr = 0;
+
+  public:
+    /**
+     * @param line_size The size of the blocks, a power of two no larger
+     *        than the smallest page size.
+     * @param max_blocks The number of blocks above which the cache is
+     *        flushed.
+     */
+    FetchBlockCache(Addr line_size, size_t max_blocks);
+
+    /** Is the translation of the line holding an address known? */
+    bool
+    translated(Addr vaddr) const
+    {
+        return curBlock && (vaddr & lineMask) == curVaddr;
+    }
+
+    /** Translate an address in the line the CPU executes from. */
+    Addr
+    translate(Addr vaddr) const
+    {
+        assert(translated(vaddr));
+        return curPaddr | (vaddr & ~lineMask);
+    }
+
+    /**
+     * Record the translation of the line the CPU executes from.
+     *
+     * @param vaddr A virtual address in the line.
+     * @param paddr The physical address vaddr translates to.
+     */
+    void setTranslation(Addr vaddr, Addr paddr);
+
+    /** Forget the translation of the line the CPU executes from. */
+    void invalidateTranslation() { curBlock = nullptr; }
+
+    /**
+     * Look the instruction at a PC up. The translation of the PC must be
+     * known.
+     *
+     * @return The instruction if it was decoded with the same PC state,
+     *         nullptr otherwise.
+     */
+    const Entry *
+    lookup(const PCStateBase &pc) const
+    {
+        const Entry &entry = curBlock->entries[translate(pc.instAddr()) &
+                                               ~lineMask];
+        if (entry.inst && *entry.pc == pc)
+            return &entry;
+        return nullptr;
+    }
+
+    /**
+     * Add a decoded instruction fetched from the line the CPU executes
+     * from. The instruction is ignored if the translation of the line was
+     * dropped since, e.g., as the line was written to.
+     *
+     * @param pc The PC state the instruction was decoded with.
+     * @param decoded_pc The PC state the decoder produced.
+     * @param inst The decoded instruction.
+     */
+    void insert(const PCStateBase &pc, const PCStateBase &decoded_pc,
+                const StaticInstPtr &inst);
+
+    /** Drop the blocks of the lines that overlap a range of memory. */
+    void
+    invalidate(Addr paddr, Addr size)
+    {
+        if (!blocks.empty())
+            invalidateBlocks(paddr, size);
+    }
+
+    /** Drop all blocks and the translation. */
+    void flush();
+
+  protected:
+    void invalidateBlocks(Addr paddr, Addr size);
+};
+
+} // namespace gem5
+
+#endif // __CPU_SIMPLE_FETCH_BLOCK_CACHE_HH__
@@ -40,6 +40,9 @@
 #include <cassert>
 
 #include "arch/generic/decoder.hh"
+#include "base/intmath.hh"
+#include "cpu/exetrace.hh"
+#include "params/BaseNonCachingSimpleCPU.hh"
 
 namespace gem5
 {
@@ -51,6 +54,36 @@ NonCachingSimpleCPU::NonCachingSimpleCPU(
     assert(p.numThreads == 1);
     fatal_if(!FullSystem && p.workload.size() != 1,
              "only one workload allowed");
+
+    if (p.direct_data_access) {
+        fatal_if(!isPowerOf2(p.direct_data_access_entries),
+                 "The number of direct access translations must be a power "
+                 "of two.");
+        directReads.resize(p.direct_data_access_entries);
+        directWrites.resize(p.direct_data_access_entries);
+        directStats = std::make_unique<DirectAccessStats>(this);
+    }
+}
+
+NonCachingSimpleCPU::DirectAccessStats::DirectAccessStats(
+        statistics::Group *parent)
+    : statistics::Group(parent, "directAccess"),
+      ADD_STAT(hits, statistics::units::Count::get(),
+               "Number of loads and stores done straight on host memory"),
+      ADD_STAT(misses, statistics::units::Count::get(),
+               "Number of loads and stores done through the memory system")
+{
+}
+
+void
+NonCachingSimpleCPU::startup()
+{
+    AtomicSimpleCPU::startup();
+
+    // Direct stores are not snooped, so other CPUs would miss them, e.g.,
+    // to clear their locks, wake up from MWAIT or refetch instructions.
+    fatal_if(!directWrites.empty() && system->threads.size() > 1,
+             "Direct data accesses are only supported with a single CPU.");
 }
 
 void
@@ -73,6 +106,8 @@ NonCachingSimpleCPU::sendPacket(RequestPort &port, const PacketPtr &pkt)
     if (bd && memBackdoors.insert(bd->range(), bd) != memBackdoors.end()) {
         // Install a callback to erase this backdoor if it goes away.
         auto callback = [this](const MemBackdoor &backdoor) {
+                // The host translations may point into the backdoor.
+                flushDirect();
                 for (auto it = memBackdoors.begin();
                         it != memBackdoors.end(); it++) {
                     if (it->second == &backdoor) {
@@ -102,4 +137,130 @@ NonCachingSimpleCPU::fetchInstMem()
     return 0;
 }
 
+void
+NonCachingSimpleCPU::flushCachedState()
+{
+    AtomicSimpleCPU::flushCachedState();
+    flushDirect();
+}
+
+const NonCachingSimpleCPU::DirectEntry *
+NonCachingSimpleCPU::lookupDirect(std::vector<DirectEntry> &entries,
+                                  Addr addr, unsigned size,
+                                  Request::Flags flags,
+                                  const std::vector<bool> &byte_enable)
+{
+    const DirectEntry &entry =
+        entries[(addr / DirectPageBytes) & (entries.size() - 1)];
+
+    // Only plain accesses get translations, so comparing the flags also
+    // rules out, e.g., uncacheable, exclusive or locked accesses.
+    if (!entry.host || entry.flags != flags || size > DirectPageBytes ||
+            addr - entry.vaddr > DirectPageBytes - size ||
+            std::find(byte_enable.begin(), byte_enable.end(), false) !=
+            byte_enable.end()) {
+        directStats->misses++;
+        return nullptr;
+    }
+
+    directStats->hits++;
+    return &entry;
+}
+
+void
+NonCachingSimpleCPU::recordDirect(std::vector<DirectEntry> &entries,
+                                  const RequestPtr &req, Addr addr,
+                                  unsigned size, Request::Flags flags,
+                                  const std::vector<bool> &byte_enable,
+                                  bool write)
+{
+    // Only translate plain accesses, which the MMU did not turn into
+    // anything else and which were done in one go.
+    if (!flags.noneSet(~Request::ARCH_BITS) ||
+            req->getVaddr() != addr || req->getSize() != size ||
+            req->isUncacheable() || req->isStrictlyOrdered() ||
+            req->isLocalAccess() ||
+            req->getFlags().isSet(Request::NO_ACCESS) ||
+            std::find(byte_enable.begin(), byte_enable.end(), false) !=
+            byte_enable.end()) {
+        return;
+    }
+
+    const Addr paddr = req->getPaddr();
+    auto bd_it = memBackdoors.contains(paddr);
+    if (bd_it == memBackdoors.end())
+        return;
+
+    const MemBackdoorPtr bd = bd_it->second;
+    const Addr page = roundDown(paddr, DirectPageBytes);
+    if (!(write ? bd->writeable() : bd->readable()) ||
+            !AddrRange(page, page + DirectPageBytes).isSubset(bd->range())) {
+        return;
+    }
+
+    DirectEntry &entry =
+        entries[(addr / DirectPageBytes) & (entries.size() - 1)];
+    entry.vaddr = addr - (paddr - page);
+    entry.paddr = page;
+    entry.host = bd->ptr() + (page - bd->range().start());
+    entry.flags = flags;
+}
+
+Fault
+NonCachingSimpleCPU::readMem(Addr addr, uint8_t *data, unsigned size,
+                             Request::Flags flags,
+                             const std::vector<bool> &byte_enable)
+{
+    if (directReads.empty())
+        return AtomicSimpleCPU::readMem(addr, data, size, flags, byte_enable);
+
+    if (auto *entry = lookupDirect(directReads, addr, size, flags,
+                                   byte_enable)) {
+        if (traceData)
+            traceData->setMem(addr, size, flags);
+        memcpy(data, entry->host + (addr - entry->vaddr), size);
+        dcache_latency = 0;
+        dcache_access = true;
+        return NoFault;
+    }
+
+    Fault fault = AtomicSimpleCPU::readMem(addr, data, size, flags,
+                                           byte_enable);
+    if (fault == NoFault) {
+        recordDirect(directReads, data_read_req, addr, size, flags,
+                     byte_enable, false);
+    }
+    return fault;
+}
+
+Fault
+NonCachingSimpleCPU::writeMem(uint8_t *data, unsigned size, Addr addr,
+                              Request::Flags flags, uint64_t *res,
+                              const std::vector<bool> &byte_enable)
+{
+    if (directWrites.empty() || res) {
+        return AtomicSimpleCPU::writeMem(data, size, addr, flags, res,
+                                         byte_enable);
+    }
+
+    if (auto *entry = lookupDirect(directWrites, addr, size, flags,
+                                   byte_enable)) {
+        if (traceData)
+            traceData->setMem(addr, size, flags);
+        memcpy(entry->host + (addr - entry->vaddr), data, size);
+        invalidateFetchBlocks(entry->paddr + (addr - entry->vaddr), size);
+        dcache_latency = 0;
+        dcache_access = true;
+        return NoFault;
+    }
+
+    Fault fault = AtomicSimpleCPU::writeMem(data, size, addr, flags, res,
+                                            byte_enable);
+    if (fault == NoFault) {
+        recordDirect(directWrites, data_write_req, addr, size, flags,
+                     byte_enable, true);
+    }
+    return fault;
+}
+
 } // namespace gem5
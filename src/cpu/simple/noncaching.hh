@@ -38,6 +38,10 @@
 #ifndef __CPU_SIMPLE_NONCACHING_HH__
 #define __CPU_SIMPLE_NONCACHING_HH__
 
+#include <algorithm>
+#include <memory>
+#include <vector>
+
 #include "base/addr_range_map.hh"
 #include "cpu/simple/atomic.hh"
 #include "mem/backdoor.hh"
@@ -55,13 +59,96 @@ class NonCachingSimpleCPU : public AtomicSimpleCPU
   public:
     NonCachingSimpleCPU(const BaseNonCachingSimpleCPUParams &p);
 
+    void startup() override;
     void verifyMemoryMode() const override;
 
+    Fault readMem(Addr addr, uint8_t *data, unsigned size,
+                  Request::Flags flags,
+                  const std::vector<bool> &byte_enable=std::vector<bool>())
+        override;
+
+    Fault writeMem(uint8_t *data, unsigned size,
+                   Addr addr, Request::Flags flags, uint64_t *res,
+                   const std::vector<bool> &byte_enable=std::vector<bool>())
+        override;
+
   protected:
     AddrRangeMap<MemBackdoorPtr, 1> memBackdoors;
 
     Tick sendPacket(RequestPort &port, const PacketPtr &pkt) override;
     Tick fetchInstMem() override;
+
+    void flushCachedState() override;
+
+    /**
+     * The size of the ranges direct accesses translate at once, which is
+     * no larger than the smallest page of any ISA.
+     */
+    static constexpr Addr DirectPageBytes = 4096;
+
+    /**
+     * A translation to host memory of the virtual addresses accessed with
+     * a set of request flags. It holds for the range of addresses that
+     * maps to one DirectPageBytes sized, aligned range of memory with a
+     * backdoor. The range itself need not be aligned, e.g., due to
+     * segmentation.
+     */
+    struct DirectEntry
+    {
+        /** The first virtual address of the range. */
+        Addr vaddr = 0;
+        /** The physical address vaddr translates to. */
+        Addr paddr = 0;
+        /** The host address vaddr translates to, nullptr if invalid. */
+        uint8_t *host = nullptr;
+        Request::FlagsType flags = 0;
+    };
+
+    /**
+     * Host translations for loads and stores, indexed by virtual page.
+     * Empty if direct accesses are disabled.
+     */
+    std::vector<DirectEntry> directReads;
+    std::vector<DirectEntry> directWrites;
+
+    struct DirectAccessStats : public statistics::Group
+    {
+        DirectAccessStats(statistics::Group *parent);
+
+        /** Accesses done straight on host memory. */
+        statistics::Scalar hits;
+        /** Accesses done through the memory system. */
+        statistics::Scalar misses;
+    };
+
+    std::unique_ptr<DirectAccessStats> directStats;
+
+    /**
+     * Find the host translation of an access.
+     *
+     * @return The translation, or nullptr if the access has to go through
+     *         the memory system.
+     */
+    const DirectEntry *lookupDirect(std::vector<DirectEntry> &entries,
+                                    Addr addr, unsigned size,
+                                    Request::Flags flags,
+                                    const std::vector<bool> &byte_enable);
+
+    /**
+     * Record the translation of an access done through the memory system
+     * if later accesses can go straight to host memory.
+     */
+    void recordDirect(std::vector<DirectEntry> &entries,
+                      const RequestPtr &req, Addr addr, unsigned size,
+                      Request::Flags flags,
+                      const std::vector<bool> &byte_enable, bool write);
+
+    void
+    flushDirect()
+    {
+        std::fill(directReads.begin(), directReads.end(), DirectEntry());
+        std::fill(directWrites.begin(), directWrites.end(), DirectEntry());
+    }
 };
 
 } // namespace gem5
@@ -39,8 +39,15 @@ class ThreadBridge(SimObject):
     the issue. The receiver side is expected to use the same EventQueue that
     the ThreadBridge is using.
 
-    Given that this is only used for simulation speed accelerating, only the
-    atomic and functional access are supported.
+    Atomic and functional accesses are forwarded immediately. Timing
+    requests and responses are instead handed over to the other side's
+    event queue and delivered after a fixed delay, which is also declared
+    as the lookahead between the two queues for conservative parallel
+    simulation (see Root.lookahead_sync). Bridging two different queues
+    therefore needs a non-zero delay, which must also be at least
+    Root.sim_quantum unless lookahead synchronization is used. The objects
+    sending requests to the bridge must be on the event queue given by
+    initiator_eventq_index.
 
     Example:
 
@@ -58,3 +65,10 @@ class ThreadBridge(SimObject):
 
     in_port = ResponsePort("Incoming port")
     out_port = RequestPort("Outgoing port")
+
+    initiator_eventq_index = Param.UInt32(
+        0, "Event queue of the objects connected to in_port"
+    )
+    delay = Param.Latency(
+        "0ns", "Delay of timing requests and responses crossing the bridge"
+    )
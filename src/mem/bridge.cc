@@ -46,6 +46,7 @@
 
 #include "mem/bridge.hh"
 
+#include "base/logging.hh"
 #include "base/trace.hh"
 #include "debug/Bridge.hh"
 #include "params/Bridge.hh"
@@ -109,6 +110,15 @@ Bridge::init()
     cpuSidePort.sendRangeChange();
 }
 
+void
+Bridge::checkEventQueue() const
+{
+    fatal_if(curEventQueue() != eventQueue(), "%s: Timing packet received "
+             "from %s, but the bridge is on %s. Connect objects on other "
+             "event queues through a ThreadBridge.", name(),
+             curEventQueue()->name(), eventQueue()->name());
+}
+
 bool
 Bridge::BridgeResponsePort::respQueueFull() const
 {
@@ -129,6 +139,8 @@ Bridge::BridgeRequestPort::recvTimingResp(PacketPtr pkt)
     DPRINTF(Bridge, "recvTimingResp: %s addr 0x%x\n",
             pkt->cmdString(), pkt->getAddr());
 
+    bridge.checkEventQueue();
+
     DPRINTF(Bridge, "Request queue size: %d\n", transmitList.size());
 
     // technically the packet only reaches us after the header delay,
@@ -149,6 +161,8 @@ Bridge::BridgeResponsePort::recvTimingReq(PacketPtr pkt)
     DPRINTF(Bridge, "recvTimingReq: %s addr 0x%x\n",
             pkt->cmdString(), pkt->getAddr());
 
+    bridge.checkEventQueue();
+
     panic_if(pkt->cacheResponding(), "Should not see packets where cache "
              "is responding");
 
@@ -69,6 +69,9 @@ namespace gem5
  * before forwarding the request. If there is no space present, then
  * the bridge will delay accepting the packet until space becomes
  * available.
+ *
+ * The bridge and the objects on both of its sides must be on the same
+ * event queue; a ThreadBridge connects different event queues.
  */
 class Bridge : public ClockedObject
 {
@@ -328,6 +331,12 @@ class Bridge : public ClockedObject
     /** Request port of the bridge. */
     BridgeRequestPort memSidePort;
 
+    /**
+     * Fail if a timing packet arrives from another event queue, whose
+     * thread would race with the one of the bridge.
+     */
+    void checkEventQueue() const;
+
   public:
 
     Port &getPort(const std::string &if_name,
@@ -496,7 +496,7 @@ MSHR::handleSnoop(PacketPtr pkt, Counter _order)
         // the packet and the request as part of handling the deferred
         // snoop.
         PacketPtr cp_pkt = will_respond ? new Packet(pkt, true, true) :
-            new Packet(std::make_shared<Request>(*pkt->req), pkt->cmd,
+            new Packet(Request::create(*pkt->req), pkt->cmd,
                        blkSize, pkt->id);
 
         if (will_respond) {
@@ -786,7 +786,7 @@ void
 MSHR::updateLockedRMWReadTarget(PacketPtr pkt)
 {
     assert(!targets.empty() && targets.front().pkt == pkt);
-    RequestPtr r = std::make_shared<Request>(*(pkt->req));
+    RequestPtr r = Request::create(*(pkt->req));
     targets.front().pkt = new Packet(r, MemCmd::LockedRMWReadReq);
 }
 
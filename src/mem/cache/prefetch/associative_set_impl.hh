@@ -52,7 +52,8 @@ Entry*
 AssociativeSet<Entry>::findEntry(Addr addr, bool is_secure) const
 {
     Addr tag = indexingPolicy->extractTag(addr);
-    auto candidates = indexingPolicy->getPossibleEntries(addr);
+    const ReplacementCandidates candidates =
+        indexingPolicy->getCandidates(addr);
 
     for (auto candidate : candidates) {
         Entry* entry = static_cast<Entry*>(candidate);
@@ -29,11 +29,15 @@
 #ifndef __MEM_CACHE_REPLACEMENT_POLICIES_REPLACEABLE_ENTRY_HH__
 #define __MEM_CACHE_REPLACEMENT_POLICIES_REPLACEABLE_ENTRY_HH__
 
+#include <cassert>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "base/compiler.hh"
 #include "base/cprintf.hh"
+#include "base/logging.hh"
 
 namespace gem5
 {
@@ -121,6 +125,58 @@ class ReplaceableEntry
     }
 };
 
+/**
+ * Replacement candidates as chosen by the indexing policy. This is a
+ * non-owning view of a contiguous array of entries, so that candidates can
+ * be handed around without allocating. Vectors of entries convert to it
+ * implicitly; the vector must outlive the view.
+ */
+class ReplacementCandidates
+{
+  public:
+    typedef ReplaceableEntry* value_type;
+    typedef ReplaceableEntry* const* iterator;
+    typedef iterator const_iterator;
+
+    ReplacementCandidates() = default;
+
+    ReplacementCandidates(ReplaceableEntry* const* entries, std::size_t size)
+      : _entries(entries), _size(size)
+    {}
+
+    ReplacementCandidates(const std::vector<ReplaceableEntry*>& entries)
+      : _entries(entries.data()), _size(entries.size())
+    {}
+
+    /** A view of a temporary vector would dangle. */
+    ReplacementCandidates(std::vector<ReplaceableEntry*>&& entries) = delete;
+
+    iterator begin() const { return _entries; }
+    iterator end() const { return _entries + _size; }
+
+    std::size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+    ReplaceableEntry*
+    operator[](std::size_t idx) const
+    {
+        assert(idx < _size);
+        return _entries[idx];
+    }
+
+    ReplaceableEntry*
+    at(std::size_t idx) const
+    {
+        panic_if(idx >= _size, "Candidate %d out of range (%d candidates).",
+                 idx, _size);
+        return _entries[idx];
+    }
+
+  private:
+    ReplaceableEntry* const* _entries = nullptr;
+    std::size_t _size = 0;
+};
+
 } // namespace gem5
 
 #endif // __MEM_CACHE_REPLACEMENT_POLICIES_REPLACEABLE_ENTRY_HH_
@@ -85,8 +85,8 @@ BaseTags::findBlock(Addr addr, bool is_secure) const
     Addr tag = extractTag(addr);
 
     // Find possible entries that may contain the given address
-    const std::vector<ReplaceableEntry*> entries =
-        indexingPolicy->getPossibleEntries(addr);
+    const ReplacementCandidates entries =
+        indexingPolicy->getCandidates(addr);
 
     // Search for block
     for (const auto& location : entries) {
@@ -100,6 +100,20 @@ BaseTags::findBlock(Addr addr, bool is_secure) const
     return nullptr;
 }
 
+ReplacementCandidates
+BaseTags::getVictimCandidates(Addr addr, uint64_t partition_id)
+{
+    const ReplacementCandidates entries = indexingPolicy->getCandidates(addr);
+    if (!partitionManager) {
+        return entries;
+    }
+
+    // Filter entries based on PartitionID
+    partitionCandidates.assign(entries.begin(), entries.end());
+    partitionManager->filterByPartition(partitionCandidates, partition_id);
+    return partitionCandidates;
+}
+
 void
 BaseTags::insertBlock(const PacketPtr pkt, CacheBlk *blk)
 {
@@ -105,6 +105,21 @@ class BaseTags : public ClockedObject
     /** The data blocks, 1 per cache block. */
     std::unique_ptr<uint8_t[]> dataBlks;
 
+    /** Scratch space for replacement candidates filtered by partition. */
+    std::vector<ReplaceableEntry*> partitionCandidates;
+
+    /**
+     * Find the possible entries of an address that the given partition
+     * may allocate to. The candidates are only copied if partitioning is
+     * in place. The view is valid until the next lookup.
+     *
+     * @param addr The address to find a victim for.
+     * @param partition_id Partition ID for resource management.
+     * @return The candidates for replacement.
+     */
+    ReplacementCandidates getVictimCandidates(Addr addr,
+                                              uint64_t partition_id);
+
     /**
      * TODO: It would be good if these stats were acquired after warmup.
      */
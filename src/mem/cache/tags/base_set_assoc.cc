@@ -53,7 +53,9 @@ namespace gem5
 {
 
 BaseSetAssoc::BaseSetAssoc(const Params &p)
-    :BaseTags(p), allocAssoc(p.assoc), blks(p.size / p.block_size),
+    :BaseTags(p), assoc(p.assoc), allocAssoc(p.assoc),
+     blks(p.size / p.block_size),
+     tagKeys(blks.size(), TaggedEntry::InvalidKey), waysShareSet(false),
      sequentialAccess(p.sequential_access),
      replacementPolicy(p.replacement_policy)
 {
@@ -69,6 +71,8 @@ BaseSetAssoc::BaseSetAssoc(const Params &p)
 void
 BaseSetAssoc::tagsInit()
 {
+    waysShareSet = indexingPolicy->waysShareSet();
+
     // Initialize all blocks
     for (unsigned blk_index = 0; blk_index < numBlocks; blk_index++) {
         // Locate next cache block
@@ -82,9 +86,37 @@ BaseSetAssoc::tagsInit()
 
         // Associate a replacement data entry to the block
         blk->replacementData = replacementPolicy->instantiateEntry();
+
+        // Keep the block's lookup key up to date in the flat key array
+        blk->mirrorKey(&tagKeys[blk_index]);
     }
 }
 
+CacheBlk*
+BaseSetAssoc::findBlock(Addr addr, bool is_secure) const
+{
+    const Addr key = TaggedEntry::lookupKey(extractTag(addr), is_secure);
+
+    // Blocks are indexed set by set, so the keys of a whole set are
+    // contiguous and can be compared in one go
+    if (waysShareSet) {
+        const uint32_t set = indexingPolicy->getPossibleSet(addr, 0);
+        const uint64_t way = findKey(&tagKeys[set * assoc], assoc, key);
+        return way == assoc ? nullptr :
+            static_cast<CacheBlk*>(indexingPolicy->getEntry(set, way));
+    }
+
+    for (uint32_t way = 0; way < assoc; ++way) {
+        const uint32_t set = indexingPolicy->getPossibleSet(addr, way);
+        if (tagKeys[set * assoc + way] == key) {
+            return static_cast<CacheBlk*>(indexingPolicy->getEntry(set, way));
+        }
+    }
+
+    // Did not find block
+    return nullptr;
+}
+
 void
 BaseSetAssoc::invalidate(CacheBlk *blk)
 {
@@ -76,12 +76,25 @@ namespace gem5
 class BaseSetAssoc : public BaseTags
 {
   protected:
+    /** The associativity of the cache. */
+    const unsigned assoc;
+
     /** The allocatable associativity of the cache (alloc mask). */
     unsigned allocAssoc;
 
     /** The cache blocks. */
     std::vector<CacheBlk> blks;
 
+    /**
+     * The lookup keys (tag, secure and valid bits) of the blocks, laid out
+     * like the blocks, i.e., set by set. Each block mirrors its key here,
+     * so that a lookup only touches one contiguous array.
+     */
+    std::vector<Addr> tagKeys;
+
+    /** Whether the ways of an address are a whole set. */
+    bool waysShareSet;
+
     /** Whether tags and data are accessed sequentially. */
     const bool sequentialAccess;
 
@@ -115,6 +128,16 @@ class BaseSetAssoc : public BaseTags
      */
     void invalidate(CacheBlk *blk) override;
 
+    /**
+     * Find a block by searching the lookup keys of its possible
+     * locations.
+     *
+     * @param addr The address to find.
+     * @param is_secure True if the target memory space is secure.
+     * @return Pointer to the cache block if found.
+     */
+    CacheBlk *findBlock(Addr addr, bool is_secure) const override;
+
     /**
      * Access block and update replacement data. May not succeed, in which case
      * nullptr is returned. This has all the implications of a cache access and
@@ -172,14 +195,9 @@ class BaseSetAssoc : public BaseTags
                          std::vector<CacheBlk*>& evict_blks,
                          const uint64_t partition_id=0) override
     {
-        // Get possible entries to be victimized
-        std::vector<ReplaceableEntry*> entries =
-            indexingPolicy->getPossibleEntries(addr);
-
-        // Filter entries based on PartitionID
-        if (partitionManager) {
-            partitionManager->filterByPartition(entries, partition_id);
-        }
+        // Get possible entries to be victimized, filtered by PartitionID
+        const ReplacementCandidates entries =
+            getVictimCandidates(addr, partition_id);
 
         // Choose replacement victim from replacement candidates
         CacheBlk* victim = entries.empty() ? nullptr :
@@ -254,6 +272,24 @@ class BaseSetAssoc : public BaseTags
         }
         return false;
     }
+
+  private:
+    /**
+     * Find the position of a key in a contiguous array of keys. The loop
+     * deliberately has no early exit and keeps the position as wide as the
+     * keys, so that the compiler can turn it into vector compares.
+     *
+     * @return The position of the key, or num_keys if not found.
+     */
+    static uint64_t
+    findKey(const Addr *keys, uint64_t num_keys, Addr key)
+    {
+        uint64_t match = num_keys;
+        for (uint64_t i = 0; i < num_keys; i++) {
+            match = (keys[i] == key) ? i : match;
+        }
+        return match;
+    }
 };
 
 } // namespace gem5
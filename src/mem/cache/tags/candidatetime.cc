@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* @file
+ * Microbenchmark of the per-access overhead of cache candidate lookups.
+ *
+ * Every access to a tag store asks its indexing policy for the possible
+ * entries of an address, searches them for a tag, and on a miss asks the
+ * replacement policy for a victim among them. This compares doing so
+ * through the copying getPossibleEntries() adapter with the non-owning
+ * views returned by getCandidates().
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "base/cprintf.hh"
+#include "mem/cache/replacement_policies/lru_rp.hh"
+#include "mem/cache/tags/indexing_policies/set_associative.hh"
+#include "mem/cache/tags/indexing_policies/skewed_associative.hh"
+#include "mem/cache/tags/tagged_entry.hh"
+#include "params/LRURP.hh"
+#include "params/SetAssociative.hh"
+#include "params/SkewedAssociative.hh"
+#include "sim/eventq.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+const int Assoc = 8;
+const int BlockSize = 64;
+const uint64_t CacheSize = 1 << 20;
+
+/** A tag store just large enough to drive the policies. */
+struct Table
+{
+    BaseIndexingPolicy &indexing;
+    replacement_policy::Base &repl;
+    std::vector<TaggedEntry> entries;
+
+    Table(BaseIndexingPolicy &_indexing, replacement_policy::Base &_repl)
+        : indexing(_indexing), repl(_repl), entries(CacheSize / BlockSize)
+    {
+        for (uint64_t i = 0; i < entries.size(); i++) {
+            indexing.setEntry(&entries[i], i);
+            entries[i].replacementData = repl.instantiateEntry();
+        }
+    }
+
+    template <typename Candidates>
+    void
+    access(Addr addr, const Candidates &candidates)
+    {
+        const Addr tag = indexing.extractTag(addr);
+        for (ReplaceableEntry *candidate : candidates) {
+            auto *entry = static_cast<TaggedEntry *>(candidate);
+            if (entry->matchTag(tag, false)) {
+                repl.touch(entry->replacementData);
+                return;
+            }
+        }
+
+        auto *victim = static_cast<TaggedEntry *>(
+            repl.getVictim(candidates));
+        if (victim->isValid())
+            victim->invalidate();
+        victim->insert(tag, false);
+        repl.reset(victim->replacementData);
+    }
+};
+
+void
+run(const char *name, BaseIndexingPolicy &indexing, uint64_t accesses)
+{
+    LRURPParams lru_params;
+    lru_params.name = "lru";
+    lru_params.eventq_index = 0;
+    replacement_policy::LRU lru(lru_params);
+
+    Table table(indexing, lru);
+
+    // A working set twice the size of the cache, so that the lookups
+    // see a mix of hits and misses
+    std::mt19937_64 rng(1);
+    std::uniform_int_distribution<Addr> dist(0, 2 * CacheSize / BlockSize);
+    std::vector<Addr> addrs(1 << 16);
+    for (auto &addr : addrs)
+        addr = dist(rng) * BlockSize;
+
+    EventQueue *eq = curEventQueue();
+    auto time = [&](auto lookup) {
+        const auto start = std::chrono::steady_clock::now();
+        for (uint64_t i = 0; i < accesses; i++) {
+            // The replacement policy orders entries by access tick
+            eq->setCurTick(eq->getCurTick() + 1);
+            lookup(addrs[i % addrs.size()]);
+        }
+        const std::chrono::duration<double, std::nano> ns =
+            std::chrono::steady_clock::now() - start;
+        return ns.count() / accesses;
+    };
+
+    const double vec_ns = time([&](Addr addr) {
+            const std::vector<ReplaceableEntry *> entries =
+                indexing.getPossibleEntries(addr);
+            table.access(addr, entries);
+        });
+    const double view_ns = time([&](Addr addr) {
+            table.access(addr, indexing.getCandidates(addr));
+        });
+
+    cprintf("%-8s getPossibleEntries: %6.1f ns/access, "
+            "getCandidates: %6.1f ns/access\n", name, vec_ns, view_ns);
+}
+
+} // anonymous namespace
+
+int
+main(int argc, char *argv[])
+{
+    const uint64_t accesses = argc > 1 ? std::atoll(argv[1]) : 20000000;
+
+    curEventQueue(getEventQueue(0));
+
+    SetAssociativeParams set_params;
+    set_params.name = "set";
+    set_params.eventq_index = 0;
+    set_params.assoc = Assoc;
+    set_params.entry_size = BlockSize;
+    set_params.size = CacheSize;
+    SetAssociative set_assoc(set_params);
+    run("set", set_assoc, accesses);
+
+    SkewedAssociativeParams skewed_params;
+    skewed_params.name = "skewed";
+    skewed_params.eventq_index = 0;
+    skewed_params.assoc = Assoc;
+    skewed_params.entry_size = BlockSize;
+    skewed_params.size = CacheSize;
+    SkewedAssociative skewed_assoc(skewed_params);
+    run("skewed", skewed_assoc, accesses);
+
+    return 0;
+}
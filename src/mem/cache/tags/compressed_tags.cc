@@ -120,15 +120,10 @@ CompressedTags::findVictim(Addr addr, const bool is_secure,
                            std::vector<CacheBlk*>& evict_blks,
                            const uint64_t partition_id=0)
 {
-    // Get all possible locations of this superblock
-    std::vector<ReplaceableEntry*> superblock_entries =
-        indexingPolicy->getPossibleEntries(addr);
-
-    // Filter entries based on PartitionID
-    if (partitionManager){
-        partitionManager->filterByPartition(superblock_entries,
-            partition_id);
-    }
+    // Get all possible locations of this superblock, filtered by
+    // PartitionID
+    const ReplacementCandidates superblock_entries =
+        getVictimCandidates(addr, partition_id);
 
     // Check if the superblock this address belongs to has been allocated. If
     // so, try co-allocating
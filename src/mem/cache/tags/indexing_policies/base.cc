@@ -59,7 +59,7 @@ BaseIndexingPolicy::BaseIndexingPolicy(const Params &p)
     : SimObject(p), assoc(p.assoc),
       numSets(p.size / (p.entry_size * assoc)),
       setShift(floorLog2(p.entry_size)), setMask(numSets - 1), sets(numSets),
-      tagShift(setShift + floorLog2(numSets))
+      tagShift(setShift + floorLog2(numSets)), candidateBuffer(assoc)
 {
     fatal_if(!isPowerOf2(numSets), "# of sets must be non-zero and a power " \
              "of 2");
@@ -101,4 +101,17 @@ BaseIndexingPolicy::extractTag(const Addr addr) const
     return (addr >> tagShift);
 }
 
+ReplacementCandidates
+BaseIndexingPolicy::getCandidates(const Addr addr) const
+{
+    candidateBuffer = getPossibleEntries(addr);
+    return candidateBuffer;
+}
+
+uint32_t
+BaseIndexingPolicy::getPossibleSet(const Addr addr, const uint32_t way) const
+{
+    return getCandidates(addr)[way]->getSet();
+}
+
 } // namespace gem5
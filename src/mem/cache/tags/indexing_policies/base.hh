@@ -49,14 +49,13 @@
 
 #include <vector>
 
+#include "mem/cache/replacement_policies/replaceable_entry.hh"
 #include "params/BaseIndexingPolicy.hh"
 #include "sim/sim_object.hh"
 
 namespace gem5
 {
 
-class ReplaceableEntry;
-
 /**
  * A common base class for indexing table locations. Classes that inherit
  * from it determine hash functions that should be applied based on the set
@@ -96,6 +95,13 @@ class BaseIndexingPolicy : public SimObject
      */
     const int tagShift;
 
+    /**
+     * Scratch space for policies whose candidates are not stored
+     * contiguously. Views returned by getCandidates() may point into it,
+     * so it is overwritten by the next lookup on this policy.
+     */
+    mutable std::vector<ReplaceableEntry*> candidateBuffer;
+
   public:
     /**
      * Convenience typedef.
@@ -138,17 +144,55 @@ class BaseIndexingPolicy : public SimObject
      */
     virtual Addr extractTag(const Addr addr) const;
 
+    /**
+     * Find all possible entries for insertion and replacement of an address,
+     * without allocating. Should be called immediately before
+     * ReplacementPolicy's findVictim() not to break cache resizing.
+     *
+     * The returned view may alias scratch space of the policy, so it is
+     * only valid until the next lookup on the same policy, including the
+     * ones made by getPossibleEntries() and getPossibleSet(). Callers that
+     * need the candidates across such a nested lookup must copy them,
+     * e.g., with getPossibleEntries().
+     *
+     * The default copies the result of getPossibleEntries() to scratch
+     * space; policies override it to hand out their entries in place.
+     *
+     * @param addr The addr to a find possible entries for.
+     * @return The possible entries.
+     */
+    virtual ReplacementCandidates getCandidates(const Addr addr) const;
+
     /**
      * Find all possible entries for insertion and replacement of an address.
      * Should be called immediately before ReplacementPolicy's findVictim()
-     * not to break cache resizing.
+     * not to break cache resizing. Unlike getCandidates(), the result is
+     * owned by the caller, at the cost of an allocation.
      *
      * @param addr The addr to a find possible entries for.
-     * @return The possible entries.
+     * @return A copy of the possible entries.
      */
     virtual std::vector<ReplaceableEntry*> getPossibleEntries(const Addr addr)
                                                                     const = 0;
 
+    /**
+     * Get the set of the possible entry of an address in the given way,
+     * i.e., the entry getEntry(getPossibleSet(addr, way), way) is one of
+     * getCandidates(addr).
+     *
+     * @param addr The addr to find the set for.
+     * @param way The way of the possible entry.
+     * @return The set of the possible entry.
+     */
+    virtual uint32_t getPossibleSet(const Addr addr, const uint32_t way)
+                                                                    const;
+
+    /**
+     * Whether all possible entries of an address share the same set, in
+     * which case they are the whole set.
+     */
+    virtual bool waysShareSet() const { return false; }
+
     /**
      * Regenerate an entry's address from its tag and assigned indexing bits.
      *
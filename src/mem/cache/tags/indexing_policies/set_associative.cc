@@ -69,10 +69,22 @@ SetAssociative::regenerateAddr(const Addr tag, const ReplaceableEntry* entry)
     return (tag << tagShift) | (entry->getSet() << setShift);
 }
 
+ReplacementCandidates
+SetAssociative::getCandidates(const Addr addr) const
+{
+    return sets[extractSet(addr)];
+}
+
 std::vector<ReplaceableEntry*>
 SetAssociative::getPossibleEntries(const Addr addr) const
 {
     return sets[extractSet(addr)];
 }
 
+uint32_t
+SetAssociative::getPossibleSet(const Addr addr, const uint32_t way) const
+{
+    return extractSet(addr);
+}
+
 } // namespace gem5
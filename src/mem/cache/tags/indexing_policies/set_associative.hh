@@ -115,8 +115,15 @@ class SetAssociative : public BaseIndexingPolicy
      * @param addr The addr to a find possible entries for.
      * @return The possible entries.
      */
+    ReplacementCandidates getCandidates(const Addr addr) const override;
+
     std::vector<ReplaceableEntry*> getPossibleEntries(const Addr addr) const
-                                                                     override;
+                                                                  override;
+
+    uint32_t getPossibleSet(const Addr addr, const uint32_t way) const
+                                                                 override;
+
+    bool waysShareSet() const override { return true; }
 
     /**
      * Regenerate an entry's address from its tag and assigned set and way.
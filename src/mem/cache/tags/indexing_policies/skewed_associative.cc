@@ -206,18 +206,30 @@ SkewedAssociative::regenerateAddr(const Addr tag,
            ((deskew(addr_set, entry->getWay()) & setMask) << setShift);
 }
 
-std::vector<ReplaceableEntry*>
-SkewedAssociative::getPossibleEntries(const Addr addr) const
+ReplacementCandidates
+SkewedAssociative::getCandidates(const Addr addr) const
 {
-    std::vector<ReplaceableEntry*> entries;
-
     // Parse all ways
     for (uint32_t way = 0; way < assoc; ++way) {
         // Apply hash to get set, and get way entry in it
-        entries.push_back(sets[extractSet(addr, way)][way]);
+        candidateBuffer[way] = sets[extractSet(addr, way)][way];
     }
 
-    return entries;
+    return candidateBuffer;
+}
+
+std::vector<ReplaceableEntry*>
+SkewedAssociative::getPossibleEntries(const Addr addr) const
+{
+    const ReplacementCandidates candidates = getCandidates(addr);
+    return std::vector<ReplaceableEntry*>(candidates.begin(),
+                                          candidates.end());
+}
+
+uint32_t
+SkewedAssociative::getPossibleSet(const Addr addr, const uint32_t way) const
+{
+    return extractSet(addr, way);
 }
 
 } // namespace gem5
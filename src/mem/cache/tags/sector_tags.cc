@@ -272,8 +272,8 @@ SectorTags::findBlock(Addr addr, bool is_secure) const
     const Addr offset = extractSectorOffset(addr);
 
     // Find all possible sector entries that may contain the given address
-    const std::vector<ReplaceableEntry*> entries =
-        indexingPolicy->getPossibleEntries(addr);
+    const ReplacementCandidates entries =
+        indexingPolicy->getCandidates(addr);
 
     // Search for block
     for (const auto& sector : entries) {
@@ -292,13 +292,9 @@ SectorTags::findVictim(Addr addr, const bool is_secure, const std::size_t size,
                        std::vector<CacheBlk*>& evict_blks,
                        const uint64_t partition_id)
 {
-    // Get possible entries to be victimized
-    std::vector<ReplaceableEntry*> sector_entries =
-        indexingPolicy->getPossibleEntries(addr);
-
-    // Filter entries based on PartitionID
-    if (partitionManager)
-        partitionManager->filterByPartition(sector_entries, partition_id);
+    // Get possible entries to be victimized, filtered by PartitionID
+    const ReplacementCandidates sector_entries =
+        getVictimCandidates(addr, partition_id);
 
     // Check if the sector this address belongs to has been allocated
     Addr tag = extractTag(addr);
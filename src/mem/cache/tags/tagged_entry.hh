@@ -51,6 +51,38 @@ class TaggedEntry : public CacheEntry
     TaggedEntry() : CacheEntry(), _secure(false) {}
     ~TaggedEntry() = default;
 
+    /** Lookup key of entries that are not valid. */
+    static constexpr Addr InvalidKey = MaxAddr;
+
+    /**
+     * Pack the tag information into a single key, so that tag stores can
+     * match an entry with one comparison. Tags never use the full address
+     * width, so the shift is lossless.
+     *
+     * @param tag The tag value.
+     * @param is_secure Whether the secure bit is set.
+     * @return The lookup key.
+     */
+    static Addr
+    lookupKey(Addr tag, bool is_secure)
+    {
+        return (tag << 1) | is_secure;
+    }
+
+    /**
+     * Keep a copy of this entry's lookup key, or InvalidKey if the entry
+     * is not valid, at the given location. This allows tag stores to
+     * search flat arrays of keys instead of chasing entry pointers.
+     *
+     * @param key Where to mirror the key to.
+     */
+    void
+    mirrorKey(Addr *key)
+    {
+        keyMirror = key;
+        updateKeyMirror();
+    }
+
     /**
      * Check if this block holds data from the secure memory space.
      *
@@ -93,6 +125,7 @@ class TaggedEntry : public CacheEntry
     {
         CacheEntry::invalidate();
         clearSecure();
+        updateKeyMirror();
     }
 
     std::string
@@ -117,9 +150,40 @@ class TaggedEntry : public CacheEntry
     }
   protected:
     /** Set secure bit. */
-    virtual void setSecure() { _secure = true; }
+    virtual void
+    setSecure()
+    {
+        _secure = true;
+        updateKeyMirror();
+    }
+
+    void
+    setTag(Addr tag) override
+    {
+        CacheEntry::setTag(tag);
+        updateKeyMirror();
+    }
+
+    void
+    setValid() override
+    {
+        CacheEntry::setValid();
+        updateKeyMirror();
+    }
 
   private:
+    /** Where to mirror the lookup key to, if anywhere. */
+    Addr *keyMirror = nullptr;
+
+    void
+    updateKeyMirror()
+    {
+        if (keyMirror) {
+            *keyMirror = isValid() ? lookupKey(getTag(), isSecure()) :
+                InvalidKey;
+        }
+    }
+
     /**
      * Secure bit. Marks whether this entry refers to an address in the secure
      * memory space. Must always be modified along with the tag.
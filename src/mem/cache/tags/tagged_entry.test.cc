@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include "mem/cache/tags/tagged_entry.hh"
+
+using namespace gem5;
+
+/** The mirrored key follows insertion and invalidation. */
+TEST(TaggedEntryTest, MirrorKey)
+{
+    TaggedEntry entry;
+    Addr key = 0;
+
+    entry.mirrorKey(&key);
+    ASSERT_EQ(key, TaggedEntry::InvalidKey);
+
+    entry.insert(0x1234, false);
+    ASSERT_EQ(key, TaggedEntry::lookupKey(0x1234, false));
+
+    entry.invalidate();
+    ASSERT_EQ(key, TaggedEntry::InvalidKey);
+
+    entry.insert(0x1234, true);
+    ASSERT_EQ(key, TaggedEntry::lookupKey(0x1234, true));
+}
+
+/** Keys only match if both the tag and the secure bit match. */
+TEST(TaggedEntryTest, LookupKeyMatchesTag)
+{
+    TaggedEntry entry;
+    Addr key = 0;
+    entry.mirrorKey(&key);
+    entry.insert(0x42, true);
+
+    for (Addr tag : {Addr(0x41), Addr(0x42), Addr(0x43)}) {
+        for (bool secure : {false, true}) {
+            ASSERT_EQ(key == TaggedEntry::lookupKey(tag, secure),
+                      entry.matchTag(tag, secure));
+        }
+    }
+    ASSERT_NE(TaggedEntry::lookupKey(0, false), TaggedEntry::InvalidKey);
+}
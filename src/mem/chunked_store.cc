@@ -0,0 +1,1014 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/chunked_store.hh"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <zlib.h>
+
+#if defined(__linux__)
+#include <linux/userfaultfd.h>
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "base/barrier.hh"
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "sim/byteswap.hh"
+
+namespace gem5
+{
+
+namespace memory
+{
+
+namespace chunked_store
+{
+
+namespace
+{
+
+static_assert(PagesPerChunk == 64, "Presence bitmaps are 64 bits wide");
+
+constexpr uint64_t AllPages = ~uint64_t(0);
+
+/**
+ * At most this many separate regions are mapped from a file, to stay
+ * well below the host's limit on the number of mappings of a process.
+ */
+constexpr unsigned MaxMapRegions = 4096;
+
+enum Codec : uint32_t
+{
+    CodecNone,
+    CodecZlib,
+    /** Stored in the parent file. */
+    CodecParent,
+};
+
+enum Flags : uint32_t
+{
+    /**
+     * The file is a delta. The chunk table is followed by the length of
+     * the path to the parent, as a uint32_t, and the path itself.
+     */
+    FlagDelta = 1,
+};
+
+/**
+ * File header, followed by the chunk table. Like the chunk table and
+ * the rest of the checkpoint, it is stored in little-endian byte order.
+ */
+struct FileHeader
+{
+    char magic[8];
+    uint32_t version;
+    uint32_t pageSize;
+    uint32_t pagesPerChunk;
+    uint32_t flags;
+    uint64_t size;
+    uint64_t numChunks;
+};
+
+constexpr char Magic[8] = "gem5pmc";
+constexpr uint32_t Version = 1;
+
+using ChunkEntry = Reader::ChunkEntry;
+
+/** Convert every field of a header with convert (htole or letoh). */
+template <typename F>
+void
+convertHeader(FileHeader &header, F convert)
+{
+    header.version = convert(header.version);
+    header.pageSize = convert(header.pageSize);
+    header.pagesPerChunk = convert(header.pagesPerChunk);
+    header.flags = convert(header.flags);
+    header.size = convert(header.size);
+    header.numChunks = convert(header.numChunks);
+}
+
+/** Convert every field of a chunk entry with convert. */
+template <typename F>
+void
+convertEntry(ChunkEntry &entry, F convert)
+{
+    entry.offset = convert(entry.offset);
+    entry.present = convert(entry.present);
+    entry.length = convert(entry.length);
+    entry.codec = convert(entry.codec);
+}
+
+const auto toLE = [](auto value) { return htole(value); };
+const auto fromLE = [](auto value) { return letoh(value); };
+
+unsigned
+numThreads(unsigned threads)
+{
+    if (threads == 0)
+        threads = std::thread::hardware_concurrency();
+    return std::max(threads, 1u);
+}
+
+/**
+ * Threads that call f(i) for all i in [0, count) for one (count, f)
+ * after another. The threads are started once, not for every call.
+ */
+class WorkerPool
+{
+  public:
+    explicit WorkerPool(unsigned threads)
+        : barrier(threads), count(0), next(0), exiting(false)
+    {
+        for (unsigned t = 1; t < threads; t++)
+            workers.emplace_back([this]() { workerLoop(); });
+    }
+
+    ~WorkerPool()
+    {
+        exiting = true;
+        barrier.wait();
+        for (auto &worker : workers)
+            worker.join();
+    }
+
+    void
+    run(uint64_t _count, std::function<void(uint64_t)> _job)
+    {
+        job = std::move(_job);
+        count = _count;
+        next = 0;
+
+        // Release the workers, take part, and wait for the workers
+        barrier.wait();
+        work();
+        barrier.wait();
+    }
+
+  private:
+    void
+    work()
+    {
+        for (uint64_t i; (i = next.fetch_add(1)) < count; )
+            job(i);
+    }
+
+    void
+    workerLoop()
+    {
+        while (true) {
+            barrier.wait();
+            if (exiting)
+                return;
+            work();
+            barrier.wait();
+        }
+    }
+
+    Barrier barrier;
+    std::vector<std::thread> workers;
+    std::function<void(uint64_t)> job;
+    uint64_t count;
+    std::atomic<uint64_t> next;
+    bool exiting;
+};
+
+bool
+allZero(const uint8_t *p, uint64_t len)
+{
+    return len == 0 || (p[0] == 0 && std::memcmp(p, p + 1, len - 1) == 0);
+}
+
+void
+pwriteAll(int fd, const void *buf, uint64_t len, uint64_t offset,
+          const std::string &path)
+{
+    auto *p = static_cast<const uint8_t *>(buf);
+    while (len > 0) {
+        ssize_t ret = pwrite(fd, p, len, offset);
+        if (ret < 0 && errno == EINTR)
+            continue;
+        fatal_if(ret <= 0,
+                 "Write failed on physical memory checkpoint file '%s': %s\n",
+                 path, std::strerror(errno));
+        p += ret;
+        len -= ret;
+        offset += ret;
+    }
+}
+
+void
+preadAll(int fd, void *buf, uint64_t len, uint64_t offset,
+         const std::string &path)
+{
+    auto *p = static_cast<uint8_t *>(buf);
+    while (len > 0) {
+        ssize_t ret = pread(fd, p, len, offset);
+        if (ret < 0 && errno == EINTR)
+            continue;
+        fatal_if(ret < 0,
+                 "Read failed on physical memory checkpoint file '%s': %s\n",
+                 path, std::strerror(errno));
+        fatal_if(ret == 0,
+                 "Physical memory checkpoint file '%s' is truncated\n",
+                 path);
+        p += ret;
+        len -= ret;
+        offset += ret;
+    }
+}
+
+/** Number of bytes of the pages of a len bytes chunk set in present. */
+uint64_t
+storedLength(uint64_t present, uint64_t len)
+{
+    uint64_t stored = 0;
+    for (unsigned page = 0; page < PagesPerChunk; page++) {
+        if (present & (uint64_t(1) << page))
+            stored += std::min(PageSize, len - page * PageSize);
+    }
+    return stored;
+}
+
+/** Encoded payload of a chunk. */
+struct Payload
+{
+    const uint8_t *data = nullptr;
+    std::vector<uint8_t> packed;
+    std::vector<uint8_t> deflated;
+};
+
+ChunkEntry
+encodeChunk(const uint8_t *chunk, uint64_t len, bool compress,
+            Payload &payload)
+{
+    ChunkEntry entry = {0, 0, 0, CodecNone};
+
+    uint64_t stored = 0;
+    for (unsigned page = 0; page * PageSize < len; page++) {
+        const uint64_t page_len = std::min(PageSize, len - page * PageSize);
+        if (!allZero(chunk + page * PageSize, page_len)) {
+            entry.present |= uint64_t(1) << page;
+            stored += page_len;
+        }
+    }
+    if (!entry.present)
+        return entry;
+
+    if (stored == len) {
+        payload.data = chunk;
+    } else {
+        // Pack the pages that are present
+        payload.packed.resize(stored);
+        uint8_t *out = payload.packed.data();
+        for (unsigned page = 0; page * PageSize < len; page++) {
+            if (!(entry.present & (uint64_t(1) << page)))
+                continue;
+            const uint64_t page_len =
+                std::min(PageSize, len - page * PageSize);
+            std::memcpy(out, chunk + page * PageSize, page_len);
+            out += page_len;
+        }
+        payload.data = payload.packed.data();
+    }
+    entry.length = stored;
+
+    if (compress) {
+        uLongf deflated_len = compressBound(stored);
+        payload.deflated.resize(deflated_len);
+        // Keep the chunk uncompressed if it does not compress
+        if (compress2(payload.deflated.data(), &deflated_len, payload.data,
+                      stored, Z_BEST_SPEED) == Z_OK &&
+            deflated_len < stored) {
+            payload.data = payload.deflated.data();
+            entry.length = deflated_len;
+            entry.codec = CodecZlib;
+        }
+    }
+
+    return entry;
+}
+
+/**
+ * Write a file, which is a delta if parent is set. Unchanged chunks are
+ * the ones not in written if it is set, or else the ones with the same
+ * contents as in the parent.
+ */
+void
+writeFile(const std::string &path, const uint8_t *data, uint64_t size,
+          bool compress, unsigned threads, const Reader *parent,
+          const std::string &parent_ref, const std::vector<bool> *written)
+{
+    const std::string tmp_path = path + ".tmp";
+    int fd = open(tmp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0664);
+    fatal_if(fd < 0, "Can't open physical memory checkpoint file '%s'\n",
+             tmp_path);
+
+    const uint64_t num_chunks = divCeil(size, ChunkSize);
+    std::vector<ChunkEntry> table(num_chunks);
+    const uint64_t table_end =
+        sizeof(FileHeader) + num_chunks * sizeof(ChunkEntry);
+    const uint32_t parent_ref_len = parent_ref.size();
+    uint64_t offset = roundUp(table_end + (parent ?
+        sizeof(parent_ref_len) + parent_ref_len : 0), PageSize);
+
+    auto unchanged = [&](uint64_t idx, const uint8_t *chunk, uint64_t len) {
+        if (written)
+            return !(*written)[idx];
+        thread_local std::vector<uint8_t> parent_chunk;
+        parent_chunk.assign(ChunkSize, 0);
+        parent->readChunk(idx, parent_chunk.data());
+        return std::memcmp(parent_chunk.data(), chunk, len) == 0;
+    };
+
+    // Encode the chunks in batches, which bounds the memory used for the
+    // payloads, and write each batch out in order
+    threads = numThreads(threads);
+    const uint64_t batch_size = std::min<uint64_t>(num_chunks, threads * 16);
+    std::vector<Payload> payloads(batch_size);
+    WorkerPool pool(std::max<uint64_t>(1, std::min<uint64_t>(threads,
+                                                          batch_size)));
+    for (uint64_t first = 0; first < num_chunks; first += batch_size) {
+        const uint64_t count = std::min(batch_size, num_chunks - first);
+        pool.run(count, [&](uint64_t i) {
+            const uint64_t idx = first + i;
+            const uint64_t start = idx * ChunkSize;
+            const uint64_t len = std::min(ChunkSize, size - start);
+            if (parent && unchanged(idx, data + start, len)) {
+                table[idx] = {0, parent->presentPages(idx), 0, CodecParent};
+                return;
+            }
+            table[idx] = encodeChunk(data + start, len, compress,
+                                     payloads[i]);
+        });
+
+        for (uint64_t i = 0; i < count; i++) {
+            ChunkEntry &entry = table[first + i];
+            if (!entry.present || entry.codec == CodecParent)
+                continue;
+
+            // Uncompressed chunks are page aligned so they can be mapped
+            if (entry.codec == CodecNone)
+                offset = roundUp(offset, PageSize);
+            entry.offset = offset;
+            pwriteAll(fd, payloads[i].data, entry.length, offset, tmp_path);
+            offset += entry.length;
+        }
+    }
+
+    FileHeader header = {};
+    std::memcpy(header.magic, Magic, sizeof(Magic));
+    header.version = Version;
+    header.pageSize = PageSize;
+    header.pagesPerChunk = PagesPerChunk;
+    header.flags = parent ? FlagDelta : 0;
+    header.size = size;
+    header.numChunks = num_chunks;
+    convertHeader(header, toLE);
+    for (auto &entry : table)
+        convertEntry(entry, toLE);
+    pwriteAll(fd, &header, sizeof(header), 0, tmp_path);
+    pwriteAll(fd, table.data(), num_chunks * sizeof(ChunkEntry),
+              sizeof(header), tmp_path);
+    if (parent) {
+        const uint32_t parent_ref_len_le = htole(parent_ref_len);
+        pwriteAll(fd, &parent_ref_len_le, sizeof(parent_ref_len_le),
+                  table_end, tmp_path);
+        pwriteAll(fd, parent_ref.data(), parent_ref_len,
+                  table_end + sizeof(parent_ref_len), tmp_path);
+    }
+
+    fatal_if(close(fd) != 0,
+             "Close failed on physical memory checkpoint file '%s'\n",
+             tmp_path);
+    fatal_if(std::rename(tmp_path.c_str(), path.c_str()) != 0,
+             "Can't rename physical memory checkpoint file '%s': %s\n",
+             tmp_path, std::strerror(errno));
+}
+
+} // anonymous namespace
+
+void
+write(const std::string &path, const uint8_t *data, uint64_t size,
+      bool compress, unsigned threads)
+{
+    writeFile(path, data, size, compress, threads, nullptr, "", nullptr);
+}
+
+void
+writeDelta(const std::string &path, const uint8_t *data, uint64_t size,
+           bool compress, unsigned threads, const std::string &parent_path,
+           const std::vector<bool> *written)
+{
+    namespace fs = std::filesystem;
+
+    Reader parent(parent_path);
+    fatal_if(parent.size() != size,
+             "Physical memory checkpoint file '%s' has the wrong size to "
+             "be the parent of a delta\n", parent_path);
+    assert(!written || written->size() == parent.numChunks());
+
+    const fs::path dir = fs::absolute(path).lexically_normal().parent_path();
+    const fs::path parent_abs = fs::absolute(parent_path).lexically_normal();
+    fs::path parent_ref = parent_abs.lexically_relative(dir);
+    if (parent_ref.empty())
+        parent_ref = parent_abs;
+
+    writeFile(path, data, size, compress, threads, &parent,
+              parent_ref.string(), written);
+}
+
+bool
+isChunkedFile(const std::string &path)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+
+    char magic[sizeof(Magic)];
+    bool match = pread(fd, magic, sizeof(magic), 0) == sizeof(magic) &&
+        std::memcmp(magic, Magic, sizeof(Magic)) == 0;
+    close(fd);
+    return match;
+}
+
+Reader::Reader(const std::string &path)
+    : path(path), fd(open(path.c_str(), O_RDONLY)), _size(0)
+{
+    fatal_if(fd < 0, "Can't open physical memory checkpoint file '%s'\n",
+             path);
+
+    FileHeader header;
+    preadAll(fd, &header, sizeof(header), 0, path);
+    convertHeader(header, fromLE);
+    fatal_if(std::memcmp(header.magic, Magic, sizeof(Magic)) != 0,
+             "'%s' is not a chunked physical memory checkpoint file\n",
+             path);
+    fatal_if(header.version != Version || header.pageSize != PageSize ||
+             header.pagesPerChunk != PagesPerChunk,
+             "Unsupported chunked physical memory checkpoint file '%s'\n",
+             path);
+    fatal_if(header.numChunks != divCeil(header.size, ChunkSize),
+             "Corrupt physical memory checkpoint file '%s'\n", path);
+
+    _size = header.size;
+    table.resize(header.numChunks);
+    const uint64_t table_len = table.size() * sizeof(ChunkEntry);
+    preadAll(fd, table.data(), table_len, sizeof(header), path);
+    for (auto &entry : table)
+        convertEntry(entry, fromLE);
+
+    if (header.flags & FlagDelta) {
+        uint32_t parent_ref_len;
+        preadAll(fd, &parent_ref_len, sizeof(parent_ref_len),
+                 sizeof(header) + table_len, path);
+        parent_ref_len = letoh(parent_ref_len);
+        std::string parent_ref(parent_ref_len, '\0');
+        preadAll(fd, parent_ref.data(), parent_ref_len,
+                 sizeof(header) + table_len + sizeof(parent_ref_len), path);
+
+        // Relative paths are relative to the directory of the delta
+        namespace fs = std::filesystem;
+        const fs::path parent_path =
+            fs::path(path).parent_path() / fs::path(parent_ref);
+        parent = std::make_unique<Reader>(parent_path.string());
+        fatal_if(parent->size() != _size,
+                 "Parent '%s' of physical memory checkpoint file '%s' has "
+                 "the wrong size\n", parent_path.string(), path);
+    }
+}
+
+Reader::~Reader()
+{
+    close(fd);
+}
+
+uint64_t
+Reader::chunkLength(uint64_t idx) const
+{
+    return std::min(ChunkSize, _size - idx * ChunkSize);
+}
+
+const Reader &
+Reader::owner(uint64_t idx) const
+{
+    const Reader *reader = this;
+    while (reader->table[idx].codec == CodecParent) {
+        fatal_if(!reader->parent,
+                 "Corrupt chunk %d in physical memory checkpoint file "
+                 "'%s'\n", idx, reader->path);
+        reader = reader->parent.get();
+    }
+    return *reader;
+}
+
+uint64_t
+Reader::presentPages(uint64_t idx) const
+{
+    return owner(idx).table[idx].present;
+}
+
+bool
+Reader::mappable(uint64_t idx, const uint8_t *dst) const
+{
+    static const uint64_t host_page_size = sysconf(_SC_PAGE_SIZE);
+
+    const ChunkEntry &entry = table[idx];
+    return entry.codec == CodecNone && entry.present == AllPages &&
+        chunkLength(idx) == ChunkSize &&
+        entry.offset % host_page_size == 0 &&
+        reinterpret_cast<uintptr_t>(dst) % host_page_size == 0;
+}
+
+void
+Reader::readChunk(uint64_t idx, uint8_t *dst) const
+{
+    owner(idx).readOwnChunk(idx, dst);
+}
+
+void
+Reader::readOwnChunk(uint64_t idx, uint8_t *dst) const
+{
+    const ChunkEntry &entry = table[idx];
+    if (!entry.present)
+        return;
+
+    const uint64_t len = chunkLength(idx);
+    const uint64_t stored = storedLength(entry.present, len);
+
+    // Complete chunks are decoded in place, others are unpacked
+    thread_local std::vector<uint8_t> packed_buf;
+    thread_local std::vector<uint8_t> file_buf;
+    uint8_t *packed = dst;
+    if (stored != len) {
+        packed_buf.resize(stored);
+        packed = packed_buf.data();
+    }
+
+    if (entry.codec == CodecNone) {
+        fatal_if(entry.length != stored,
+                 "Corrupt chunk %d in physical memory checkpoint file "
+                 "'%s'\n", idx, path);
+        preadAll(fd, packed, stored, entry.offset, path);
+    } else if (entry.codec == CodecZlib) {
+        file_buf.resize(entry.length);
+        preadAll(fd, file_buf.data(), entry.length, entry.offset, path);
+        uLongf inflated_len = stored;
+        fatal_if(uncompress(packed, &inflated_len, file_buf.data(),
+                            entry.length) != Z_OK || inflated_len != stored,
+                 "Corrupt chunk %d in physical memory checkpoint file "
+                 "'%s'\n", idx, path);
+    } else {
+        fatal("Unknown codec %d in physical memory checkpoint file '%s'\n",
+              entry.codec, path);
+    }
+
+    if (packed == dst)
+        return;
+
+    for (unsigned page = 0; page * PageSize < len; page++) {
+        if (!(entry.present & (uint64_t(1) << page)))
+            continue;
+        const uint64_t page_len = std::min(PageSize, len - page * PageSize);
+        std::memcpy(dst + page * PageSize, packed, page_len);
+        packed += page_len;
+    }
+}
+
+void
+Reader::readAll(uint8_t *dst, unsigned threads, bool allow_map) const
+{
+    std::vector<bool> mapped(numChunks(), false);
+
+    // Map runs of chunks that are consecutive in a file of the chain with
+    // one call, the pages are then only read in when they are first
+    // touched
+    unsigned regions = 0;
+    for (uint64_t idx = 0; allow_map && idx < numChunks() &&
+             regions < MaxMapRegions; ) {
+        const Reader &file = owner(idx);
+        if (!file.mappable(idx, dst + idx * ChunkSize)) {
+            idx++;
+            continue;
+        }
+
+        uint64_t end = idx + 1;
+        while (end < numChunks() && &owner(end) == &file &&
+               file.mappable(end, dst + end * ChunkSize) &&
+               file.table[end].offset ==
+                   file.table[end - 1].offset + ChunkSize) {
+            end++;
+        }
+
+        void *addr = mmap(dst + idx * ChunkSize, (end - idx) * ChunkSize,
+                          PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED,
+                          file.fd, file.table[idx].offset);
+        fatal_if(addr == MAP_FAILED,
+                 "Can't map physical memory checkpoint file '%s': %s\n",
+                 file.path, std::strerror(errno));
+
+        std::fill(mapped.begin() + idx, mapped.begin() + end, true);
+        regions++;
+        idx = end;
+    }
+
+    WorkerPool pool(std::max<uint64_t>(1,
+        std::min<uint64_t>(numThreads(threads), numChunks())));
+    pool.run(numChunks(), [&](uint64_t idx) {
+        if (!mapped[idx])
+            readChunk(idx, dst + idx * ChunkSize);
+    });
+}
+
+namespace
+{
+
+/** Soft-dirty bit of a /proc/self/pagemap entry. */
+constexpr uint64_t PagemapSoftDirty = uint64_t(1) << 55;
+
+std::mutex trackersLock;
+std::vector<WriteTracker *> trackers;
+
+/** Clear the soft-dirty bits of all the pages of the process. */
+bool
+clearSoftDirty()
+{
+    int fd = open("/proc/self/clear_refs", O_WRONLY | O_CLOEXEC);
+    if (fd < 0)
+        return false;
+    const bool cleared = ::write(fd, "4", 1) == 1;
+    close(fd);
+    return cleared;
+}
+
+} // anonymous namespace
+
+WriteTracker::WriteTracker(const uint8_t *data, uint64_t size)
+    : data(data), size(size), pending(divCeil(size, ChunkSize), false),
+      started(false)
+{
+    std::lock_guard<std::mutex> lock(trackersLock);
+    if (supported())
+        trackers.push_back(this);
+}
+
+WriteTracker::~WriteTracker()
+{
+    std::lock_guard<std::mutex> lock(trackersLock);
+    trackers.erase(std::remove(trackers.begin(), trackers.end(), this),
+                   trackers.end());
+}
+
+bool
+WriteTracker::supported()
+{
+    // Some kernels accept clearing the bits but never set them, so check
+    // that writing to a page does
+    static const bool supported = []() {
+        const long page_size = sysconf(_SC_PAGE_SIZE);
+        void *page = mmap(nullptr, page_size, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (page == MAP_FAILED)
+            return false;
+
+        bool set = false;
+        *static_cast<volatile uint8_t *>(page) = 1;
+        if (clearSoftDirty()) {
+            *static_cast<volatile uint8_t *>(page) = 2;
+            int fd = open("/proc/self/pagemap", O_RDONLY | O_CLOEXEC);
+            uint64_t entry = 0;
+            set = fd >= 0 &&
+                pread(fd, &entry, sizeof(entry),
+                      reinterpret_cast<uintptr_t>(page) / page_size *
+                      sizeof(entry)) == sizeof(entry) &&
+                (entry & PagemapSoftDirty);
+            if (fd >= 0)
+                close(fd);
+        }
+        munmap(page, page_size);
+        return set;
+    }();
+    return supported;
+}
+
+void
+WriteTracker::collect()
+{
+    const uint64_t page_size = sysconf(_SC_PAGE_SIZE);
+    int fd = open("/proc/self/pagemap", O_RDONLY | O_CLOEXEC);
+    panic_if(fd < 0, "Can't open /proc/self/pagemap: %s\n",
+             std::strerror(errno));
+
+    const uint64_t first_page =
+        reinterpret_cast<uintptr_t>(data) / page_size;
+    const uint64_t num_pages = divCeil(size, page_size);
+    std::vector<uint64_t> entries(std::min<uint64_t>(num_pages, 65536));
+    for (uint64_t page = 0; page < num_pages; page += entries.size()) {
+        const uint64_t count =
+            std::min<uint64_t>(entries.size(), num_pages - page);
+        const ssize_t len = count * sizeof(uint64_t);
+        panic_if(pread(fd, entries.data(), len,
+                       (first_page + page) * sizeof(uint64_t)) != len,
+                 "Can't read /proc/self/pagemap: %s\n",
+                 std::strerror(errno));
+        for (uint64_t i = 0; i < count; i++) {
+            if (entries[i] & PagemapSoftDirty)
+                pending[(page + i) * page_size / ChunkSize] = true;
+        }
+    }
+    close(fd);
+}
+
+bool
+WriteTracker::takeWritten(std::vector<bool> &written)
+{
+    if (!supported())
+        return false;
+
+    std::lock_guard<std::mutex> lock(trackersLock);
+    for (auto *tracker : trackers)
+        tracker->collect();
+    panic_if(!clearSoftDirty(), "Can't clear soft-dirty bits: %s\n",
+             std::strerror(errno));
+
+    written.swap(pending);
+    pending.assign(written.size(), false);
+    const bool known = started;
+    started = true;
+    return known;
+}
+
+LazyLoader::LazyLoader(std::unique_ptr<Reader> _reader, uint8_t *dst)
+    : reader(std::move(_reader)), dst(dst),
+      length(roundUp(reader->size(), (uint64_t)sysconf(_SC_PAGE_SIZE))),
+      uffd(-1), stopFd(-1), filled(reader->numChunks(), false),
+      numFilled(0), chunkBuf(ChunkSize)
+{
+}
+
+std::unique_ptr<LazyLoader>
+LazyLoader::create(std::unique_ptr<Reader> reader, uint8_t *dst)
+{
+    std::unique_ptr<LazyLoader> loader(
+        new LazyLoader(std::move(reader), dst));
+    if (!loader->start(true))
+        return nullptr;
+    return loader;
+}
+
+LazyLoader::~LazyLoader()
+{
+    stop();
+}
+
+void
+LazyLoader::notifyFork()
+{
+    // The child has neither the fault handling thread nor the
+    // registration of the store, but it does have every chunk filled in
+    // before the fork, so handle the faults on the remaining ones anew.
+    if (uffd >= 0)
+        close(uffd);
+    if (stopFd >= 0)
+        close(stopFd);
+    uffd = stopFd = -1;
+    handlerDone = std::future<void>();
+
+    fatal_if(!start(false), "Failed to restart lazy restore of physical "
+             "memory after fork\n");
+}
+
+#if defined(__linux__)
+
+bool
+LazyLoader::start(bool discard)
+{
+    uffd = syscall(__NR_userfaultfd, O_CLOEXEC | O_NONBLOCK);
+#if defined(USERFAULTFD_IOC_NEW)
+    if (uffd < 0) {
+        int dev = open("/dev/userfaultfd", O_RDWR | O_CLOEXEC);
+        if (dev >= 0) {
+            uffd = ioctl(dev, USERFAULTFD_IOC_NEW, O_CLOEXEC | O_NONBLOCK);
+            close(dev);
+        }
+    }
+#endif
+    if (uffd < 0)
+        return false;
+
+    uffdio_api api = {};
+    api.api = UFFD_API;
+    uffdio_register reg = {};
+    reg.range.start = reinterpret_cast<uintptr_t>(dst);
+    reg.range.len = length;
+    reg.mode = UFFDIO_REGISTER_MODE_MISSING;
+    const uint64_t needed = (uint64_t(1) << _UFFDIO_COPY) |
+        (uint64_t(1) << _UFFDIO_ZEROPAGE) | (uint64_t(1) << _UFFDIO_WAKE);
+
+    // Only pages that are not populated fault, so drop them all first
+    if (ioctl(uffd, UFFDIO_API, &api) != 0 ||
+        (discard && madvise(dst, length, MADV_DONTNEED) != 0) ||
+        ioctl(uffd, UFFDIO_REGISTER, &reg) != 0 ||
+        (reg.ioctls & needed) != needed) {
+        close(uffd);
+        uffd = -1;
+        return false;
+    }
+
+    stopFd = eventfd(0, EFD_CLOEXEC);
+    fatal_if(stopFd < 0, "Failed to create eventfd: %s\n",
+             std::strerror(errno));
+
+    // The thread is detached, since a forked child must be able to
+    // forget about it
+    std::promise<void> done;
+    handlerDone = done.get_future();
+    std::thread([this, done = std::move(done)]() mutable {
+        handleFaults();
+        done.set_value();
+    }).detach();
+    return true;
+}
+
+void
+LazyLoader::stop()
+{
+    if (uffd < 0)
+        return;
+
+    const uint64_t one = 1;
+    fatal_if(::write(stopFd, &one, sizeof(one)) != sizeof(one),
+             "Failed to stop lazy restore of physical memory\n");
+    handlerDone.wait();
+
+    // Closing the descriptor unregisters the store
+    close(uffd);
+    close(stopFd);
+    uffd = stopFd = -1;
+}
+
+void
+LazyLoader::handleFaults()
+{
+    pollfd fds[2] = {{uffd, POLLIN, 0}, {stopFd, POLLIN, 0}};
+    while (true) {
+        if (poll(fds, 2, -1) < 0) {
+            panic_if(errno != EINTR, "poll on userfaultfd failed: %s\n",
+                     std::strerror(errno));
+            continue;
+        }
+        if (fds[1].revents)
+            return;
+
+        uffd_msg msg;
+        if (read(uffd, &msg, sizeof(msg)) != sizeof(msg)) {
+            panic_if(errno != EAGAIN && errno != EINTR,
+                     "read from userfaultfd failed: %s\n",
+                     std::strerror(errno));
+            continue;
+        }
+
+        if (msg.event == UFFD_EVENT_PAGEFAULT) {
+            const uint64_t offset =
+                msg.arg.pagefault.address - reinterpret_cast<uintptr_t>(dst);
+            fillChunk(offset / ChunkSize);
+        }
+    }
+}
+
+bool
+LazyLoader::fillRange(uintptr_t addr, uint64_t len, const uint8_t *src)
+{
+    int ret;
+    if (src) {
+        uffdio_copy copy = {};
+        copy.dst = addr;
+        copy.src = reinterpret_cast<uintptr_t>(src);
+        copy.len = len;
+        copy.mode = UFFDIO_COPY_MODE_DONTWAKE;
+        while ((ret = ioctl(uffd, UFFDIO_COPY, &copy)) != 0 &&
+               errno == EAGAIN) {
+            const uint64_t done = std::max<int64_t>(copy.copy, 0);
+            copy.dst += done;
+            copy.src += done;
+            copy.len -= done;
+        }
+    } else {
+        uffdio_zeropage zero = {};
+        zero.range.start = addr;
+        zero.range.len = len;
+        zero.mode = UFFDIO_ZEROPAGE_MODE_DONTWAKE;
+        while ((ret = ioctl(uffd, UFFDIO_ZEROPAGE, &zero)) != 0 &&
+               errno == EAGAIN) {
+            const uint64_t done = std::max<int64_t>(zero.zeropage, 0);
+            zero.range.start += done;
+            zero.range.len -= done;
+        }
+    }
+
+    panic_if(ret != 0 && errno != EEXIST,
+             "Failed to fill in physical memory: %s\n",
+             std::strerror(errno));
+    return ret == 0;
+}
+
+void
+LazyLoader::fillChunk(uint64_t idx)
+{
+    const uintptr_t start = reinterpret_cast<uintptr_t>(dst) +
+        idx * ChunkSize;
+    const uint64_t len = std::min(ChunkSize, length - idx * ChunkSize);
+    uffdio_range range = {start, len};
+
+    // Faults on a chunk that is filled in already were raised before it
+    // was, the threads that took them only need waking up
+    if (filled[idx]) {
+        panic_if(ioctl(uffd, UFFDIO_WAKE, &range) != 0,
+                 "UFFDIO_WAKE failed: %s\n", std::strerror(errno));
+        return;
+    }
+
+    const uint8_t *src = nullptr;
+    if (reader->presentPages(idx)) {
+        std::fill(chunkBuf.begin(), chunkBuf.end(), 0);
+        reader->readChunk(idx, chunkBuf.data());
+        src = chunkBuf.data();
+    }
+
+    // Fill in the whole chunk at once. If some of its pages are
+    // populated already, which makes that fail, fill in the others one
+    // by one.
+    if (!fillRange(start, len, src)) {
+        const uint64_t page_size = sysconf(_SC_PAGE_SIZE);
+        for (uint64_t off = 0; off < len; off += page_size)
+            fillRange(start + off, page_size, src ? src + off : nullptr);
+    }
+
+    // Count the chunk once it is filled in, but before the threads that
+    // faulted on it are woken up
+    filled[idx] = true;
+    numFilled++;
+    panic_if(ioctl(uffd, UFFDIO_WAKE, &range) != 0,
+             "UFFDIO_WAKE failed: %s\n", std::strerror(errno));
+}
+
+#else
+
+bool
+LazyLoader::start(bool discard)
+{
+    return false;
+}
+
+void
+LazyLoader::stop()
+{
+}
+
+#endif
+
+} // namespace chunked_store
+} // namespace memory
+} // namespace gem5
@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_CHUNKED_STORE_HH__
+#define __MEM_CHUNKED_STORE_HH__
+
+#include <atomic>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace gem5
+{
+
+namespace memory
+{
+
+/**
+ * Chunked backing store checkpoint files.
+ *
+ * The store is split into fixed-size chunks of PagesPerChunk pages. A
+ * table at the start of the file holds, for every chunk, a bitmap of
+ * the pages that are not all zeros and the location of its payload,
+ * which is made of those pages only, optionally compressed. Zero pages
+ * and chunks therefore take no space, chunks can be encoded and decoded
+ * independently by a number of threads, and any chunk can be read
+ * without reading the rest of the file.
+ *
+ * Chunks that are complete and stored uncompressed are page aligned in
+ * the file, so that they can be mapped straight into the backing store
+ * when it is restored.
+ *
+ * A delta file only holds the chunks that changed since another
+ * checkpoint of the same store, its parent, and refers to the parent
+ * for the others. Parents can be deltas themselves, and readers resolve
+ * the whole chain.
+ */
+namespace chunked_store
+{
+
+/** Page size used by the presence bitmaps, independent of the host. */
+constexpr uint64_t PageSize = 4096;
+constexpr unsigned PagesPerChunk = 64;
+constexpr uint64_t ChunkSize = PageSize * PagesPerChunk;
+
+/**
+ * Write size bytes of data to a chunked file at path. The file is
+ * written under a temporary name and renamed when complete, so that an
+ * existing file at path is never modified in place (it may be mapped by
+ * a store restored from it).
+ *
+ * @param compress Compress the chunks with zlib at its fastest level.
+ * @param threads Number of threads to use, 0 to use all host cores.
+ */
+void write(const std::string &path, const uint8_t *data, uint64_t size,
+           bool compress, unsigned threads);
+
+/**
+ * Like write(), but only store the chunks that differ from those in the
+ * chunked file at parent_path and refer to it for the others. The
+ * parent is referred to by its path relative to the new file, so a
+ * directory holding a chain of checkpoints can be moved as a whole.
+ *
+ * @param written Chunks written since the parent was taken or restored,
+ *                or nullptr to compare every chunk with the parent.
+ */
+void writeDelta(const std::string &path, const uint8_t *data,
+                uint64_t size, bool compress, unsigned threads,
+                const std::string &parent_path,
+                const std::vector<bool> *written);
+
+/** Check whether the file at path is a chunked file. */
+bool isChunkedFile(const std::string &path);
+
+class Reader
+{
+  public:
+    /** Open the chunked file at path; any error is fatal. */
+    explicit Reader(const std::string &path);
+    ~Reader();
+
+    Reader(const Reader &) = delete;
+    Reader &operator=(const Reader &) = delete;
+
+    /** Size of the store the file was written from. */
+    uint64_t size() const { return _size; }
+    uint64_t numChunks() const { return table.size(); }
+
+    /** Bitmap of the pages of chunk idx that are not all zeros. */
+    uint64_t presentPages(uint64_t idx) const;
+
+    /** Number of delta files between this one and a full one. */
+    unsigned depth() const { return parent ? parent->depth() + 1 : 0; }
+
+    /**
+     * Copy the pages of chunk idx that are not all zeros to dst, which
+     * points to the start of the chunk in the store. Other pages are
+     * left untouched. Safe to call from several threads at once.
+     */
+    void readChunk(uint64_t idx, uint8_t *dst) const;
+
+    /**
+     * Restore the whole store to dst, which is expected to be zero
+     * filled, using the given number of threads (0 to use all host
+     * cores). If allow_map is set, chunks are mapped where possible
+     * rather than read.
+     */
+    void readAll(uint8_t *dst, unsigned threads, bool allow_map) const;
+
+    /** On-disk description of a chunk. */
+    struct ChunkEntry
+    {
+        /** File offset of the payload. */
+        uint64_t offset;
+        /** Pages stored in the payload, one bit per page. */
+        uint64_t present;
+        /** Payload length in bytes. */
+        uint32_t length;
+        /** Codec of the payload. */
+        uint32_t codec;
+    };
+
+  private:
+    /** Length of chunk idx, the last chunk may be short. */
+    uint64_t chunkLength(uint64_t idx) const;
+
+    /** The file of the chain that stores chunk idx. */
+    const Reader &owner(uint64_t idx) const;
+
+    /** Read chunk idx, which must be stored in this file. */
+    void readOwnChunk(uint64_t idx, uint8_t *dst) const;
+
+    /**
+     * Whether chunk idx, which must be stored in this file, can be
+     * mapped into a store at dst.
+     */
+    bool mappable(uint64_t idx, const uint8_t *dst) const;
+
+    const std::string path;
+    int fd;
+    uint64_t _size;
+    std::vector<ChunkEntry> table;
+    /** The parent of a delta file. */
+    std::unique_ptr<Reader> parent;
+};
+
+/**
+ * Finds the chunks of a store the host wrote to between checkpoints,
+ * using the soft-dirty bits of the host's page tables. These see the
+ * writes of the simulator, of the kernel on its behalf and of KVM
+ * guests, which go through the same page tables, alike. Writes by
+ * other processes to shared stores are not seen.
+ *
+ * Starting an interval clears the soft-dirty bits of the whole process,
+ * so the trackers of all stores collect the bits set so far first.
+ */
+class WriteTracker
+{
+  public:
+    WriteTracker(const uint8_t *data, uint64_t size);
+    ~WriteTracker();
+
+    WriteTracker(const WriteTracker &) = delete;
+    WriteTracker &operator=(const WriteTracker &) = delete;
+
+    /** Whether the host supports soft-dirty bits. */
+    static bool supported();
+
+    /**
+     * Get the chunks written since the previous call and start a new
+     * interval.
+     *
+     * @return False if that is not known, i.e., on the first call or if
+     * the host does not support tracking writes.
+     */
+    bool takeWritten(std::vector<bool> &written);
+
+  private:
+    /** Add the chunks written in the current interval to pending. */
+    void collect();
+
+    const uint8_t *const data;
+    const uint64_t size;
+    std::vector<bool> pending;
+    bool started;
+};
+
+/**
+ * Restores a store from a chunked file on demand: the chunks are filled
+ * in when any of their pages is first accessed, by the host or by the
+ * kernel on its behalf (e.g., KVM), so restoring only costs time for
+ * the part of the store that is used.
+ *
+ * This uses userfaultfd, which needs a Linux host that allows the
+ * simulator to use it (see vm.unprivileged_userfaultfd and
+ * /dev/userfaultfd).
+ */
+class LazyLoader
+{
+  public:
+    /**
+     * Start restoring the store at dst on demand. Any data the store
+     * holds is discarded.
+     *
+     * @return The loader, or nullptr if the host does not support it.
+     */
+    static std::unique_ptr<LazyLoader>
+    create(std::unique_ptr<Reader> reader, uint8_t *dst);
+
+    /**
+     * Stop filling in chunks. Parts of the store that were never
+     * accessed read as zeros afterwards.
+     */
+    ~LazyLoader();
+
+    LazyLoader(const LazyLoader &) = delete;
+    LazyLoader &operator=(const LazyLoader &) = delete;
+
+    /**
+     * Continue filling in the store of a forked child process, which
+     * neither inherits the parent's fault handling nor its thread.
+     */
+    void notifyFork();
+
+    /** Number of chunks filled in so far. */
+    uint64_t chunksFilled() const { return numFilled; }
+
+  private:
+    LazyLoader(std::unique_ptr<Reader> reader, uint8_t *dst);
+
+    bool start(bool discard);
+    void stop();
+    void handleFaults();
+    void fillChunk(uint64_t idx);
+    /**
+     * Fill in len bytes at addr from src, or with zeros if src is null,
+     * without waking up the threads that faulted on them.
+     *
+     * @return false if part of the range is populated already.
+     */
+    bool fillRange(uintptr_t addr, uint64_t len, const uint8_t *src);
+
+    std::unique_ptr<Reader> reader;
+    uint8_t *const dst;
+    /** Length of the store, rounded up to host pages. */
+    const uint64_t length;
+
+    int uffd;
+    int stopFd;
+    /** Ready once the fault handling thread has exited. */
+    std::future<void> handlerDone;
+
+    /** Chunks filled in, only used by the fault handling thread. */
+    std::vector<bool> filled;
+    std::atomic<uint64_t> numFilled;
+    /** Chunk-sized buffer to decode chunks to. */
+    std::vector<uint8_t> chunkBuf;
+};
+
+} // namespace chunked_store
+} // namespace memory
+} // namespace gem5
+
+#endif // __MEM_CHUNKED_STORE_HH__
@@ -0,0 +1,357 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "mem/chunked_store.hh"
+
+using namespace gem5::memory;
+
+namespace
+{
+
+/**
+ * A store with a mix of zero chunks, complete chunks of random
+ * (incompressible) data, complete chunks of compressible data, and
+ * chunks with only some of their pages present.
+ */
+std::vector<uint8_t>
+makeStore(uint64_t size)
+{
+    std::vector<uint8_t> store(size, 0);
+    std::mt19937_64 rng(1);
+    const uint64_t chunk_size = chunked_store::ChunkSize;
+    const uint64_t page_size = chunked_store::PageSize;
+
+    for (uint64_t start = 0; start < size; start += chunk_size) {
+        const uint64_t len = std::min(chunk_size, size - start);
+        switch ((start / chunk_size) % 4) {
+          case 0:
+            break;
+          case 1:
+            for (uint64_t i = 0; i < len; i++)
+                store[start + i] = rng();
+            break;
+          case 2:
+            for (uint64_t i = 0; i < len; i++)
+                store[start + i] = i / 64;
+            break;
+          case 3:
+            for (uint64_t page = 0; page * page_size < len; page += 3)
+                store[start + page * page_size + page] = page + 1;
+            break;
+        }
+    }
+    return store;
+}
+
+std::string
+tempFile()
+{
+    return testing::TempDir() + "chunked_store_test." +
+        std::to_string(getpid()) + ".pmem";
+}
+
+void
+roundTrip(uint64_t size, bool compress, unsigned threads, bool map)
+{
+    const std::vector<uint8_t> store = makeStore(size);
+    const std::string path = tempFile();
+    chunked_store::write(path, store.data(), size, compress, threads);
+    ASSERT_TRUE(chunked_store::isChunkedFile(path));
+
+    chunked_store::Reader reader(path);
+    ASSERT_EQ(reader.size(), size);
+    ASSERT_EQ(reader.numChunks(),
+              (size + chunked_store::ChunkSize - 1) /
+              chunked_store::ChunkSize);
+
+    const uint64_t map_size = reader.numChunks() * chunked_store::ChunkSize;
+    if (map_size == 0) {
+        unlink(path.c_str());
+        return;
+    }
+    EXPECT_EQ(reader.presentPages(0), 0);
+    EXPECT_EQ(reader.presentPages(1), ~uint64_t(0));
+
+    // Restore into an anonymous mapping, like a backing store
+    void *mem = mmap(nullptr, map_size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(mem, MAP_FAILED);
+    auto *restored = static_cast<uint8_t *>(mem);
+    reader.readAll(restored, threads, map);
+    EXPECT_EQ(std::memcmp(restored, store.data(), size), 0);
+
+    // Mapped chunks are private, writing to them leaves the file intact
+    std::memset(restored, 0xff, map_size);
+    std::vector<uint8_t> again(map_size, 0);
+    reader.readAll(again.data(), threads, false);
+    EXPECT_EQ(std::memcmp(again.data(), store.data(), size), 0);
+
+    munmap(mem, map_size);
+    unlink(path.c_str());
+}
+
+} // anonymous namespace
+
+TEST(ChunkedStoreTest, Compressed)
+{
+    roundTrip(40 * chunked_store::ChunkSize, true, 4, true);
+}
+
+TEST(ChunkedStoreTest, Uncompressed)
+{
+    roundTrip(40 * chunked_store::ChunkSize, false, 1, false);
+}
+
+TEST(ChunkedStoreTest, UncompressedMapped)
+{
+    roundTrip(40 * chunked_store::ChunkSize, false, 3, true);
+}
+
+TEST(ChunkedStoreTest, PartialLastChunk)
+{
+    roundTrip(10 * chunked_store::ChunkSize + 5 * chunked_store::PageSize +
+              100, true, 2, true);
+}
+
+TEST(ChunkedStoreTest, Empty)
+{
+    roundTrip(0, true, 0, true);
+}
+
+TEST(ChunkedStoreTest, LegacyFileIsNotChunked)
+{
+    const std::string path = tempFile();
+    FILE *f = fopen(path.c_str(), "wb");
+    ASSERT_NE(f, nullptr);
+    fputs("not a chunked file", f);
+    fclose(f);
+    EXPECT_FALSE(chunked_store::isChunkedFile(path));
+    unlink(path.c_str());
+}
+
+TEST(ChunkedStoreTest, HeaderIsLittleEndian)
+{
+    const uint64_t size = 3 * chunked_store::ChunkSize;
+    const std::vector<uint8_t> store = makeStore(size);
+    const std::string path = tempFile();
+    chunked_store::write(path, store.data(), size, true, 1);
+
+    // The magic is followed by the version, page size, pages per chunk
+    // and flags, each 4 bytes, then the store size
+    uint8_t header[32];
+    FILE *f = fopen(path.c_str(), "rb");
+    ASSERT_NE(f, nullptr);
+    ASSERT_EQ(fread(header, 1, sizeof(header), f), sizeof(header));
+    fclose(f);
+    unlink(path.c_str());
+
+    const uint8_t version[4] = {1, 0, 0, 0};
+    EXPECT_EQ(std::memcmp(header + 8, version, sizeof(version)), 0);
+    uint64_t stored_size = 0;
+    for (int i = 7; i >= 0; i--)
+        stored_size = (stored_size << 8) | header[24 + i];
+    EXPECT_EQ(stored_size, size);
+}
+
+TEST(ChunkedStoreTest, LazyLoad)
+{
+    const uint64_t chunk_size = chunked_store::ChunkSize;
+    const uint64_t size = 12 * chunk_size;
+    const std::vector<uint8_t> store = makeStore(size);
+    const std::string path = tempFile();
+    chunked_store::write(path, store.data(), size, true, 2);
+
+    void *mem = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(mem, MAP_FAILED);
+    auto *restored = static_cast<uint8_t *>(mem);
+    // Whatever the store holds is discarded
+    std::memset(restored, 0xaa, size);
+
+    auto loader = chunked_store::LazyLoader::create(
+        std::make_unique<chunked_store::Reader>(path), restored);
+    if (!loader) {
+        munmap(mem, size);
+        unlink(path.c_str());
+        GTEST_SKIP() << "userfaultfd is not available";
+    }
+    EXPECT_EQ(loader->chunksFilled(), 0);
+
+    // An access fills in the chunk it falls in
+    EXPECT_EQ(restored[5 * chunk_size + 7], store[5 * chunk_size + 7]);
+    EXPECT_EQ(loader->chunksFilled(), 1);
+    restored[5 * chunk_size + 7]++;
+
+    // So does an access by the kernel
+    int fds[2];
+    ASSERT_EQ(pipe(fds), 0);
+    ASSERT_EQ(write(fds[1], restored + 9 * chunk_size, 4096), 4096);
+    std::vector<uint8_t> buf(4096);
+    ASSERT_EQ(read(fds[0], buf.data(), buf.size()), 4096);
+    EXPECT_EQ(std::memcmp(buf.data(), &store[9 * chunk_size], 4096), 0);
+    EXPECT_EQ(loader->chunksFilled(), 2);
+    close(fds[0]);
+    close(fds[1]);
+
+    // A forked child continues from where the parent was
+    pid_t pid = fork();
+    ASSERT_GE(pid, 0);
+    if (pid == 0) {
+        loader->notifyFork();
+        bool ok = restored[5 * chunk_size + 7] ==
+            uint8_t(store[5 * chunk_size + 7] + 1);
+        restored[5 * chunk_size + 7]--;
+        ok = ok && std::memcmp(restored, store.data(), size) == 0;
+        _exit(ok ? 0 : 1);
+    }
+    int status;
+    ASSERT_EQ(waitpid(pid, &status, 0), pid);
+    EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+
+    restored[5 * chunk_size + 7]--;
+    EXPECT_EQ(std::memcmp(restored, store.data(), size), 0);
+    EXPECT_EQ(loader->chunksFilled(), 12);
+
+    loader.reset();
+    munmap(mem, size);
+    unlink(path.c_str());
+}
+
+TEST(ChunkedStoreTest, DeltaChain)
+{
+    const uint64_t chunk_size = chunked_store::ChunkSize;
+    const uint64_t size = 16 * chunk_size + 100;
+    std::vector<uint8_t> store = makeStore(size);
+
+    const std::string dir = testing::TempDir() + "chunked_store_test." +
+        std::to_string(getpid());
+    ASSERT_EQ(mkdir(dir.c_str(), 0775), 0);
+    const std::string full = dir + "/full.pmem";
+    const std::string delta1 = dir + "/delta1.pmem";
+    const std::string delta2 = dir + "/delta2.pmem";
+    chunked_store::write(full, store.data(), size, true, 2);
+
+    // Without knowing what was written, chunks are compared with the
+    // parent and only the ones that differ are stored
+    store[1 * chunk_size + 10]++;
+    std::memset(&store[6 * chunk_size], 0, chunk_size);
+    chunked_store::writeDelta(delta1, store.data(), size, true, 2, full,
+                              nullptr);
+    std::vector<uint8_t> delta1_store = store;
+
+    // Otherwise, only the chunks written are stored
+    store[3 * chunk_size] = 42;
+    store[16 * chunk_size + 99] = 1;
+    std::vector<bool> written(17, false);
+    written[3] = written[16] = true;
+    chunked_store::writeDelta(delta2, store.data(), size, false, 2, delta1,
+                              &written);
+
+    struct stat full_stat, delta_stat;
+    ASSERT_EQ(stat(full.c_str(), &full_stat), 0);
+    ASSERT_EQ(stat(delta2.c_str(), &delta_stat), 0);
+    EXPECT_LT(delta_stat.st_size, full_stat.st_size / 4);
+
+    // The chain is found relative to the delta, so it can be moved
+    const std::string moved = dir + ".moved";
+    ASSERT_EQ(rename(dir.c_str(), moved.c_str()), 0);
+
+    for (bool map : {false, true}) {
+        chunked_store::Reader reader(moved + "/delta2.pmem");
+        EXPECT_EQ(reader.depth(), 2);
+        EXPECT_EQ(reader.size(), size);
+        EXPECT_EQ(reader.presentPages(6), 0);
+        EXPECT_EQ(reader.presentPages(5), ~uint64_t(0));
+
+        const uint64_t map_size = reader.numChunks() * chunk_size;
+        void *mem = mmap(nullptr, map_size, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        ASSERT_NE(mem, MAP_FAILED);
+        reader.readAll(static_cast<uint8_t *>(mem), 2, map);
+        EXPECT_EQ(std::memcmp(mem, store.data(), size), 0);
+        munmap(mem, map_size);
+    }
+
+    chunked_store::Reader reader1(moved + "/delta1.pmem");
+    EXPECT_EQ(reader1.depth(), 1);
+    std::vector<uint8_t> restored(reader1.numChunks() * chunk_size, 0);
+    reader1.readAll(restored.data(), 1, false);
+    EXPECT_EQ(std::memcmp(restored.data(), delta1_store.data(), size), 0);
+
+    unlink((moved + "/full.pmem").c_str());
+    unlink((moved + "/delta1.pmem").c_str());
+    unlink((moved + "/delta2.pmem").c_str());
+    rmdir(moved.c_str());
+}
+
+TEST(ChunkedStoreTest, WriteTracker)
+{
+    if (!chunked_store::WriteTracker::supported())
+        GTEST_SKIP() << "soft-dirty bits are not available";
+
+    const uint64_t chunk_size = chunked_store::ChunkSize;
+    const uint64_t size = 8 * chunk_size;
+    void *mem = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    ASSERT_NE(mem, MAP_FAILED);
+    auto *store = static_cast<uint8_t *>(mem);
+    std::memset(store, 1, size);
+
+    chunked_store::WriteTracker tracker(store, size);
+    chunked_store::WriteTracker other(store + 4 * chunk_size, chunk_size);
+    std::vector<bool> written;
+    EXPECT_FALSE(tracker.takeWritten(written));
+
+    store[2 * chunk_size + 5] = 2;
+    store[4 * chunk_size] = 2;
+    // Starting an interval for another store does not lose any writes
+    EXPECT_FALSE(other.takeWritten(written));
+    store[7 * chunk_size + 1] = 2;
+
+    ASSERT_TRUE(tracker.takeWritten(written));
+    EXPECT_EQ(written, std::vector<bool>(
+        {false, false, true, false, true, false, false, true}));
+    ASSERT_TRUE(tracker.takeWritten(written));
+    EXPECT_EQ(written, std::vector<bool>(8, false));
+
+    munmap(mem, size);
+}
@@ -58,6 +58,7 @@
 #include "base/extensible.hh"
 #include "base/flags.hh"
 #include "base/logging.hh"
+#include "base/pool_alloc.hh"
 #include "base/printable.hh"
 #include "base/types.hh"
 #include "mem/htm.hh"
@@ -297,6 +298,12 @@ class Packet : public Printable, public Extensible<Packet>
     typedef uint32_t FlagsType;
     typedef gem5::Flags<FlagsType> Flags;
 
+    /**
+     * Data payloads up to this size, i.e. up to a typical cache line,
+     * are allocated from a slab pool rather than the heap.
+     */
+    static constexpr unsigned PooledPayloadSize = 64;
+
   private:
     enum : FlagsType
     {
@@ -353,6 +360,10 @@ class Packet : public Printable, public Extensible<Packet>
         /// the packet is destroyed. The pointer is assumed to be pointing
         /// to an array, and delete [] is consequently called
         DYNAMIC_DATA           = 0x00002000,
+        /// The data pointer points to a buffer taken from the payload
+        /// pool, which is returned to the pool when the packet is
+        /// destroyed. Always set together with DYNAMIC_DATA.
+        POOLED_DATA            = 0x00004000,
 
         /// suppress the error if this packet encounters a functional
         /// access failure.
@@ -1054,6 +1065,27 @@ class Packet : public Printable, public Extensible<Packet>
         deleteData();
     }
 
+    /**
+     * Packets are allocated from, and recycled through, the slab pool
+     * of the calling thread unless pooling is disabled.
+     */
+    static void *
+    operator new(size_t size)
+    {
+        if (size == sizeof(Packet) && SlabPool::enabled())
+            return threadSlabPool<sizeof(Packet)>().allocate();
+        return ::operator new(size);
+    }
+
+    static void
+    operator delete(void *p, size_t size)
+    {
+        if (size == sizeof(Packet) && SlabPool::enabled())
+            threadSlabPool<sizeof(Packet)>().deallocate(p);
+        else
+            ::operator delete(p);
+    }
+
     /**
      * Take a request packet and modify it in place to be suitable for
      * returning as a response to that request.
@@ -1355,10 +1387,12 @@ class Packet : public Printable, public Extensible<Packet>
     void
     deleteData()
     {
-        if (flags.isSet(DYNAMIC_DATA))
+        if (flags.isSet(POOLED_DATA))
+            threadSlabPool<PooledPayloadSize>().deallocate(data);
+        else if (flags.isSet(DYNAMIC_DATA))
             delete [] data;
 
-        flags.clear(STATIC_DATA|DYNAMIC_DATA);
+        flags.clear(STATIC_DATA|DYNAMIC_DATA|POOLED_DATA);
         data = NULL;
     }
 
@@ -1371,7 +1405,13 @@ class Packet : public Printable, public Extensible<Packet>
         if (hasData() || hasRespData()) {
             assert(flags.noneSet(STATIC_DATA|DYNAMIC_DATA));
             flags.set(DYNAMIC_DATA);
-            data = new uint8_t[getSize()];
+            if (getSize() <= PooledPayloadSize && SlabPool::enabled()) {
+                flags.set(POOLED_DATA);
+                data = static_cast<uint8_t *>(
+                    threadSlabPool<PooledPayloadSize>().allocate());
+            } else {
+                data = new uint8_t[getSize()];
+            }
         }
     }
 
@@ -47,14 +47,17 @@
 #include <cerrno>
 #include <climits>
 #include <cstdio>
+#include <filesystem>
 #include <iostream>
 #include <string>
+#include <vector>
 
 #include "base/intmath.hh"
 #include "base/trace.hh"
 #include "debug/AddrRanges.hh"
 #include "debug/Checkpoint.hh"
 #include "mem/abstract_mem.hh"
+#include "mem/chunked_store.hh"
 #include "sim/serialize.hh"
 #include "sim/sim_exit.hh"
 
@@ -80,10 +83,20 @@ PhysicalMemory::PhysicalMemory(const std::string& _name,
                                const std::vector<AbstractMemory*>& _memories,
                                bool mmap_using_noreserve,
                                const std::string& shared_backstore,
-                               bool auto_unlink_shared_backstore) :
+                               bool auto_unlink_shared_backstore,
+                               enums::PmemCheckpointFormat checkpoint_format,
+                               bool checkpoint_compress,
+                               unsigned checkpoint_threads,
+                               bool lazy_restore,
+                               bool checkpoint_delta,
+                               unsigned checkpoint_max_delta_chain) :
     _name(_name), size(0), mmapUsingNoReserve(mmap_using_noreserve),
     sharedBackstore(shared_backstore), sharedBackstoreSize(0),
-    pageSize(sysconf(_SC_PAGE_SIZE))
+    pageSize(sysconf(_SC_PAGE_SIZE)), checkpointFormat(checkpoint_format),
+    checkpointCompress(checkpoint_compress),
+    checkpointThreads(checkpoint_threads), lazyRestore(lazy_restore),
+    checkpointDelta(checkpoint_delta),
+    checkpointMaxDeltaChain(checkpoint_max_delta_chain)
 {
     // Register cleanup callback if requested.
     if (auto_unlink_shared_backstore && !sharedBackstore.empty()) {
@@ -253,6 +266,7 @@ PhysicalMemory::createBackingStore(
     backingStore.emplace_back(range, pmem,
                               conf_table_reported, in_addr_map, kvm_map,
                               shm_fd, map_offset);
+    deltaParents.resize(backingStore.size());
 
     // point the memories to their backing store
     for (const auto& m : _memories) {
@@ -264,6 +278,11 @@ PhysicalMemory::createBackingStore(
 
 PhysicalMemory::~PhysicalMemory()
 {
+    // stop filling in stores and tracking writes to them before they go
+    // away
+    lazyLoaders.clear();
+    deltaParents.clear();
+
     // unmap the backing store
     for (auto& s : backingStore)
         munmap((char*)s.pmem, s.range.size());
@@ -367,6 +386,8 @@ PhysicalMemory::serializeStore(CheckpointOut &cp, unsigned int store_id,
     // memories that are not part of the address map can overlap
     std::string filename =
         name() + ".store" + std::to_string(store_id) + ".pmem";
+    if (checkpointFormat == enums::chunked)
+        filename += "c";
     long range_size = range.size();
 
     DPRINTF(Checkpoint, "Serializing physical memory %s with size %d\n",
@@ -376,8 +397,16 @@ PhysicalMemory::serializeStore(CheckpointOut &cp, unsigned int store_id,
     SERIALIZE_SCALAR(filename);
     SERIALIZE_SCALAR(range_size);
 
-    // write memory file
     std::string filepath = CheckpointIn::dir() + "/" + filename.c_str();
+
+    if (checkpointFormat == enums::chunked) {
+        std::string format = "chunked";
+        SERIALIZE_SCALAR(format);
+        writeChunkedStore(store_id, filepath);
+        return;
+    }
+
+    // write memory file
     gzFile compressed_mem = gzopen(filepath.c_str(), "wb");
     if (compressed_mem == NULL)
         fatal("Can't open physical memory checkpoint file '%s'\n",
@@ -443,6 +472,16 @@ PhysicalMemory::unserializeStore(CheckpointIn &cp)
     UNSERIALIZE_SCALAR(filename);
     std::string filepath = cp.getCptDir() + "/" + filename;
 
+    // Checkpoints without a format use the legacy gzip format
+    std::string format = "gzip";
+    optParamIn(cp, "format", format, false);
+    if (format == "chunked") {
+        unserializeChunkedStore(cp, store_id, filepath);
+        return;
+    }
+    fatal_if(format != "gzip",
+             "Unknown physical memory checkpoint format '%s'\n", format);
+
     // mmap memoryfile
     gzFile compressed_mem = gzopen(filepath.c_str(), "rb");
     if (compressed_mem == NULL)
@@ -491,5 +530,116 @@ PhysicalMemory::unserializeStore(CheckpointIn &cp)
               filename);
 }
 
+void
+PhysicalMemory::unserializeChunkedStore(CheckpointIn &cp,
+                                        unsigned int store_id,
+                                        const std::string &filepath)
+{
+    const BackingStoreEntry &store = backingStore[store_id];
+
+    long range_size;
+    UNSERIALIZE_SCALAR(range_size);
+
+    DPRINTF(Checkpoint, "Unserializing chunked physical memory %s with "
+            "size %d\n", filepath, range_size);
+
+    if (range_size != store.range.size())
+        fatal("Memory range size has changed! Saw %lld, expected %lld\n",
+              range_size, store.range.size());
+
+    auto reader = std::make_unique<chunked_store::Reader>(filepath);
+    fatal_if(reader->size() != range_size,
+             "Physical memory checkpoint file '%s' has the wrong size\n",
+             filepath);
+    const unsigned depth = reader->depth();
+
+    // Neither restoring lazily nor mapping the file into the store work
+    // for stores shared with other processes
+    const bool shared = store.shmFd != -1;
+    std::unique_ptr<chunked_store::LazyLoader> loader;
+    if (lazyRestore && !shared) {
+        loader = chunked_store::LazyLoader::create(std::move(reader),
+                                                   store.pmem);
+        if (!loader) {
+            warn_once("Lazy restore of physical memory is not supported "
+                      "by the host, restoring eagerly\n");
+            reader = std::make_unique<chunked_store::Reader>(filepath);
+        }
+    }
+
+    if (loader)
+        lazyLoaders.push_back(std::move(loader));
+    else
+        reader->readAll(store.pmem, checkpointThreads, !shared);
+
+    if (checkpointDelta)
+        setDeltaParent(store_id, filepath, depth);
+}
+
+void
+PhysicalMemory::writeChunkedStore(unsigned int store_id,
+                                  const std::string &filepath) const
+{
+    const BackingStoreEntry &store = backingStore[store_id];
+    if (!checkpointDelta) {
+        chunked_store::write(filepath, store.pmem, store.range.size(),
+                             checkpointCompress, checkpointThreads);
+        return;
+    }
+
+    const std::string path =
+        std::filesystem::absolute(filepath).lexically_normal();
+    DeltaParent &parent = deltaParents[store_id];
+
+    // Write a full checkpoint if there is no parent, if the chain is long
+    // enough, or if the parent is about to be replaced
+    if (parent.path.empty() || parent.depth >= checkpointMaxDeltaChain ||
+        parent.path == path || !chunked_store::isChunkedFile(parent.path)) {
+        chunked_store::write(filepath, store.pmem, store.range.size(),
+                             checkpointCompress, checkpointThreads);
+        setDeltaParent(store_id, path, 0);
+        return;
+    }
+
+    // Without tracking, the chunks are compared with the parent instead
+    std::vector<bool> written;
+    const bool tracked =
+        parent.tracker && parent.tracker->takeWritten(written);
+    DPRINTF(Checkpoint, "Writing delta of %s to %s, %s\n", parent.path,
+            path, tracked ? "tracked" : "comparing");
+    chunked_store::writeDelta(filepath, store.pmem, store.range.size(),
+                              checkpointCompress, checkpointThreads,
+                              parent.path, tracked ? &written : nullptr);
+    setDeltaParent(store_id, path, parent.depth + 1);
+}
+
+void
+PhysicalMemory::setDeltaParent(unsigned int store_id,
+                               const std::string &filepath,
+                               unsigned depth) const
+{
+    DeltaParent &parent = deltaParents[store_id];
+    parent.path = std::filesystem::absolute(filepath).lexically_normal();
+    parent.depth = depth;
+
+    // Writes by other processes to shared stores are not tracked, so
+    // their deltas always compare the chunks
+    if (backingStore[store_id].shmFd != -1)
+        return;
+    if (!parent.tracker) {
+        parent.tracker = std::make_unique<chunked_store::WriteTracker>(
+            backingStore[store_id].pmem, backingStore[store_id].range.size());
+    }
+    std::vector<bool> written;
+    parent.tracker->takeWritten(written);
+}
+
+void
+PhysicalMemory::notifyFork()
+{
+    for (auto &loader : lazyLoaders)
+        loader->notifyFork();
+}
+
 } // namespace memory
 } // namespace gem5
@@ -39,11 +39,13 @@
 #define __MEM_PHYSICAL_HH__
 
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <vector>
 
 #include "base/addr_range.hh"
 #include "base/addr_range_map.hh"
+#include "enums/PmemCheckpointFormat.hh"
 #include "mem/packet.hh"
 #include "sim/serialize.hh"
 
@@ -58,6 +60,12 @@ namespace memory
  */
 class AbstractMemory;
 
+namespace chunked_store
+{
+class LazyLoader;
+class WriteTracker;
+} // namespace chunked_store
+
 /**
  * A single entry for the backing store.
  */
@@ -158,6 +166,34 @@ class PhysicalMemory : public Serializable
 
     long pageSize;
 
+    // How to checkpoint the backing stores
+    const enums::PmemCheckpointFormat checkpointFormat;
+    const bool checkpointCompress;
+    const unsigned checkpointThreads;
+    const bool lazyRestore;
+    const bool checkpointDelta;
+    const unsigned checkpointMaxDeltaChain;
+
+    // Backing stores restored lazily, which are filled in on demand for
+    // as long as their loader exists
+    std::vector<std::unique_ptr<chunked_store::LazyLoader>> lazyLoaders;
+
+    /**
+     * The checkpoint of a backing store that the next delta checkpoint
+     * refers to, i.e., the last one taken or restored.
+     */
+    struct DeltaParent
+    {
+        /** Absolute path of its file, empty if there is none. */
+        std::string path;
+        /** Number of deltas between it and a full checkpoint. */
+        unsigned depth = 0;
+        /** Tracks the writes to the store since it was taken. */
+        std::unique_ptr<chunked_store::WriteTracker> tracker;
+    };
+    // Indexed by store id, updated when serializing
+    mutable std::vector<DeltaParent> deltaParents;
+
     // The physical memory used to provide the memory in the simulated
     // system
     std::vector<BackingStoreEntry> backingStore;
@@ -191,7 +227,14 @@ class PhysicalMemory : public Serializable
                    const std::vector<AbstractMemory*>& _memories,
                    bool mmap_using_noreserve,
                    const std::string& shared_backstore,
-                   bool auto_unlink_shared_backstore);
+                   bool auto_unlink_shared_backstore,
+                   enums::PmemCheckpointFormat checkpoint_format=
+                       enums::gzip,
+                   bool checkpoint_compress=true,
+                   unsigned checkpoint_threads=0,
+                   bool lazy_restore=false,
+                   bool checkpoint_delta=false,
+                   unsigned checkpoint_max_delta_chain=0);
 
     /**
      * Unmap all the backing store we have used.
@@ -296,6 +339,32 @@ class PhysicalMemory : public Serializable
      */
     void unserializeStore(CheckpointIn &cp);
 
+    /**
+     * Unserialize a backing store from a chunked file.
+     */
+    void unserializeChunkedStore(CheckpointIn &cp, unsigned int store_id,
+                                 const std::string &filepath);
+
+    /**
+     * Write a backing store to a chunked file, as a delta of the
+     * previous checkpoint if enabled and possible.
+     */
+    void writeChunkedStore(unsigned int store_id,
+                           const std::string &filepath) const;
+
+    /**
+     * Make the checkpoint at filepath the parent of the next delta
+     * checkpoint of a store, and track the writes to the store from
+     * now on.
+     */
+    void setDeltaParent(unsigned int store_id, const std::string &filepath,
+                        unsigned depth) const;
+
+    /**
+     * Continue restoring lazily restored stores in a forked child.
+     */
+    void notifyFork();
+
 };
 
 } // namespace memory
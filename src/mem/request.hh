@@ -54,12 +54,14 @@
 #include <functional>
 #include <limits>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include "base/amo.hh"
 #include "base/compiler.hh"
 #include "base/extensible.hh"
 #include "base/flags.hh"
+#include "base/pool_alloc.hh"
 #include "base/types.hh"
 #include "cpu/inst_seq.hh"
 #include "mem/htm.hh"
@@ -523,6 +525,20 @@ class Request : public Extensible<Request>
 
     ~Request() {}
 
+    /**
+     * Create a new request, forwarding the arguments to the matching
+     * constructor. The request and its reference count are allocated
+     * together from the slab pool of the calling thread, so this
+     * should be preferred over std::make_shared.
+     */
+    template <typename... Args>
+    static RequestPtr
+    create(Args&&... args)
+    {
+        return std::allocate_shared<Request>(PoolAllocator<Request>(),
+                                             std::forward<Args>(args)...);
+    }
+
     /**
      * Factory method for creating memory management requests, with
      * unspecified addr and size.
@@ -530,7 +546,7 @@ class Request : public Extensible<Request>
     static RequestPtr
     createMemManagement(Flags flags, RequestorID id)
     {
-        auto mgmt_req = std::make_shared<Request>();
+        auto mgmt_req = Request::create();
         mgmt_req->_flags.set(flags);
         mgmt_req->_requestorId = id;
         mgmt_req->_time = curTick();
@@ -612,8 +628,8 @@ class Request : public Extensible<Request>
         assert(hasVaddr());
         assert(!hasPaddr());
         assert(split_addr > _vaddr && split_addr < _vaddr + _size);
-        req1 = std::make_shared<Request>(*this);
-        req2 = std::make_shared<Request>(*this);
+        req1 = Request::create(*this);
+        req2 = Request::create(*this);
         req1->_size = split_addr - _vaddr;
         req2->_vaddr = split_addr;
         req2->_size = _size - req1->_size;
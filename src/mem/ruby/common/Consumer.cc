@@ -49,8 +49,28 @@ namespace ruby
 Consumer::Consumer(ClockedObject *_em, Event::Priority ev_prio)
     : m_wakeup_event([this]{ processCurrentEvent(); },
                     "Consumer Event", false, ev_prio),
-      em(_em)
-{ }
+      em(_em), m_track_order(false), m_wakeup_order(0)
+{
+    consumers.insert(this);
+}
+
+Consumer::~Consumer()
+{
+    consumers.erase(this);
+}
+
+uint64_t Consumer::wakeupCounter = 0;
+std::unordered_set<Consumer *> Consumer::consumers;
+
+bool
+Consumer::anyWakeupPending()
+{
+    for (const auto *consumer : consumers) {
+        if (consumer->m_wakeup_event.scheduled())
+            return true;
+    }
+    return false;
+}
 
 void
 Consumer::scheduleEvent(Cycles timeDelta)
@@ -75,10 +95,15 @@ Consumer::scheduleNextWakeup()
     if (it != m_wakeup_ticks.end()) {
         Tick when = *it;
         assert(when >= em->clockEdge());
-        if (m_wakeup_event.scheduled() && (when < m_wakeup_event.when()))
+        if (m_wakeup_event.scheduled() && (when < m_wakeup_event.when())) {
             em->reschedule(m_wakeup_event, when, true);
-        else if (!m_wakeup_event.scheduled())
+            if (m_track_order)
+                m_wakeup_order = ++wakeupCounter;
+        } else if (!m_wakeup_event.scheduled()) {
             em->schedule(m_wakeup_event, when);
+            if (m_track_order)
+                m_wakeup_order = ++wakeupCounter;
+        }
     }
 }
 
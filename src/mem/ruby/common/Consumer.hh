@@ -47,8 +47,10 @@
 #ifndef __MEM_RUBY_COMMON_CONSUMER_HH__
 #define __MEM_RUBY_COMMON_CONSUMER_HH__
 
+#include <cstdint>
 #include <iostream>
 #include <set>
+#include <unordered_set>
 
 #include "sim/clocked_object.hh"
 
@@ -64,9 +66,7 @@ class Consumer
     Consumer(ClockedObject *em,
              Event::Priority ev_prio = Event::Default_Pri);
 
-    virtual
-    ~Consumer()
-    { }
+    virtual ~Consumer();
 
     virtual void wakeup() = 0;
     virtual void print(std::ostream& out) const = 0;
@@ -87,10 +87,35 @@ class Consumer
     void scheduleEventAbsolute(Tick timeAbs);
     void scheduleEvent(Cycles timeDelta);
 
+    // Tick of the pending wakeup event, or MaxTick if there is none
+    Tick
+    wakeupTick() const
+    {
+        return m_wakeup_event.scheduled() ? m_wakeup_event.when() : MaxTick;
+    }
+
+    // Record when the wakeup event is put on the event queue, relative to
+    // the other consumers that do, e.g., for garnet's parallel routers.
+    void trackWakeupOrder() { m_track_order = true; }
+
+    // When the pending wakeup event was put on the event queue, if
+    // tracked. Of two events at the same tick and priority the one put on
+    // the queue last runs first.
+    uint64_t wakeupOrder() const { return m_wakeup_order; }
+
+    // Whether the wakeup event of any consumer is pending, i.e., whether
+    // Ruby has work left to do
+    static bool anyWakeupPending();
+
   private:
     std::set<Tick> m_wakeup_ticks;
     EventFunctionWrapper m_wakeup_event;
     ClockedObject *em;
+    bool m_track_order;
+    uint64_t m_wakeup_order;
+
+    static uint64_t wakeupCounter;
+    static std::unordered_set<Consumer *> consumers;
 
     void scheduleNextWakeup();
     void processCurrentEvent();
@@ -58,7 +58,9 @@ namespace ruby
 using stl_helpers::operator<<;
 
 MessageBuffer::MessageBuffer(const Params &p)
-    : SimObject(p), m_stall_map_size(0), m_max_size(p.buffer_size),
+    : SimObject(p), m_msg_queue(p.timing_wheel),
+    m_stall_msg_map(p.timing_wheel), m_stall_map_size(0),
+    m_max_size(p.buffer_size),
     m_max_dequeue_rate(p.max_dequeue_rate), m_dequeues_this_cy(0),
     m_time_last_time_size_checked(0),
     m_time_last_time_enqueue(0), m_time_last_time_pop(0),
@@ -138,7 +140,7 @@ MessageBuffer::getSize(Tick curTime)
 {
     if (m_time_last_time_size_checked != curTime) {
         m_time_last_time_size_checked = curTime;
-        m_size_last_time_size_checked = m_prio_heap.size();
+        m_size_last_time_size_checked = m_msg_queue.size();
     }
 
     return m_size_last_time_size_checked;
@@ -162,7 +164,7 @@ MessageBuffer::areNSlotsAvailable(unsigned int n, Tick current_time)
 
     if (m_time_last_time_pop < current_time) {
         // no pops this cycle - heap and stall queue size is correct
-        current_size = m_prio_heap.size();
+        current_size = m_msg_queue.size();
         current_stall_size = m_stall_map_size;
     } else {
         if (m_time_last_time_enqueue < current_time) {
@@ -185,7 +187,7 @@ MessageBuffer::areNSlotsAvailable(unsigned int n, Tick current_time)
         DPRINTF(RubyQueue, "n: %d, current_size: %d, heap size: %d, "
                 "m_max_size: %d\n",
                 n, current_size + current_stall_size,
-                m_prio_heap.size(), m_max_size);
+                m_msg_queue.size(), m_max_size);
         m_not_avail_count++;
         return false;
     }
@@ -195,7 +197,7 @@ const Message*
 MessageBuffer::peek() const
 {
     DPRINTF(RubyQueue, "Peeking at head of queue.\n");
-    const Message* msg_ptr = m_prio_heap.front().get();
+    const Message* msg_ptr = m_msg_queue.front().get();
     assert(msg_ptr);
 
     DPRINTF(RubyQueue, "Message: %s\n", (*msg_ptr));
@@ -282,14 +284,13 @@ MessageBuffer::enqueue(MsgPtr message, Tick current_time, Tick delta,
     msg_ptr->setLastEnqueueTime(arrival_time);
     msg_ptr->setMsgCounter(m_msg_counter);
 
-    // Insert the message into the priority heap
-    m_prio_heap.push_back(message);
-    push_heap(m_prio_heap.begin(), m_prio_heap.end(), std::greater<MsgPtr>());
+    // Insert the message into the message queue
+    m_msg_queue.push(message, delta);
     // Increment the number of messages statistic
     m_buf_msgs++;
 
     assert((m_max_size == 0) ||
-           ((m_prio_heap.size() + m_stall_map_size) <= m_max_size));
+           ((m_msg_queue.size() + m_stall_map_size) <= m_max_size));
 
     DPRINTF(RubyQueue, "Enqueue arrival_time: %lld, Message: %s\n",
             arrival_time, *(message.get()));
@@ -307,7 +308,7 @@ MessageBuffer::dequeue(Tick current_time, bool decrement_messages)
     assert(isReady(current_time));
 
     // get MsgPtr of the message about to be dequeued
-    MsgPtr message = m_prio_heap.front();
+    MsgPtr message = m_msg_queue.front();
 
     // get the delay cycles
     message->updateDelayedTicks(current_time);
@@ -316,15 +317,14 @@ MessageBuffer::dequeue(Tick current_time, bool decrement_messages)
     // record previous size and time so the current buffer size isn't
     // adjusted until schd cycle
     if (m_time_last_time_pop < current_time) {
-        m_size_at_cycle_start = m_prio_heap.size();
+        m_size_at_cycle_start = m_msg_queue.size();
         m_stalled_at_cycle_start = m_stall_map_size;
         m_time_last_time_pop = current_time;
         m_dequeues_this_cy = 0;
     }
     ++m_dequeues_this_cy;
 
-    pop_heap(m_prio_heap.begin(), m_prio_heap.end(), std::greater<MsgPtr>());
-    m_prio_heap.pop_back();
+    m_msg_queue.pop();
     if (decrement_messages) {
         // Record how much time is passed since the message was enqueued
         m_stall_time += curTick() - message->getLastEnqueueTime();
@@ -358,7 +358,7 @@ MessageBuffer::unregisterDequeueCallback()
 void
 MessageBuffer::clear()
 {
-    m_prio_heap.clear();
+    m_msg_queue.clear();
 
     m_msg_counter = 0;
     m_time_last_time_enqueue = 0;
@@ -373,14 +373,13 @@ MessageBuffer::recycle(Tick current_time, Tick recycle_latency)
 {
     DPRINTF(RubyQueue, "Recycling.\n");
     assert(isReady(current_time));
-    MsgPtr node = m_prio_heap.front();
-    pop_heap(m_prio_heap.begin(), m_prio_heap.end(), std::greater<MsgPtr>());
+    MsgPtr node = m_msg_queue.front();
+    m_msg_queue.pop();
 
     Tick future_time = current_time + recycle_latency;
     node->setLastEnqueueTime(future_time);
 
-    m_prio_heap.back() = node;
-    push_heap(m_prio_heap.begin(), m_prio_heap.end(), std::greater<MsgPtr>());
+    m_msg_queue.push(node, recycle_latency);
     m_consumer->scheduleEventAbsolute(future_time);
 }
 
@@ -391,9 +390,7 @@ MessageBuffer::reanalyzeList(std::list<MsgPtr> &lt, Tick schdTick)
         MsgPtr m = lt.front();
         assert(m->getLastEnqueueTime() <= schdTick);
 
-        m_prio_heap.push_back(m);
-        push_heap(m_prio_heap.begin(), m_prio_heap.end(),
-                  std::greater<MsgPtr>());
+        m_msg_queue.push(m);
 
         m_consumer->scheduleEventAbsolute(schdTick);
 
@@ -412,7 +409,7 @@ MessageBuffer::reanalyzeMessages(Addr addr, Tick current_time)
 
     //
     // Put all stalled messages associated with this address back on the
-    // prio heap.  The reanalyzeList call will make sure the consumer is
+    // message queue.  The reanalyzeList call will make sure the consumer is
     // scheduled for the current cycle so that the previously stalled messages
     // will be observed before any younger messages that may arrive this cycle
     //
@@ -429,16 +426,15 @@ MessageBuffer::reanalyzeAllMessages(Tick current_time)
 
     //
     // Put all stalled messages associated with this address back on the
-    // prio heap.  The reanalyzeList call will make sure the consumer is
+    // message queue.  The reanalyzeList call will make sure the consumer is
     // scheduled for the current cycle so that the previously stalled messages
     // will be observed before any younger messages that may arrive this cycle.
     //
-    for (StallMsgMapType::iterator map_iter = m_stall_msg_map.begin();
-         map_iter != m_stall_msg_map.end(); ++map_iter) {
-        m_stall_map_size -= map_iter->second.size();
+    m_stall_msg_map.forEach([&](std::list<MsgPtr> &msgs) {
+        m_stall_map_size -= msgs.size();
         assert(m_stall_map_size >= 0);
-        reanalyzeList(map_iter->second, current_time);
-    }
+        reanalyzeList(msgs, current_time);
+    });
     m_stall_msg_map.clear();
 }
 
@@ -448,7 +444,7 @@ MessageBuffer::stallMessage(Addr addr, Tick current_time)
     DPRINTF(RubyQueue, "Stalling due to %#x\n", addr);
     assert(isReady(current_time));
     assert(getOffset(addr) == 0);
-    MsgPtr message = m_prio_heap.front();
+    MsgPtr message = m_msg_queue.front();
 
     // Since the message will just be moved to stall map, indicate that the
     // buffer should not decrement the m_buf_msgs statistic
@@ -508,9 +504,7 @@ MessageBuffer::print(std::ostream& out) const
         ccprintf(out, " consumer-yes ");
     }
 
-    std::vector<MsgPtr> copy(m_prio_heap);
-    std::sort_heap(copy.begin(), copy.end(), std::greater<MsgPtr>());
-    ccprintf(out, "%s] %s", copy, name());
+    ccprintf(out, "%s] %s", m_msg_queue.sorted(), name());
 }
 
 bool
@@ -520,8 +514,8 @@ MessageBuffer::isReady(Tick current_time) const
     bool can_dequeue = (m_max_dequeue_rate == 0) ||
                        (m_time_last_time_pop < current_time) ||
                        (m_dequeues_this_cy < m_max_dequeue_rate);
-    bool is_ready = (m_prio_heap.size() > 0) &&
-                   (m_prio_heap.front()->getLastEnqueueTime() <= current_time);
+    bool is_ready = !m_msg_queue.empty() &&
+                   (m_msg_queue.front()->getLastEnqueueTime() <= current_time);
     if (!can_dequeue && is_ready) {
         // Make sure the Consumer executes next cycle to dequeue the ready msg
         m_consumer->scheduleEvent(Cycles(1));
@@ -532,10 +526,10 @@ MessageBuffer::isReady(Tick current_time) const
 Tick
 MessageBuffer::readyTime() const
 {
-    if (m_prio_heap.empty())
+    if (m_msg_queue.empty())
         return MaxTick;
     else
-        return m_prio_heap.front()->getLastEnqueueTime();
+        return m_msg_queue.front()->getLastEnqueueTime();
 }
 
 uint32_t
@@ -546,36 +540,40 @@ MessageBuffer::functionalAccess(Packet *pkt, bool is_read, WriteMask *mask)
 
     uint32_t num_functional_accesses = 0;
 
-    // Check the priority heap and write any messages that may
+    // Check the message queue and write any messages that may
     // correspond to the address in the packet.
-    for (unsigned int i = 0; i < m_prio_heap.size(); ++i) {
-        Message *msg = m_prio_heap[i].get();
+    bool read_done = false;
+    m_msg_queue.forEach([&](const MsgPtr &msg_ptr) {
+        Message *msg = msg_ptr.get();
+        if (read_done)
+            return;
         if (is_read && !mask && msg->functionalRead(pkt))
-            return 1;
+            read_done = true;
         else if (is_read && mask && msg->functionalRead(pkt, *mask))
             num_functional_accesses++;
         else if (!is_read && msg->functionalWrite(pkt))
             num_functional_accesses++;
-    }
+    });
+    if (read_done)
+        return 1;
 
     // Check the stall queue and write any messages that may
     // correspond to the address in the packet.
-    for (StallMsgMapType::iterator map_iter = m_stall_msg_map.begin();
-         map_iter != m_stall_msg_map.end();
-         ++map_iter) {
-
-        for (std::list<MsgPtr>::iterator it = (map_iter->second).begin();
-            it != (map_iter->second).end(); ++it) {
-
-            Message *msg = (*it).get();
+    m_stall_msg_map.forEach([&](std::list<MsgPtr> &msgs) {
+        for (const MsgPtr &msg_ptr : msgs) {
+            Message *msg = msg_ptr.get();
+            if (read_done)
+                return;
             if (is_read && !mask && msg->functionalRead(pkt))
-                return 1;
+                read_done = true;
             else if (is_read && mask && msg->functionalRead(pkt, *mask))
                 num_functional_accesses++;
             else if (!is_read && msg->functionalWrite(pkt))
                 num_functional_accesses++;
         }
-    }
+    });
+    if (read_done)
+        return 1;
 
     return num_functional_accesses;
 }
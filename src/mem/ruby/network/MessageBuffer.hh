@@ -50,6 +50,8 @@
 #include <cassert>
 #include <functional>
 #include <iostream>
+#include <list>
+#include <map>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -60,6 +62,7 @@
 #include "mem/port.hh"
 #include "mem/ruby/common/Address.hh"
 #include "mem/ruby/common/Consumer.hh"
+#include "mem/ruby/network/MessageQueue.hh"
 #include "mem/ruby/network/dummy_port.hh"
 #include "mem/ruby/slicc_interface/Message.hh"
 #include "params/MessageBuffer.hh"
@@ -92,10 +95,8 @@ class MessageBuffer : public SimObject
     void
     delayHead(Tick current_time, Tick delta)
     {
-        MsgPtr m = m_prio_heap.front();
-        std::pop_heap(m_prio_heap.begin(), m_prio_heap.end(),
-                      std::greater<MsgPtr>());
-        m_prio_heap.pop_back();
+        MsgPtr m = m_msg_queue.front();
+        m_msg_queue.pop();
         enqueue(m, current_time, delta);
     }
 
@@ -121,7 +122,7 @@ class MessageBuffer : public SimObject
     //! message queue.  The function assumes that the queue is nonempty.
     const Message* peek() const;
 
-    const MsgPtr &peekMsgPtr() const { return m_prio_heap.front(); }
+    const MsgPtr &peekMsgPtr() const { return m_msg_queue.front(); }
 
     void enqueue(MsgPtr message, Tick curTime, Tick delta,
                 bool bypassStrictFIFO = false);
@@ -146,7 +147,7 @@ class MessageBuffer : public SimObject
     void unregisterDequeueCallback();
 
     void recycle(Tick current_time, Tick recycle_latency);
-    bool isEmpty() const { return m_prio_heap.size() == 0; }
+    bool isEmpty() const { return m_msg_queue.empty(); }
     bool isStallMapEmpty() { return m_stall_msg_map.size() == 0; }
     unsigned int getStallMapSize() { return m_stall_msg_map.size(); }
 
@@ -202,25 +203,89 @@ class MessageBuffer : public SimObject
     // Data Members (m_ prefix)
     //! Consumer to signal a wakeup(), can be NULL
     Consumer* m_consumer;
-    std::vector<MsgPtr> m_prio_heap;
+    MessageQueue m_msg_queue;
 
     std::function<void()> m_dequeue_callback;
 
-    // use a std::map for the stalled messages as this container is
-    // sorted and ensures a well-defined iteration order
-    typedef std::map<Addr, std::list<MsgPtr> > StallMsgMapType;
+    /**
+     * The stalled messages by line address. By default they are kept in a
+     * std::map, which is sorted and ensures a well-defined iteration order.
+     * With the timing wheel they are kept in a hash map instead, which is
+     * cheaper to look up. Its iteration order is then unspecified, which
+     * does not change the dequeue order: reanalyzed messages keep their
+     * arrival time and enqueue order, by which the message queue sorts
+     * them.
+     */
+    class StallMsgMapType
+    {
+      public:
+        explicit StallMsgMapType(bool hashed) : hashed(hashed) {}
+
+        std::list<MsgPtr> &
+        operator[](Addr addr)
+        {
+            return hashed ? unorderedMap[addr] : orderedMap[addr];
+        }
+
+        std::size_t
+        count(Addr addr) const
+        {
+            return hashed ? unorderedMap.count(addr) : orderedMap.count(addr);
+        }
+
+        void
+        erase(Addr addr)
+        {
+            if (hashed)
+                unorderedMap.erase(addr);
+            else
+                orderedMap.erase(addr);
+        }
+
+        std::size_t
+        size() const
+        {
+            return hashed ? unorderedMap.size() : orderedMap.size();
+        }
+
+        void
+        clear()
+        {
+            unorderedMap.clear();
+            orderedMap.clear();
+        }
+
+        /** Call f(msgs) on the stalled messages of every line. */
+        template<typename F>
+        void
+        forEach(F &&f)
+        {
+            if (hashed) {
+                for (auto &line : unorderedMap)
+                    f(line.second);
+            } else {
+                for (auto &line : orderedMap)
+                    f(line.second);
+            }
+        }
+
+      private:
+        const bool hashed;
+        std::map<Addr, std::list<MsgPtr>> orderedMap;
+        std::unordered_map<Addr, std::list<MsgPtr>> unorderedMap;
+    };
 
     /**
      * A map from line addresses to lists of stalled messages for that line.
      * If this buffer allows the receiver to stall messages, on a stall
-     * request, the stalled message is removed from the m_prio_heap and placed
+     * request, the stalled message is removed from the m_msg_queue and placed
      * in the m_stall_msg_map. Messages are held there until the receiver
      * requests they be reanalyzed, at which point they are moved back to
-     * m_prio_heap.
+     * m_msg_queue.
      *
      * NOTE: The stall map holds messages in the order in which they were
      * initially received, and when a line is unblocked, the messages are
-     * moved back to the m_prio_heap in the same order. This prevents starving
+     * moved back to the m_msg_queue in the same order. This prevents starving
      * older requests with younger ones.
      */
     StallMsgMapType m_stall_msg_map;
@@ -237,7 +302,7 @@ class MessageBuffer : public SimObject
      * Current size of the stall map.
      * Track the number of messages held in stall map lists. This is used to
      * ensure that if the buffer is finite-sized, it blocks further requests
-     * when the m_prio_heap and m_stall_msg_map contain m_max_size messages.
+     * when the m_msg_queue and m_stall_msg_map contain m_max_size messages.
      */
     int m_stall_map_size;
 
@@ -82,6 +82,12 @@ class MessageBuffer(SimObject):
                                           be dequeued per cycle \
                                     (0 allows dequeueing all ready messages)",
     )
+    timing_wheel = Param.Bool(
+        False,
+        "Bucket pending messages by enqueue latency instead of keeping "
+        "them in a single heap. Enqueueing with one of a few fixed "
+        "latencies is then O(1); the dequeue order is unchanged.",
+    )
     routing_priority = Param.Int(
         0,
         "Buffer priority when messages are \
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/ruby/network/MessageQueue.hh"
+
+#include <algorithm>
+#include <functional>
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+MessageQueue::MessageQueue(bool timing_wheel)
+    : timingWheel(timing_wheel)
+{
+    if (timingWheel)
+        buckets.reserve(MaxBuckets);
+}
+
+void
+MessageQueue::push(const MsgPtr &msg, Tick latency)
+{
+    if (!timingWheel) {
+        pushHeap(msg);
+        return;
+    }
+
+    const int num_buckets = buckets.size();
+    int idx = 0;
+    for (; idx < num_buckets; idx++) {
+        if (buckets[idx].latency == latency)
+            break;
+    }
+
+    if (idx == num_buckets) {
+        if (idx == MaxBuckets) {
+            pushHeap(msg);
+            return;
+        }
+        buckets.push_back(Bucket{latency, {}});
+    }
+
+    auto &msgs = buckets[idx].msgs;
+    if (!msgs.empty() && msgs.back() > msg) {
+        // Would break the FIFO order of the bucket
+        pushHeap(msg);
+        return;
+    }
+
+    msgs.push_back(msg);
+    numMsgs++;
+    updateHead(idx, msg);
+}
+
+void
+MessageQueue::push(const MsgPtr &msg)
+{
+    pushHeap(msg);
+}
+
+void
+MessageQueue::pushHeap(const MsgPtr &msg)
+{
+    heap.push_back(msg);
+    std::push_heap(heap.begin(), heap.end(), std::greater<MsgPtr>());
+    numMsgs++;
+    updateHead(HeapHead, heap.front());
+}
+
+void
+MessageQueue::updateHead(int source, const MsgPtr &msg)
+{
+    if (head == NoHead || front() > msg)
+        head = source;
+}
+
+void
+MessageQueue::pop()
+{
+    assert(!empty());
+    if (head == HeapHead) {
+        std::pop_heap(heap.begin(), heap.end(), std::greater<MsgPtr>());
+        heap.pop_back();
+    } else {
+        buckets[head].msgs.pop_front();
+    }
+    numMsgs--;
+    findHead();
+}
+
+void
+MessageQueue::findHead()
+{
+    head = NoHead;
+    const int num_buckets = buckets.size();
+    for (int idx = 0; idx < num_buckets; idx++) {
+        if (!buckets[idx].msgs.empty())
+            updateHead(idx, buckets[idx].msgs.front());
+    }
+    if (!heap.empty())
+        updateHead(HeapHead, heap.front());
+}
+
+void
+MessageQueue::clear()
+{
+    buckets.clear();
+    heap.clear();
+    numMsgs = 0;
+    head = NoHead;
+}
+
+std::vector<MsgPtr>
+MessageQueue::sorted() const
+{
+    std::vector<MsgPtr> msgs;
+    msgs.reserve(numMsgs);
+    forEach([&](const MsgPtr &msg) { msgs.push_back(msg); });
+    std::sort(msgs.begin(), msgs.end(), std::greater<MsgPtr>());
+    return msgs;
+}
+
+} // namespace ruby
+} // namespace gem5
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_RUBY_NETWORK_MESSAGEQUEUE_HH__
+#define __MEM_RUBY_NETWORK_MESSAGEQUEUE_HH__
+
+#include <cassert>
+#include <deque>
+#include <vector>
+
+#include "base/types.hh"
+#include "mem/ruby/slicc_interface/Message.hh"
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+/**
+ * The pending messages of a MessageBuffer, ordered by arrival time and,
+ * for equal arrival times, by enqueue order (see operator> on MsgPtr).
+ *
+ * By default this is a binary heap, which costs O(log n) per enqueue and
+ * dequeue. When built as a timing wheel, messages are instead bucketed by
+ * the latency they were enqueued with. Since the current time never goes
+ * backwards, every message enqueued with the same latency arrives no
+ * earlier than the previous one, so each bucket is a plain FIFO that is
+ * appended to in O(1). Protocols only use a handful of distinct
+ * latencies, and the head of the queue is the oldest of the bucket heads.
+ *
+ * Messages that do not fit that pattern (randomized arrival times,
+ * recycled or reanalyzed messages, or more distinct latencies than
+ * there are buckets) fall back to a heap, so the dequeue order is always
+ * exactly the one the heap alone would give.
+ */
+class MessageQueue
+{
+  public:
+    explicit MessageQueue(bool timing_wheel);
+
+    bool empty() const { return numMsgs == 0; }
+    std::size_t size() const { return numMsgs; }
+
+    /** The message that arrives first; the queue must not be empty. */
+    const MsgPtr &
+    front() const
+    {
+        assert(!empty());
+        return head == HeapHead ? heap.front() : buckets[head].msgs.front();
+    }
+
+    /**
+     * Insert a message that was enqueued with the given latency. The
+     * latency is only a hint used to pick a bucket.
+     */
+    void push(const MsgPtr &msg, Tick latency);
+
+    /** Insert a message without a latency hint. */
+    void push(const MsgPtr &msg);
+
+    /** Remove the message returned by front(). */
+    void pop();
+
+    void clear();
+
+    /** Call f(msg) on every message, in no particular order. */
+    template<typename F>
+    void
+    forEach(F &&f) const
+    {
+        for (const auto &bucket : buckets) {
+            for (const auto &msg : bucket.msgs)
+                f(msg);
+        }
+        for (const auto &msg : heap)
+            f(msg);
+    }
+
+    /** All messages, latest arrival first. */
+    std::vector<MsgPtr> sorted() const;
+
+  private:
+    /** Maximum number of distinct latencies given their own bucket. */
+    static constexpr int MaxBuckets = 8;
+    /** Values of head when the front message is in the heap or none. */
+    static constexpr int HeapHead = -1;
+    static constexpr int NoHead = -2;
+
+    struct Bucket
+    {
+        Tick latency;
+        std::deque<MsgPtr> msgs;
+    };
+
+    void pushHeap(const MsgPtr &msg);
+    /** Make msg the head if it arrives before the current one. */
+    void updateHead(int source, const MsgPtr &msg);
+    /** Find the head again after it has been removed. */
+    void findHead();
+
+    const bool timingWheel;
+    std::vector<Bucket> buckets;
+    std::vector<MsgPtr> heap;
+    std::size_t numMsgs = 0;
+    int head = NoHead;
+};
+
+} // namespace ruby
+} // namespace gem5
+
+#endif //__MEM_RUBY_NETWORK_MESSAGEQUEUE_HH__
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "mem/ruby/network/MessageQueue.hh"
+
+using namespace gem5;
+using namespace gem5::ruby;
+
+namespace
+{
+
+class TestMessage : public Message
+{
+  public:
+    TestMessage(Tick arrival, uint64_t counter) : Message(0)
+    {
+        setLastEnqueueTime(arrival);
+        setMsgCounter(counter);
+    }
+
+    MsgPtr
+    clone() const override
+    {
+        return std::make_shared<TestMessage>(*this);
+    }
+
+    void print(std::ostream &out) const override {}
+};
+
+MsgPtr
+makeMsg(Tick arrival, uint64_t counter)
+{
+    return std::make_shared<TestMessage>(arrival, counter);
+}
+
+/** Pop all messages of a queue, in order. */
+std::vector<MsgPtr>
+drain(MessageQueue &queue)
+{
+    std::vector<MsgPtr> msgs;
+    while (!queue.empty()) {
+        msgs.push_back(queue.front());
+        queue.pop();
+    }
+    return msgs;
+}
+
+} // anonymous namespace
+
+/** Messages leave by arrival time, and by enqueue order for ties. */
+TEST(MessageQueueTest, HeapOrder)
+{
+    MessageQueue queue(false);
+    MsgPtr a = makeMsg(30, 0);
+    MsgPtr b = makeMsg(10, 1);
+    MsgPtr c = makeMsg(30, 2);
+    MsgPtr d = makeMsg(20, 3);
+    for (const MsgPtr &msg : {a, b, c, d})
+        queue.push(msg, 0);
+
+    EXPECT_EQ(queue.size(), 4);
+    EXPECT_EQ(drain(queue), std::vector<MsgPtr>({b, d, a, c}));
+    EXPECT_TRUE(queue.empty());
+}
+
+/** Messages of one latency stay in their bucket's FIFO order. */
+TEST(MessageQueueTest, WheelBuckets)
+{
+    MessageQueue queue(true);
+    MsgPtr a = makeMsg(11, 0);
+    MsgPtr b = makeMsg(5, 1);
+    MsgPtr c = makeMsg(12, 2);
+    MsgPtr d = makeMsg(6, 3);
+    // Enqueued at ticks 1 and 2 with latencies 10 and 4.
+    queue.push(a, 10);
+    queue.push(b, 4);
+    queue.push(c, 10);
+    queue.push(d, 4);
+
+    EXPECT_EQ(queue.front(), b);
+    EXPECT_EQ(drain(queue), std::vector<MsgPtr>({b, d, a, c}));
+}
+
+/**
+ * Messages that would break a bucket's order, latencies beyond the
+ * number of buckets and pushes without a latency all fall back to the
+ * heap, without changing the order.
+ */
+TEST(MessageQueueTest, WheelFallback)
+{
+    MessageQueue queue(true);
+    std::vector<MsgPtr> expected;
+
+    // Earlier arrival than the bucket tail, e.g. a randomized latency.
+    MsgPtr late = makeMsg(100, 0);
+    MsgPtr early = makeMsg(50, 1);
+    queue.push(late, 10);
+    queue.push(early, 10);
+
+    // More distinct latencies than there are buckets.
+    std::vector<MsgPtr> many;
+    for (int i = 0; i < 20; i++) {
+        many.push_back(makeMsg(60 + i, 2 + i));
+        queue.push(many.back(), 1 + i);
+    }
+
+    // Recycled or reanalyzed messages carry no latency.
+    MsgPtr recycled = makeMsg(55, 30);
+    queue.push(recycled);
+
+    expected.push_back(early);
+    expected.push_back(recycled);
+    expected.insert(expected.end(), many.begin(), many.end());
+    expected.push_back(late);
+    EXPECT_EQ(drain(queue), expected);
+}
+
+/**
+ * A timing wheel gives exactly the heap's order for an interleaving of
+ * pushes and pops like MessageBuffer makes: mostly fixed latencies from
+ * an advancing current time, with some randomized ones.
+ */
+TEST(MessageQueueTest, WheelMatchesHeap)
+{
+    MessageQueue heap(false);
+    MessageQueue wheel(true);
+    std::mt19937 rng(1);
+    std::vector<Tick> latencies = {1, 2, 3, 5, 8, 13, 21, 34, 55, 89};
+
+    uint64_t counter = 0;
+    std::vector<MsgPtr> from_heap, from_wheel;
+    for (Tick now = 0; now < 10000; now++) {
+        for (int n = rng() % 3; n > 0; n--) {
+            Tick latency = latencies[rng() % latencies.size()];
+            if (rng() % 10 == 0)
+                latency = rng() % 100;
+            MsgPtr msg = makeMsg(now + latency, counter++);
+            heap.push(msg, latency);
+            wheel.push(msg, latency);
+        }
+
+        while (!heap.empty() &&
+               heap.front()->getLastEnqueueTime() <= now) {
+            ASSERT_FALSE(wheel.empty());
+            from_heap.push_back(heap.front());
+            from_wheel.push_back(wheel.front());
+            heap.pop();
+            wheel.pop();
+        }
+        ASSERT_EQ(heap.size(), wheel.size());
+    }
+
+    EXPECT_EQ(from_wheel, from_heap);
+    EXPECT_EQ(drain(wheel), drain(heap));
+}
+
+/** sorted() lists all messages, latest arrival first. */
+TEST(MessageQueueTest, SortedAndClear)
+{
+    MessageQueue queue(true);
+    MsgPtr a = makeMsg(3, 0);
+    MsgPtr b = makeMsg(1, 1);
+    MsgPtr c = makeMsg(2, 2);
+    queue.push(a, 3);
+    queue.push(b, 1);
+    queue.push(c);
+
+    EXPECT_EQ(queue.sorted(), std::vector<MsgPtr>({a, c, b}));
+    EXPECT_EQ(queue.size(), 3);
+
+    queue.clear();
+    EXPECT_TRUE(queue.empty());
+    queue.push(c, 7);
+    EXPECT_EQ(queue.front(), c);
+}
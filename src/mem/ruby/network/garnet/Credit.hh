@@ -34,6 +34,7 @@
 #include <cassert>
 #include <iostream>
 
+#include "base/pool_alloc.hh"
 #include "base/types.hh"
 #include "mem/ruby/network/garnet/CommonTypes.hh"
 #include "mem/ruby/network/garnet/flit.hh"
@@ -57,6 +58,23 @@ class Credit : public flit
     Credit() {};
     Credit(int vc, bool is_free_signal, Tick curTime);
 
+    static void *
+    operator new(size_t size)
+    {
+        if (size == sizeof(Credit) && SlabPool::enabled())
+            return threadSlabPool<sizeof(Credit)>().allocate();
+        return ::operator new(size);
+    }
+
+    static void
+    operator delete(void *p, size_t size)
+    {
+        if (size == sizeof(Credit) && SlabPool::enabled())
+            threadSlabPool<sizeof(Credit)>().deallocate(p);
+        else
+            ::operator delete(p);
+    }
+
     // Functions used by SerDes
     flit* serialize(int ser_id, int parts, uint32_t bWidth);
     flit* deserialize(int des_id, int num_flits, uint32_t bWidth);
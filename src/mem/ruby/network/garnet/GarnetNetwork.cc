@@ -62,7 +62,9 @@ namespace garnet
  */
 
 GarnetNetwork::GarnetNetwork(const Params &p)
-    : Network(p)
+    : Network(p), m_router_threads(p.router_threads),
+      m_router_batch_next(0), m_router_batch_eq(nullptr),
+      m_router_workers_exit(false)
 {
     m_num_rows = p.num_rows;
     m_ni_flit_size = p.ni_flit_size;
@@ -107,6 +109,11 @@ GarnetNetwork::GarnetNetwork(const Params &p)
     inform("Garnet version %s\n", garnetVersion);
 }
 
+GarnetNetwork::~GarnetNetwork()
+{
+    stopRouterWorkers();
+}
+
 void
 GarnetNetwork::init()
 {
@@ -150,6 +157,140 @@ GarnetNetwork::init()
             router->printFaultVector(std::cout);
         }
     }
+
+    if (parallelRouters()) {
+        // Routers are evaluated ahead of their events, which requires
+        // that nothing reaches a router in the cycle it is sent.
+        for (NetworkLink *link : m_networklinks) {
+            fatal_if(link->getLatency() == 0, "%s: router_threads requires "
+                     "links with a latency of at least one cycle.",
+                     link->name());
+        }
+        for (CreditLink *link : m_creditlinks) {
+            fatal_if(link->getLatency() == 0, "%s: router_threads requires "
+                     "links with a latency of at least one cycle.",
+                     link->name());
+        }
+        for (NetworkBridge *bridge : m_networkbridges) {
+            fatal_if(bridge->minLatency() == 0, "%s: router_threads "
+                     "requires bridges with a latency of at least one "
+                     "cycle.", bridge->name());
+        }
+
+        for (Router *router : m_routers) {
+            if (!router->mayRouteRandomly()) {
+                router->setParallel();
+                m_parallel_routers.push_back(router);
+            }
+        }
+    }
+}
+
+DrainState
+GarnetNetwork::drain()
+{
+    // The workers are restarted on demand, so do not keep them around
+    // while the simulator is drained (e.g., to checkpoint or fork).
+    stopRouterWorkers();
+    return DrainState::Drained;
+}
+
+/*
+ * Parallel router evaluation.
+ *
+ * Routers only exchange flits and credits through links and bridges,
+ * which delay them by at least a cycle, so nothing a router sends during
+ * a cycle reaches another router in that cycle. With router_threads set,
+ * the first router to wake up in a cycle evaluates all the routers due
+ * in that cycle, on router_threads threads. The actions of each router
+ * that other consumers can observe (sending flits and credits, waking
+ * up links, itself and its output units) are recorded, and carried out
+ * when the event of the router runs. The same is done for the wakeup
+ * events of output units that run before the event of their router, so
+ * every event of the cycle has the same effects, in the same order, as
+ * when each router is evaluated at its own event.
+ *
+ * Routers that may pick a route at random are left out: they draw from
+ * rand(), and the sequence of numbers they get depends on the order of
+ * the calls, so they are evaluated at their own events.
+ */
+
+void
+GarnetNetwork::evaluateRouters(Router *current)
+{
+    m_router_batch.clear();
+    for (Router *router : m_parallel_routers) {
+        if ((router == current || router->wakeupTick() == curTick()) &&
+            !router->evaluatedAt(curTick())) {
+            m_router_batch.push_back(router);
+        }
+    }
+
+    if (m_router_threads > 1 && m_router_batch.size() > 1) {
+        startRouterWorkers();
+        m_router_batch_eq = curEventQueue();
+        m_router_batch_next = 0;
+
+        // Release the workers, take part in the evaluation, and wait
+        // for the workers to finish
+        m_router_barrier->wait();
+        evaluateBatch();
+        m_router_barrier->wait();
+    } else {
+        for (Router *router : m_router_batch)
+            router->evaluateAhead();
+    }
+}
+
+void
+GarnetNetwork::evaluateBatch()
+{
+    const size_t num_routers = m_router_batch.size();
+    size_t idx;
+    while ((idx = m_router_batch_next.fetch_add(
+                1, std::memory_order_relaxed)) < num_routers) {
+        m_router_batch[idx]->evaluateAhead();
+    }
+}
+
+void
+GarnetNetwork::routerWorker()
+{
+    while (true) {
+        m_router_barrier->wait();
+        if (m_router_workers_exit)
+            return;
+
+        // The routers use curTick() and clockEdge()
+        curEventQueue(m_router_batch_eq);
+        evaluateBatch();
+        m_router_barrier->wait();
+    }
+}
+
+void
+GarnetNetwork::startRouterWorkers()
+{
+    if (!m_router_workers.empty())
+        return;
+
+    m_router_workers_exit = false;
+    m_router_barrier = std::make_unique<Barrier>(m_router_threads);
+    for (unsigned i = 1; i < m_router_threads; i++)
+        m_router_workers.emplace_back([this]{ routerWorker(); });
+}
+
+void
+GarnetNetwork::stopRouterWorkers()
+{
+    if (m_router_workers.empty())
+        return;
+
+    m_router_workers_exit = true;
+    m_router_barrier->wait();
+    for (auto &worker : m_router_workers)
+        worker.join();
+    m_router_workers.clear();
 }
 
 /*
@@ -603,7 +744,7 @@ GarnetNetwork::print(std::ostream& out) const
 }
 
 void
-GarnetNetwork::update_traffic_distribution(RouteInfo route)
+GarnetNetwork::update_traffic_distribution(const RouteInfo &route)
 {
     int src_node = route.src_router;
     int dest_node = route.dest_router;
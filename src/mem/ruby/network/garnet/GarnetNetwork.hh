@@ -32,9 +32,13 @@
 #ifndef __MEM_RUBY_NETWORK_GARNET_0_GARNETNETWORK_HH__
 #define __MEM_RUBY_NETWORK_GARNET_0_GARNETNETWORK_HH__
 
+#include <atomic>
 #include <iostream>
+#include <memory>
+#include <thread>
 #include <vector>
 
+#include "base/barrier.hh"
 #include "mem/ruby/network/Network.hh"
 #include "mem/ruby/network/fault_model/FaultModel.hh"
 #include "mem/ruby/network/garnet/CommonTypes.hh"
@@ -63,9 +67,10 @@ class GarnetNetwork : public Network
   public:
     typedef GarnetNetworkParams Params;
     GarnetNetwork(const Params &p);
-    ~GarnetNetwork() = default;
+    ~GarnetNetwork();
 
     void init();
+    DrainState drain() override;
 
     const char *garnetVersion = "3.0";
 
@@ -95,6 +100,11 @@ class GarnetNetwork : public Network
     int getNumRouters();
     int get_router_id(int ni, int vnet);
 
+    // Parallel router evaluation: the first router to wake up in a cycle
+    // has the network evaluate all the routers due in that cycle.
+    bool parallelRouters() const { return m_router_threads > 0; }
+    void evaluateRouters(Router *current);
+
 
     // Methods used by Topology to setup the network
     void makeExtOutLink(SwitchID src, NodeID dest, BasicLink* link,
@@ -154,7 +164,7 @@ class GarnetNetwork : public Network
         m_total_hops += hops;
     }
 
-    void update_traffic_distribution(RouteInfo route);
+    void update_traffic_distribution(const RouteInfo &route);
     int getNextPacketID() { return m_next_packet_id++; }
 
   protected:
@@ -207,6 +217,11 @@ class GarnetNetwork : public Network
     GarnetNetwork(const GarnetNetwork& obj);
     GarnetNetwork& operator=(const GarnetNetwork& obj);
 
+    void evaluateBatch();
+    void routerWorker();
+    void startRouterWorkers();
+    void stopRouterWorkers();
+
     std::vector<VNET_type > m_vnet_type;
     std::vector<Router *> m_routers;   // All Routers in Network
     std::vector<NetworkLink *> m_networklinks; // All flit links in the network
@@ -214,6 +229,16 @@ class GarnetNetwork : public Network
     std::vector<CreditLink *> m_creditlinks; // All credit links in the network
     std::vector<NetworkInterface *> m_nis;   // All NI's in Network
     int m_next_packet_id; // static vairable for packet id allocation
+
+    // Parallel router evaluation
+    unsigned m_router_threads;
+    std::vector<Router *> m_parallel_routers; // Routers evaluated ahead
+    std::vector<Router *> m_router_batch; // Routers to evaluate
+    std::atomic<size_t> m_router_batch_next;
+    EventQueue *m_router_batch_eq;
+    std::vector<std::thread> m_router_workers;
+    std::unique_ptr<Barrier> m_router_barrier;
+    bool m_router_workers_exit;
 };
 
 inline std::ostream&
@@ -52,6 +52,16 @@ class GarnetNetwork(RubyNetwork):
     garnet_deadlock_threshold = Param.UInt32(
         50000, "network-level deadlock threshold"
     )
+    router_threads = Param.Unsigned(
+        0,
+        "Number of host threads evaluating the routers woken up in a "
+        "cycle. 0 evaluates each router at its own event. Otherwise, "
+        "the routers of a cycle are evaluated together when the first "
+        "of them wakes up, with the same results as with 0. Routers "
+        "that may pick a route at random are still evaluated at their "
+        "own events. Debug output from the routers is not ordered when "
+        "more than one thread is used.",
+    )
 
 
 class GarnetNetworkInterface(ClockedObject):
@@ -31,8 +31,9 @@
 
 #include "mem/ruby/network/garnet/InputUnit.hh"
 
+#include <algorithm>
+
 #include "debug/RubyNetwork.hh"
-#include "mem/ruby/network/garnet/Credit.hh"
 #include "mem/ruby/network/garnet/Router.hh"
 
 namespace gem5
@@ -56,10 +57,15 @@ InputUnit::InputUnit(int id, PortDirection direction, Router *router)
         m_num_buffer_writes[i] = 0;
     }
 
-    // Instantiating the virtual channels
+    // Instantiating the virtual channels. Their buffers are sized for the
+    // deepest VC type up front, as credit-based flow control never lets
+    // more flits than that queue up in a VC.
+    GarnetNetwork *net_ptr = m_router->get_net_ptr();
+    const int vc_depth = std::max(net_ptr->getBuffersPerDataVC(),
+                                  net_ptr->getBuffersPerCtrlVC());
     virtualChannels.reserve(m_num_vcs);
     for (int i=0; i < m_num_vcs; i++) {
-        virtualChannels.emplace_back();
+        virtualChannels.emplace_back(vc_depth);
     }
 }
 
@@ -146,9 +152,9 @@ InputUnit::increment_credit(int in_vc, bool free_signal, Tick curTime)
 {
     DPRINTF(RubyNetwork, "Router[%d]: Sending a credit vc:%d free:%d to %s\n",
     m_router->get_id(), in_vc, free_signal, m_credit_link->name());
-    Credit *t_credit = new Credit(in_vc, free_signal, curTime);
-    creditQueue.insert(t_credit);
-    m_credit_link->scheduleEventAbsolute(m_router->clockEdge(Cycles(1)));
+    m_router->sendCredit(&creditQueue, in_vc, free_signal, curTime);
+    m_router->scheduleConsumer(m_credit_link,
+                               m_router->clockEdge(Cycles(1)));
 }
 
 bool
@@ -68,6 +68,13 @@ class NetworkBridge: public CreditLink
     void neutralize(int vc, int eCredit);
 
     void scheduleFlit(flit *t_flit, Cycles latency);
+    // Least number of cycles a flit spends in the bridge
+    Cycles
+    minLatency() const
+    {
+        return (enSerDes ? serDesLatency : Cycles(0)) +
+               (enCdc ? cdcLatency : Cycles(0));
+    }
     void flitisizeAndSend(flit *t_flit);
     void setVcsPerVnet(uint32_t consumerVcs);
 
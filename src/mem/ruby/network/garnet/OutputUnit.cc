@@ -49,7 +49,7 @@ namespace garnet
 OutputUnit::OutputUnit(int id, PortDirection direction, Router *router,
   uint32_t consumerVcs)
   : Consumer(router), m_router(router), m_id(id), m_direction(direction),
-    m_vc_per_vnet(consumerVcs)
+    m_vc_per_vnet(consumerVcs), m_ahead(MaxTick)
 {
     const int m_num_vcs = consumerVcs * m_router->get_num_vnets();
     outVcState.reserve(m_num_vcs);
@@ -131,6 +131,18 @@ OutputUnit::select_free_vc(int vnet)
 
 void
 OutputUnit::wakeup()
+{
+    if (m_ahead == curTick()) {
+        m_ahead = MaxTick;
+        m_router->applyActions(m_ahead_actions);
+        return;
+    }
+
+    receive_credit();
+}
+
+void
+OutputUnit::receive_credit()
 {
     if (m_credit_link->isReady(curTick())) {
         Credit *t_credit = (Credit*) m_credit_link->consumeLink();
@@ -139,14 +151,23 @@ OutputUnit::wakeup()
         if (t_credit->is_free_signal())
             set_vc_state(IDLE_, t_credit->get_vc(), curTick());
 
-        delete t_credit;
+        m_router->freeCredit(t_credit);
 
         if (m_credit_link->isReady(curTick())) {
-            scheduleEvent(Cycles(1));
+            m_router->scheduleConsumer(this, m_router->clockEdge(Cycles(1)));
         }
     }
 }
 
+void
+OutputUnit::wakeupAhead()
+{
+    m_router->recordActions(&m_ahead_actions);
+    receive_credit();
+    m_router->recordActions(nullptr);
+    m_ahead = curTick();
+}
+
 flitBuffer*
 OutputUnit::getOutQueue()
 {
@@ -168,8 +189,8 @@ OutputUnit::set_credit_link(CreditLink *credit_link)
 void
 OutputUnit::insert_flit(flit *t_flit)
 {
-    outBuffer.insert(t_flit);
-    m_out_link->scheduleEventAbsolute(m_router->clockEdge(Cycles(1)));
+    m_router->sendFlit(&outBuffer, t_flit);
+    m_router->scheduleConsumer(m_out_link, m_router->clockEdge(Cycles(1)));
 }
 
 bool
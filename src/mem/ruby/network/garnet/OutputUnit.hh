@@ -40,6 +40,7 @@
 #include "mem/ruby/network/garnet/CommonTypes.hh"
 #include "mem/ruby/network/garnet/NetworkLink.hh"
 #include "mem/ruby/network/garnet/OutVcState.hh"
+#include "mem/ruby/network/garnet/Router.hh"
 
 namespace gem5
 {
@@ -62,6 +63,10 @@ class OutputUnit : public Consumer
     void set_out_link(NetworkLink *link);
     void set_credit_link(CreditLink *credit_link);
     void wakeup();
+    void receive_credit();
+    // Run the wakeup of this cycle ahead of its event, for a parallel
+    // evaluation of the router
+    void wakeupAhead();
     flitBuffer* getOutQueue();
     void print(std::ostream& out) const {};
     void decrement_credit(int out_vc);
@@ -119,6 +124,10 @@ class OutputUnit : public Consumer
     flitBuffer outBuffer;
     // vc state of downstream router
     std::vector<OutVcState> outVcState;
+
+    // Cycle in which wakeupAhead() ran, and what it did
+    Tick m_ahead;
+    std::vector<Router::Action> m_ahead_actions;
 };
 
 } // namespace garnet
@@ -33,6 +33,7 @@
 #include "mem/ruby/network/garnet/Router.hh"
 
 #include "debug/RubyNetwork.hh"
+#include "mem/ruby/network/garnet/Credit.hh"
 #include "mem/ruby/network/garnet/CreditLink.hh"
 #include "mem/ruby/network/garnet/GarnetNetwork.hh"
 #include "mem/ruby/network/garnet/InputUnit.hh"
@@ -53,7 +54,8 @@ Router::Router(const Params &p)
     m_virtual_networks(p.virt_nets), m_vc_per_vnet(p.vcs_per_vnet),
     m_num_vcs(m_virtual_networks * m_vc_per_vnet), m_bit_width(p.width),
     m_network_ptr(nullptr), routingUnit(this), switchAllocator(this),
-    crossbarSwitch(this)
+    crossbarSwitch(this), m_parallel(false), m_evaluated(MaxTick),
+    m_record(nullptr)
 {
     m_input_unit.clear();
     m_output_unit.clear();
@@ -74,6 +76,21 @@ Router::wakeup()
     DPRINTF(RubyNetwork, "Router %d woke up\n", m_id);
     assert(clockEdge() == curTick());
 
+    if (m_parallel) {
+        // The network evaluates all the routers due in this cycle when
+        // the first of them wakes up; carry out what this one did.
+        if (!evaluatedAt(curTick()))
+            m_network_ptr->evaluateRouters(this);
+        applyActions(m_actions);
+        return;
+    }
+
+    evaluate();
+}
+
+void
+Router::evaluate()
+{
     // check for incoming flits
     for (int inport = 0; inport < m_input_unit.size(); inport++) {
         m_input_unit[inport]->wakeup();
@@ -86,7 +103,7 @@ Router::wakeup()
     // if we want the credit update to take place after SA, this loop should
     // be moved after the SA request
     for (int outport = 0; outport < m_output_unit.size(); outport++) {
-        m_output_unit[outport]->wakeup();
+        m_output_unit[outport]->receive_credit();
     }
 
     // Switch Allocation
@@ -96,6 +113,109 @@ Router::wakeup()
     crossbarSwitch.wakeup();
 }
 
+void
+Router::setParallel()
+{
+    m_parallel = true;
+
+    // evaluateAhead() compares when the events of the router and its
+    // output units were scheduled.
+    trackWakeupOrder();
+    for (auto &output_unit : m_output_unit)
+        output_unit->trackWakeupOrder();
+}
+
+void
+Router::evaluateAhead()
+{
+    // Output units that woke themselves up for this cycle and whose
+    // events run before the router's (of two events at the same tick
+    // the one scheduled last runs first) must see the router as it was
+    // before this cycle. If the router is already running its event,
+    // they all run after it.
+    if (wakeupTick() == curTick()) {
+        for (auto &output_unit : m_output_unit) {
+            if (output_unit->wakeupTick() == curTick() &&
+                output_unit->wakeupOrder() > wakeupOrder()) {
+                output_unit->wakeupAhead();
+            }
+        }
+    }
+
+    recordActions(&m_actions);
+    evaluate();
+    recordActions(nullptr);
+    m_evaluated = curTick();
+}
+
+void
+Router::applyActions(std::vector<Action> &actions)
+{
+    for (const Action &action : actions) {
+        switch (action.kind) {
+          case Action::Wakeup:
+            action.consumer->scheduleEventAbsolute(action.when);
+            break;
+          case Action::SendFlit:
+            action.buffer->insert(action.t_flit);
+            break;
+          case Action::SendCredit:
+            action.buffer->insert(new Credit(action.vc, action.free_signal,
+                                             action.when));
+            break;
+          case Action::FreeCredit:
+            delete static_cast<Credit *>(action.t_flit);
+            break;
+        }
+    }
+    actions.clear();
+}
+
+void
+Router::scheduleConsumer(Consumer *consumer, Tick when)
+{
+    if (m_record) {
+        m_record->push_back({Action::Wakeup, consumer, when});
+    } else {
+        consumer->scheduleEventAbsolute(when);
+    }
+}
+
+void
+Router::sendFlit(flitBuffer *buffer, flit *t_flit)
+{
+    if (m_record) {
+        m_record->push_back({Action::SendFlit, nullptr, 0, buffer, t_flit});
+    } else {
+        buffer->insert(t_flit);
+    }
+}
+
+// Credits are allocated and freed on the simulation thread only, which
+// keeps them in that thread's pool.
+void
+Router::sendCredit(flitBuffer *buffer, int vc, bool free_signal,
+                   Tick curTime)
+{
+    if (m_record) {
+        m_record->push_back({Action::SendCredit, nullptr, curTime, buffer,
+                             nullptr, vc, free_signal});
+    } else {
+        buffer->insert(new Credit(vc, free_signal, curTime));
+    }
+}
+
+void
+Router::freeCredit(flit *t_credit)
+{
+    if (m_record) {
+        m_record->push_back({Action::FreeCredit, nullptr, 0, nullptr,
+                             t_credit});
+    } else {
+        delete static_cast<Credit *>(t_credit);
+    }
+}
+
 void
 Router::addInPort(PortDirection inport_dirn,
                   NetworkLink *in_link, CreditLink *credit_link)
@@ -159,7 +279,8 @@ Router::getInportDirection(int inport)
 }
 
 int
-Router::route_compute(RouteInfo route, int inport, PortDirection inport_dirn)
+Router::route_compute(const RouteInfo &route, int inport,
+                      PortDirection inport_dirn)
 {
     return routingUnit.outportCompute(route, inport, inport_dirn);
 }
@@ -174,7 +295,7 @@ void
 Router::schedule_wakeup(Cycles time)
 {
     // wake up after time cycles
-    scheduleEvent(time);
+    scheduleConsumer(this, clockEdge(time));
 }
 
 std::string
@@ -60,6 +60,7 @@ namespace garnet
 
 class NetworkLink;
 class CreditLink;
+class flitBuffer;
 class InputUnit;
 class OutputUnit;
 
@@ -74,6 +75,40 @@ class Router : public BasicRouter, public Consumer
     void wakeup();
     void print(std::ostream& out) const {};
 
+    // Run the router pipeline for the current cycle
+    void evaluate();
+
+    /*
+     * Parallel evaluation (see GarnetNetwork::evaluateRouters()).
+     *
+     * evaluateAhead() runs the pipeline of a router that is due this
+     * cycle before its own wakeup event, possibly on another thread. The
+     * actions that other consumers can observe (scheduling wakeups,
+     * sending flits and credits, freeing credits) are recorded instead of
+     * carried out, and applyActions() carries them out when the event
+     * they belong to runs, so they happen in the same order as in serial
+     * evaluation.
+     */
+    struct Action
+    {
+        enum Kind { Wakeup, SendFlit, SendCredit, FreeCredit };
+
+        Kind kind;
+        Consumer *consumer; // Wakeup
+        Tick when;          // Wakeup, and the time of SendCredit
+        flitBuffer *buffer; // SendFlit, SendCredit
+        flit *t_flit;       // SendFlit, FreeCredit
+        int vc;             // SendCredit
+        bool free_signal;   // SendCredit
+    };
+
+    void setParallel();
+    bool mayRouteRandomly() { return routingUnit.mayRouteRandomly(); }
+    bool evaluatedAt(Tick when) const { return m_evaluated == when; }
+    void evaluateAhead();
+    void recordActions(std::vector<Action> *actions) { m_record = actions; }
+    void applyActions(std::vector<Action> &actions);
+
     void init();
     void addInPort(PortDirection inport_dirn, NetworkLink *link,
                    CreditLink *credit_link);
@@ -116,9 +151,17 @@ class Router : public BasicRouter, public Consumer
     PortDirection getOutportDirection(int outport);
     PortDirection getInportDirection(int inport);
 
-    int route_compute(RouteInfo route, int inport, PortDirection direction);
+    int route_compute(const RouteInfo &route, int inport,
+                      PortDirection direction);
     void grant_switch(int inport, flit *t_flit);
     void schedule_wakeup(Cycles time);
+    // Actions of the router pipeline on other consumers; they all go
+    // through here so they can be recorded.
+    void scheduleConsumer(Consumer *consumer, Tick when);
+    void sendFlit(flitBuffer *buffer, flit *t_flit);
+    void sendCredit(flitBuffer *buffer, int vc, bool free_signal,
+                    Tick curTime);
+    void freeCredit(flit *t_credit);
 
     std::string getPortDirectionName(PortDirection direction);
     void printFaultVector(std::ostream& out);
@@ -155,6 +198,12 @@ class Router : public BasicRouter, public Consumer
     std::vector<std::shared_ptr<InputUnit>> m_input_unit;
     std::vector<std::shared_ptr<OutputUnit>> m_output_unit;
 
+    // Parallel evaluation
+    bool m_parallel;
+    Tick m_evaluated;
+    std::vector<Action> *m_record;
+    std::vector<Action> m_actions;
+
     // Statistical variables required for power computations
     statistics::Scalar m_buffer_reads;
     statistics::Scalar m_buffer_writes;
@@ -144,6 +144,42 @@ RoutingUnit::lookupRoutingTable(int vnet, NetDest msg_destination)
     return output_link;
 }
 
+/*
+ * lookupRoutingTable() picks a link at random if, on an unordered vnet,
+ * more than one link of the minimum weight leads to the destination.
+ * Flits carry a single destination (the NIs split multicast messages),
+ * so it is enough to check every destination on its own.
+ */
+bool
+RoutingUnit::mayRouteRandomly()
+{
+    for (int vnet = 0; vnet < m_routing_table.size(); vnet++) {
+        if (m_router->get_net_ptr()->isVNetOrdered(vnet))
+            continue;
+
+        // Minimum link weight to every destination, and the number of
+        // links with that weight
+        std::map<NodeID, std::pair<int, int>> routes;
+        for (int link = 0; link < m_routing_table[vnet].size(); link++) {
+            const int weight = m_weight_table[link];
+            for (NodeID dest : m_routing_table[vnet][link].getAllDest()) {
+                auto &route = routes.try_emplace(dest, weight, 0)
+                                  .first->second;
+                if (weight < route.first)
+                    route = {weight, 1};
+                else if (weight == route.first)
+                    route.second++;
+            }
+        }
+
+        for (const auto &[dest, route] : routes) {
+            if (route.second > 1)
+                return true;
+        }
+    }
+    return false;
+}
+
 
 void
 RoutingUnit::addInDirection(PortDirection inport_dirn, int inport_idx)
@@ -166,7 +202,7 @@ RoutingUnit::addOutDirection(PortDirection outport_dirn, int outport_idx)
 // table is provided here.
 
 int
-RoutingUnit::outportCompute(RouteInfo route, int inport,
+RoutingUnit::outportCompute(const RouteInfo &route, int inport,
                             PortDirection inport_dirn)
 {
     int outport = -1;
@@ -205,7 +241,7 @@ RoutingUnit::outportCompute(RouteInfo route, int inport,
 // Only for reference purpose in a Mesh
 // By default Garnet uses the routing table
 int
-RoutingUnit::outportComputeXY(RouteInfo route,
+RoutingUnit::outportComputeXY(const RouteInfo &route,
                               int inport,
                               PortDirection inport_dirn)
 {
@@ -263,7 +299,7 @@ RoutingUnit::outportComputeXY(RouteInfo route,
 // Template for implementing custom routing algorithm
 // using port directions. (Example adaptive)
 int
-RoutingUnit::outportComputeCustom(RouteInfo route,
+RoutingUnit::outportComputeCustom(const RouteInfo &route,
                                  int inport,
                                  PortDirection inport_dirn)
 {
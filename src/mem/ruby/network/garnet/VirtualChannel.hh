@@ -49,7 +49,9 @@ namespace garnet
 class VirtualChannel
 {
   public:
-    VirtualChannel();
+    // depth is the number of flits the VC can hold, i.e., the number of
+    // credits of the upstream router
+    VirtualChannel(int depth);
     ~VirtualChannel() = default;
 
     bool need_stage(flit_stage stage, Tick time);
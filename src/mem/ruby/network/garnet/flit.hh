@@ -34,6 +34,7 @@
 #include <cassert>
 #include <iostream>
 
+#include "base/pool_alloc.hh"
 #include "base/types.hh"
 #include "mem/ruby/network/garnet/CommonTypes.hh"
 #include "mem/ruby/slicc_interface/Message.hh"
@@ -51,11 +52,31 @@ class flit
 {
   public:
     flit() {}
-    flit(int packet_id, int id, int vc, int vnet, RouteInfo route, int size,
-         MsgPtr msg_ptr, int MsgSize, uint32_t bWidth, Tick curTime);
+    flit(int packet_id, int id, int vc, int vnet, const RouteInfo &route,
+         int size, MsgPtr msg_ptr, int MsgSize, uint32_t bWidth,
+         Tick curTime);
 
     virtual ~flit(){};
 
+    // Flits are created and destroyed for every packet and every hop, so
+    // they are recycled through the slab pool of the running thread.
+    static void *
+    operator new(size_t size)
+    {
+        if (size == sizeof(flit) && SlabPool::enabled())
+            return threadSlabPool<sizeof(flit)>().allocate();
+        return ::operator new(size);
+    }
+
+    static void
+    operator delete(void *p, size_t size)
+    {
+        if (size == sizeof(flit) && SlabPool::enabled())
+            threadSlabPool<sizeof(flit)>().deallocate(p);
+        else
+            ::operator delete(p);
+    }
+
     int get_outport() {return m_outport; }
     int get_size() { return m_size; }
     Tick get_enqueue_time() { return m_enqueue_time; }
@@ -65,7 +86,7 @@ class flit
     Tick get_time() { return m_time; }
     int get_vnet() { return m_vnet; }
     int get_vc() { return m_vc; }
-    RouteInfo get_route() { return m_route; }
+    const RouteInfo &get_route() const { return m_route; }
     MsgPtr& get_msg_ptr() { return m_msg_ptr; }
     flit_type get_type() { return m_type; }
     std::pair<flit_stage, Tick> get_stage() { return m_stage; }
@@ -74,7 +95,7 @@ class flit
     void set_outport(int port) { m_outport = port; }
     void set_time(Tick time) { m_time = time; }
     void set_vc(int vc) { m_vc = vc; }
-    void set_route(RouteInfo route) { m_route = route; }
+    void set_route(const RouteInfo &route) { m_route = route; }
     void set_src_delay(Tick delay) { src_delay = delay; }
     void set_dequeue_time(Tick time) { m_dequeue_time = time; }
     void set_enqueue_time(Tick time) { m_enqueue_time = time; }
@@ -31,6 +31,8 @@
 
 #include "mem/ruby/network/garnet/flitBuffer.hh"
 
+#include "base/intmath.hh"
+
 namespace gem5
 {
 
@@ -41,25 +43,40 @@ namespace garnet
 {
 
 flitBuffer::flitBuffer()
+    : m_buffer(DefaultCapacity), m_head(0), m_count(0)
 {
     max_size = INFINITE_;
 }
 
 flitBuffer::flitBuffer(int maximum_size)
+    : flitBuffer()
 {
     max_size = maximum_size;
 }
 
+void
+flitBuffer::reserve(int n)
+{
+    if (n <= (int)m_buffer.size())
+        return;
+
+    std::vector<flit *> ring((size_t)1 << ceilLog2(n));
+    for (unsigned i = 0; i < m_count; i++)
+        ring[i] = at(i);
+    m_buffer.swap(ring);
+    m_head = 0;
+}
+
 bool
 flitBuffer::isEmpty()
 {
-    return (m_buffer.size() == 0);
+    return (m_count == 0);
 }
 
 bool
 flitBuffer::isReady(Tick curTime)
 {
-    if (m_buffer.size() != 0 ) {
+    if (m_count != 0 ) {
         flit *t_flit = peekTopFlit();
         if (t_flit->get_time() <= curTime)
             return true;
@@ -70,13 +87,13 @@ flitBuffer::isReady(Tick curTime)
 void
 flitBuffer::print(std::ostream& out) const
 {
-    out << "[flitBuffer: " << m_buffer.size() << "] " << std::endl;
+    out << "[flitBuffer: " << m_count << "] " << std::endl;
 }
 
 bool
 flitBuffer::isFull()
 {
-    return (m_buffer.size() >= max_size);
+    return (m_count >= max_size);
 }
 
 void
@@ -89,8 +106,8 @@ bool
 flitBuffer::functionalRead(Packet *pkt, WriteMask &mask)
 {
     bool read = false;
-    for (unsigned int i = 0; i < m_buffer.size(); ++i) {
-        if (m_buffer[i]->functionalRead(pkt, mask)) {
+    for (unsigned int i = 0; i < m_count; ++i) {
+        if (at(i)->functionalRead(pkt, mask)) {
             read = true;
         }
     }
@@ -103,8 +120,8 @@ flitBuffer::functionalWrite(Packet *pkt)
 {
     uint32_t num_functional_writes = 0;
 
-    for (unsigned int i = 0; i < m_buffer.size(); ++i) {
-        if (m_buffer[i]->functionalWrite(pkt)) {
+    for (unsigned int i = 0; i < m_count; ++i) {
+        if (at(i)->functionalWrite(pkt)) {
             num_functional_writes++;
         }
     }
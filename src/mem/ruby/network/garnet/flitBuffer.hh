@@ -32,6 +32,7 @@
 #define __MEM_RUBY_NETWORK_GARNET_0_FLITBUFFER_HH__
 
 #include <algorithm>
+#include <cassert>
 #include <iostream>
 #include <vector>
 
@@ -47,6 +48,12 @@ namespace ruby
 namespace garnet
 {
 
+/**
+ * FIFO of flits kept in a ring buffer. The ring starts out with room for
+ * DefaultCapacity flits (or the capacity given to reserve(), e.g., the
+ * depth of a VC) and only grows if more flits are ever queued at once,
+ * so a buffer in steady state never allocates.
+ */
 class flitBuffer
 {
   public:
@@ -58,33 +65,53 @@ class flitBuffer
     void print(std::ostream& out) const;
     bool isFull();
     void setMaxSize(int maximum);
-    int getSize() const { return m_buffer.size(); }
+    int getSize() const { return m_count; }
+
+    /** Make room for at least n flits without further allocation. */
+    void reserve(int n);
 
     flit *
     getTopFlit()
     {
-        flit *f = m_buffer.front();
-        m_buffer.pop_front();
+        assert(m_count > 0);
+        flit *f = m_buffer[m_head];
+        m_head = (m_head + 1) & (m_buffer.size() - 1);
+        m_count--;
         return f;
     }
 
     flit *
     peekTopFlit()
     {
-        return m_buffer.front();
+        assert(m_count > 0);
+        return m_buffer[m_head];
     }
 
     void
     insert(flit *flt)
     {
-        m_buffer.push_back(flt);
+        if (m_count == m_buffer.size())
+            reserve(2 * m_count);
+        m_buffer[(m_head + m_count) & (m_buffer.size() - 1)] = flt;
+        m_count++;
     }
 
     bool functionalRead(Packet *pkt, WriteMask &mask);
     uint32_t functionalWrite(Packet *pkt);
 
   private:
-    std::deque<flit *> m_buffer;
+    static constexpr unsigned DefaultCapacity = 4;
+
+    flit *
+    at(unsigned i) const
+    {
+        return m_buffer[(m_head + i) & (m_buffer.size() - 1)];
+    }
+
+    // Ring of a power-of-two size; m_count flits starting at m_head.
+    std::vector<flit *> m_buffer;
+    unsigned m_head;
+    unsigned m_count;
     int max_size;
 };
 
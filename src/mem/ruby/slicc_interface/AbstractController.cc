@@ -62,7 +62,7 @@ AbstractController::AbstractController(const Params &p)
       m_buffer_size(p.buffer_size), m_recycle_latency(p.recycle_latency),
       m_mandatory_queue_latency(p.mandatory_queue_latency),
       m_waiting_mem_retry(false),
-      m_mem_ctrl_waiting_retry(false),
+      m_mem_ctrl_waiting_retry(false), m_outstanding_mem_reqs(0),
       memoryPort(csprintf("%s.memory", name()), this),
       addrRanges(p.addr_ranges.begin(), p.addr_ranges.end()),
       mRetryRespEvent{*this, false},
@@ -274,7 +274,7 @@ AbstractController::serviceMemoryQueue()
     }
 
     RequestPtr req
-        = std::make_shared<Request>(mem_msg->m_addr, req_size, 0, m_id);
+        = Request::create(mem_msg->m_addr, req_size, 0, m_id);
     PacketPtr pkt;
     if (mem_msg->getType() == MemoryRequestType_MEMORY_WB) {
         pkt = Packet::createWrite(req);
@@ -304,6 +304,7 @@ AbstractController::serviceMemoryQueue()
         recvTimingResp(pkt);
     } else if (memoryPort.sendTimingReq(pkt)) {
         mem_queue->dequeue(clockEdge());
+        m_outstanding_mem_reqs++;
         // Since the queue was popped the controller may be able
         // to make more progress. Make sure it wakes up
         scheduleEvent(Cycles(1));
@@ -474,7 +475,10 @@ AbstractController::sendRetryRespToMem() {
 bool
 AbstractController::MemoryPort::recvTimingResp(PacketPtr pkt)
 {
-    return controller->recvTimingResp(pkt);
+    if (!controller->recvTimingResp(pkt))
+        return false;
+    controller->m_outstanding_mem_reqs--;
+    return true;
 }
 
 void
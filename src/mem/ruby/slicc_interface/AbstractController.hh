@@ -117,6 +117,36 @@ class AbstractController : public ClockedObject, public Consumer
     virtual void regStats();
 
     virtual void recordCacheTrace(int cntrl, CacheRecorder* tr) = 0;
+
+    /**
+     * Install a block of a cache trace directly into the caches of this
+     * controller, e.g., when restoring them from a checkpoint, rather
+     * than fetching it through the sequencer. Protocols that can do so
+     * without involving other controllers define this function.
+     *
+     * Blocks are installed before the rest of the trace is fetched, and
+     * concurrently for different controllers, on threads that share the
+     * event queue of the simulation. Only blocks that no controller writes
+     * in the trace are installed, and a controller stops at the first
+     * block it cannot install. The coherence state of an installed block
+     * may still differ from the one a fetch would leave, e.g., shared
+     * rather than exclusive when no other controller has the block.
+     *
+     * @return false if the block has to be fetched.
+     */
+    virtual bool
+    installCacheTraceBlock(const Addr &addr, const RubyRequestType &type,
+                           const DataBlock &data)
+    {
+        return false;
+    }
+    // Whether a request waits to be sent to the memory or for its response.
+    bool
+    hasOutstandingMemRequests() const
+    {
+        return m_waiting_mem_retry || m_outstanding_mem_reqs > 0;
+    }
+
     virtual Sequencer* getCPUSequencer() const = 0;
     virtual DMASequencer* getDMASequencer() const = 0;
     virtual GPUCoalescer* getGPUCoalescer() const = 0;
@@ -415,6 +445,9 @@ class AbstractController : public ClockedObject, public Consumer
     const Cycles m_mandatory_queue_latency;
     bool m_waiting_mem_retry;
     bool m_mem_ctrl_waiting_retry;
+    // Timing requests sent to the memory whose response has not been
+    // accepted yet.
+    int m_outstanding_mem_reqs;
 
     /**
      * Port that forwards requests and receives responses from the
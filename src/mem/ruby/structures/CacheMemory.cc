@@ -84,6 +84,7 @@ CacheMemory::CacheMemory(const Params &p)
     m_is_instruction_only_cache = p.is_icache;
     m_resource_stalls = p.resourceStalls;
     m_block_size = p.block_size;  // may be 0 at this point. Updated in init()
+    m_set_local_tags = p.set_local_tags;
     m_use_occupancy = dynamic_cast<replacement_policy::WeightedLRU*>(
                                     m_replacementPolicy_ptr) ? true : false;
 }
@@ -103,6 +104,10 @@ CacheMemory::init()
                     std::vector<AbstractCacheEntry*>(m_cache_assoc, nullptr));
     replacement_data.resize(m_cache_num_sets,
                                std::vector<ReplData>(m_cache_assoc, nullptr));
+    if (m_set_local_tags) {
+        m_set_tags.assign((size_t)m_cache_num_sets * m_cache_assoc,
+                          InvalidSetTag);
+    }
     // instantiate all the replacement_data here
     for (int i = 0; i < m_cache_num_sets; i++) {
         for ( int j = 0; j < m_cache_assoc; j++) {
@@ -138,6 +143,13 @@ int
 CacheMemory::findTagInSet(int64_t cacheSet, Addr tag) const
 {
     assert(tag == makeLineAddress(tag));
+    if (m_set_local_tags) {
+        int loc = findTagInSetLocal(cacheSet, tag);
+        if (loc != -1 && m_cache[cacheSet][loc]->m_Permission ==
+            AccessPermission_NotPresent)
+            return -1;
+        return loc;
+    }
     // search the set for the tags
     auto it = m_tag_index.find(tag);
     if (it != m_tag_index.end())
@@ -154,6 +166,8 @@ CacheMemory::findTagInSetIgnorePermissions(int64_t cacheSet,
                                            Addr tag) const
 {
     assert(tag == makeLineAddress(tag));
+    if (m_set_local_tags)
+        return findTagInSetLocal(cacheSet, tag);
     // search the set for the tags
     auto it = m_tag_index.find(tag);
     if (it != m_tag_index.end())
@@ -161,6 +175,18 @@ CacheMemory::findTagInSetIgnorePermissions(int64_t cacheSet,
     return -1; // Not found
 }
 
+int
+CacheMemory::findTagInSetLocal(int64_t cacheSet, Addr tag) const
+{
+    // Only the tags of this set are touched, and they are contiguous
+    const Addr *tags = &m_set_tags[cacheSet * m_cache_assoc];
+    for (int i = 0; i < m_cache_assoc; i++) {
+        if (tags[i] == tag)
+            return i;
+    }
+    return -1; // Not found
+}
+
 // Given an unique cache block identifier (idx): return the valid address
 // stored by the cache block.  If the block is invalid/notpresent, the
 // function returns the 0 address
@@ -304,7 +330,11 @@ CacheMemory::allocate(Addr address, AbstractCacheEntry *entry)
             DPRINTF(RubyCache, "Allocate clearing lock for addr: 0x%x\n",
                     address);
             set[i]->m_locked = -1;
-            m_tag_index[address] = i;
+            if (m_set_local_tags) {
+                m_set_tags[cacheSet * m_cache_assoc + i] = address;
+            } else {
+                m_tag_index[address] = i;
+            }
             set[i]->setPosition(cacheSet, i);
             set[i]->replacementData = replacement_data[cacheSet][i];
             set[i]->setLastAccess(curTick());
@@ -330,7 +360,11 @@ CacheMemory::deallocate(Addr address)
     uint32_t way = entry->getWay();
     delete entry;
     m_cache[cache_set][way] = NULL;
-    m_tag_index.erase(address);
+    if (m_set_local_tags) {
+        m_set_tags[cache_set * m_cache_assoc + way] = InvalidSetTag;
+    } else {
+        m_tag_index.erase(address);
+    }
 }
 
 // Returns with the physical address of the conflicting cache line
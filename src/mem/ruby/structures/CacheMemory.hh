@@ -168,6 +168,8 @@ class CacheMemory : public SimObject
     // returns -1 if the tag is not found.
     int findTagInSet(int64_t line, Addr tag) const;
     int findTagInSetIgnorePermissions(int64_t cacheSet, Addr tag) const;
+    // Scan the set-local tag array; see m_set_tags
+    int findTagInSetLocal(int64_t cacheSet, Addr tag) const;
 
     // Private copy constructor and assignment operator
     CacheMemory(const CacheMemory& obj);
@@ -182,6 +184,17 @@ class CacheMemory : public SimObject
     std::unordered_map<Addr, int> m_tag_index;
     std::vector<std::vector<AbstractCacheEntry*> > m_cache;
 
+    /**
+     * When set_local_tags is enabled, the line address held by every way
+     * is kept in m_set_tags, indexed by set * assoc + way, and used
+     * instead of m_tag_index. A lookup then only scans the assoc
+     * contiguous tags of one set rather than hashing into a map that
+     * covers the whole cache. Unused ways hold InvalidSetTag.
+     */
+    bool m_set_local_tags;
+    std::vector<Addr> m_set_tags;
+    static constexpr Addr InvalidSetTag = MaxAddr;
+
     /** We use the replacement policies from the Classic memory system. */
     replacement_policy::Base *m_replacementPolicy_ptr;
 
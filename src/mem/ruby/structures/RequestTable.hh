@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_RUBY_STRUCTURES_REQUESTTABLE_HH__
+#define __MEM_RUBY_STRUCTURES_REQUESTTABLE_HH__
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "base/intmath.hh"
+#include "mem/ruby/common/Address.hh"
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+/**
+ * Table of outstanding requests, kept as one FIFO queue per line address.
+ *
+ * Addresses are located through an open-addressing, linearly probed hash
+ * table and the queued entries live in a node pool linked by index, so
+ * issuing and retiring requests never touch the heap as long as the
+ * number of entries stays within the capacity given at construction.
+ * Going beyond it is allowed (e.g., HTM aborts bypass the outstanding
+ * request limit) and simply grows the pool and the index.
+ *
+ * References to queued entries stay valid until the entry is popped, even
+ * if the table grows in the meantime. Callers must not hold on to
+ * anything else across calls that may modify the table.
+ */
+template<class ENTRY>
+class RequestTable
+{
+  private:
+    using Index = uint32_t;
+    static constexpr Index NoIndex = UINT32_MAX;
+
+    struct Node
+    {
+        std::optional<ENTRY> entry;
+        Index next = NoIndex;
+    };
+
+    struct Bucket
+    {
+        Addr addr = 0;
+        Index head = NoIndex;
+        Index tail = NoIndex;
+        Index size = 0;
+
+        bool used() const { return head != NoIndex; }
+    };
+
+  public:
+    explicit RequestTable(std::size_t capacity)
+    {
+        capacity = std::max<std::size_t>(capacity, 1);
+        grow(capacity);
+        resizeIndex(std::max<std::size_t>(
+            std::size_t(1) << ceilLog2(2 * capacity), 8));
+    }
+
+    RequestTable(const RequestTable &) = delete;
+    RequestTable &operator=(const RequestTable &) = delete;
+
+    /** Number of distinct addresses with queued entries. */
+    std::size_t numAddresses() const { return usedBuckets; }
+    /** Total number of queued entries. */
+    std::size_t size() const { return numEntries; }
+    bool empty() const { return numEntries == 0; }
+
+    bool contains(Addr addr) const { return find(addr) != NoIndex; }
+
+    /** Length of the queue for addr, zero if there is none. */
+    std::size_t
+    count(Addr addr) const
+    {
+        Index b = find(addr);
+        return b == NoIndex ? 0 : buckets[b].size;
+    }
+
+    /** Construct a new entry at the back of the queue for addr. */
+    template<typename... Args>
+    ENTRY &
+    emplaceBack(Addr addr, Args&&... args)
+    {
+        if (freeList == NoIndex)
+            grow(nodes.size());
+
+        Index n = freeList;
+        Node &node = nodes[n];
+        freeList = node.next;
+        node.next = NoIndex;
+        node.entry.emplace(std::forward<Args>(args)...);
+
+        Bucket &bucket = buckets[findOrInsert(addr)];
+        if (bucket.tail == NoIndex) {
+            bucket.head = n;
+        } else {
+            nodes[bucket.tail].next = n;
+        }
+        bucket.tail = n;
+        bucket.size++;
+        numEntries++;
+        return *node.entry;
+    }
+
+    /** Oldest entry queued for addr, which must have one. */
+    ENTRY &
+    front(Addr addr)
+    {
+        Index b = find(addr);
+        assert(b != NoIndex);
+        return *nodes[buckets[b].head].entry;
+    }
+
+    /**
+     * Destroy the oldest entry queued for addr; the address is removed
+     * from the table once its queue is empty.
+     */
+    void
+    popFront(Addr addr)
+    {
+        Index b = find(addr);
+        assert(b != NoIndex);
+        Bucket &bucket = buckets[b];
+
+        Index n = bucket.head;
+        Node &node = nodes[n];
+        bucket.head = node.next;
+        if (bucket.head == NoIndex)
+            bucket.tail = NoIndex;
+        bucket.size--;
+        numEntries--;
+
+        node.entry.reset();
+        node.next = freeList;
+        freeList = n;
+
+        if (bucket.size == 0)
+            erase(b);
+    }
+
+    /**
+     * Call f(addr, entry) for every queued entry. Entries for the same
+     * address are visited consecutively and in queue order; the order of
+     * the addresses is unspecified. The table must not be modified from
+     * within f.
+     */
+    template<typename F>
+    void
+    forEach(F &&f) const
+    {
+        for (const Bucket &bucket : buckets) {
+            for (Index n = bucket.head; n != NoIndex; n = nodes[n].next)
+                f(bucket.addr, *nodes[n].entry);
+        }
+    }
+
+  private:
+    Index
+    home(Addr addr) const
+    {
+        // Fibonacci hashing spreads the line-aligned addresses, whose low
+        // bits are all zero, over the whole index.
+        return (addr * 0x9E3779B97F4A7C15ULL) >> hashShift;
+    }
+
+    Index
+    find(Addr addr) const
+    {
+        const Index mask = buckets.size() - 1;
+        for (Index b = home(addr); buckets[b].used(); b = (b + 1) & mask) {
+            if (buckets[b].addr == addr)
+                return b;
+        }
+        return NoIndex;
+    }
+
+    Index
+    findOrInsert(Addr addr)
+    {
+        Index b = find(addr);
+        if (b != NoIndex)
+            return b;
+
+        // Keep the load factor at or below one half so probe sequences
+        // stay short.
+        if (2 * (usedBuckets + 1) > buckets.size())
+            rehash(2 * buckets.size());
+
+        const Index mask = buckets.size() - 1;
+        for (b = home(addr); buckets[b].used(); b = (b + 1) & mask);
+        buckets[b].addr = addr;
+        usedBuckets++;
+        // The caller links the first node, which marks the bucket used.
+        return b;
+    }
+
+    /** Backward-shift deletion, so no tombstones are needed. */
+    void
+    erase(Index hole)
+    {
+        const Index mask = buckets.size() - 1;
+        buckets[hole] = Bucket();
+        usedBuckets--;
+
+        for (Index b = (hole + 1) & mask; buckets[b].used();
+             b = (b + 1) & mask) {
+            Index h = home(buckets[b].addr);
+            // Move the bucket back if its home is not in (hole, b].
+            if (((b - h) & mask) >= ((b - hole) & mask)) {
+                buckets[hole] = buckets[b];
+                buckets[b] = Bucket();
+                hole = b;
+            }
+        }
+    }
+
+    void
+    resizeIndex(std::size_t new_size)
+    {
+        assert(isPowerOf2(new_size));
+        buckets.assign(new_size, Bucket());
+        hashShift = 64 - floorLog2(new_size);
+    }
+
+    void
+    rehash(std::size_t new_size)
+    {
+        std::vector<Bucket> old;
+        old.swap(buckets);
+        resizeIndex(new_size);
+
+        const Index mask = buckets.size() - 1;
+        for (const Bucket &bucket : old) {
+            if (!bucket.used())
+                continue;
+            Index b = home(bucket.addr);
+            while (buckets[b].used())
+                b = (b + 1) & mask;
+            buckets[b] = bucket;
+        }
+    }
+
+    /** Add count nodes to the pool; existing nodes never move. */
+    void
+    grow(std::size_t count)
+    {
+        assert(nodes.size() + count < NoIndex);
+        for (std::size_t i = 0; i < count; i++) {
+            nodes.emplace_back();
+            nodes.back().next = freeList;
+            freeList = nodes.size() - 1;
+        }
+    }
+
+    std::deque<Node> nodes;
+    std::vector<Bucket> buckets;
+    int hashShift = 0;
+    Index freeList = NoIndex;
+    std::size_t usedBuckets = 0;
+    std::size_t numEntries = 0;
+};
+
+} // namespace ruby
+} // namespace gem5
+
+#endif // __MEM_RUBY_STRUCTURES_REQUESTTABLE_HH__
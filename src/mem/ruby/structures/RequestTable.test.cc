@@ -0,0 +1,230 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "mem/ruby/structures/RequestTable.hh"
+
+using namespace gem5;
+using namespace gem5::ruby;
+
+namespace
+{
+
+/** Slot of addr in an index of 1 << bits buckets, as the table hashes. */
+unsigned
+homeOf(Addr addr, int bits)
+{
+    return (addr * 0x9E3779B97F4A7C15ULL) >> (64 - bits);
+}
+
+/** Find n line addresses whose home is the given slot of an 8 slot index. */
+std::vector<Addr>
+addrsWithHome(unsigned slot, std::size_t n)
+{
+    std::vector<Addr> addrs;
+    for (Addr addr = 0x40; addrs.size() < n; addr += 0x40) {
+        if (homeOf(addr, 3) == slot)
+            addrs.push_back(addr);
+    }
+    return addrs;
+}
+
+/** Counts live instances, to check that entries are destroyed. */
+struct Tracked
+{
+    static int live;
+
+    int value;
+
+    explicit Tracked(int v) : value(v) { live++; }
+    Tracked(const Tracked &other) : value(other.value) { live++; }
+    ~Tracked() { live--; }
+};
+
+int Tracked::live = 0;
+
+} // anonymous namespace
+
+/** Entries are queued per address and retired in FIFO order. */
+TEST(RequestTableTest, InsertFindErase)
+{
+    RequestTable<int> table(8);
+    EXPECT_TRUE(table.empty());
+    EXPECT_FALSE(table.contains(0x40));
+    EXPECT_EQ(table.count(0x40), 0);
+
+    table.emplaceBack(0x40, 1);
+    table.emplaceBack(0x80, 2);
+    table.emplaceBack(0x40, 3);
+
+    EXPECT_EQ(table.size(), 3);
+    EXPECT_EQ(table.numAddresses(), 2);
+    EXPECT_EQ(table.count(0x40), 2);
+    EXPECT_EQ(table.count(0x80), 1);
+    EXPECT_EQ(table.front(0x40), 1);
+    EXPECT_EQ(table.front(0x80), 2);
+
+    table.popFront(0x40);
+    EXPECT_EQ(table.front(0x40), 3);
+    EXPECT_EQ(table.count(0x40), 1);
+
+    table.popFront(0x40);
+    EXPECT_FALSE(table.contains(0x40));
+    EXPECT_TRUE(table.contains(0x80));
+    EXPECT_EQ(table.numAddresses(), 1);
+
+    table.popFront(0x80);
+    EXPECT_TRUE(table.empty());
+    EXPECT_EQ(table.numAddresses(), 0);
+}
+
+/** Popping an entry destroys it. */
+TEST(RequestTableTest, DestroysEntries)
+{
+    {
+        RequestTable<Tracked> table(4);
+        table.emplaceBack(0x40, 1);
+        table.emplaceBack(0x40, 2);
+        EXPECT_EQ(Tracked::live, 2);
+
+        table.popFront(0x40);
+        EXPECT_EQ(Tracked::live, 1);
+        EXPECT_EQ(table.front(0x40).value, 2);
+        table.popFront(0x40);
+    }
+    EXPECT_EQ(Tracked::live, 0);
+}
+
+/**
+ * Removing an address shifts the following entries of its probe
+ * sequence back, also when the sequence wraps around the end of the
+ * index.
+ */
+TEST(RequestTableTest, BackwardShiftAcrossWrapAround)
+{
+    // A capacity of 4 makes an index of 8 buckets, which holds up to 4
+    // addresses without rehashing.
+    RequestTable<int> table(4);
+
+    // Three addresses homed in the last bucket occupy buckets 7, 0 and 1,
+    // and one homed in bucket 0 is pushed to bucket 2.
+    std::vector<Addr> last = addrsWithHome(7, 3);
+    Addr first = addrsWithHome(0, 1)[0];
+    for (int i = 0; i < 3; i++)
+        table.emplaceBack(last[i], i);
+    table.emplaceBack(first, 3);
+
+    // Removing the address in bucket 7 must move all others back over
+    // the wrap-around, or they would become unreachable.
+    table.popFront(last[0]);
+    EXPECT_FALSE(table.contains(last[0]));
+    EXPECT_EQ(table.front(last[1]), 1);
+    EXPECT_EQ(table.front(last[2]), 2);
+    EXPECT_EQ(table.front(first), 3);
+
+    // Same for a hole in the middle of the wrapped sequence.
+    table.popFront(last[1]);
+    EXPECT_EQ(table.front(last[2]), 2);
+    EXPECT_EQ(table.front(first), 3);
+
+    table.popFront(first);
+    EXPECT_EQ(table.front(last[2]), 2);
+    EXPECT_EQ(table.numAddresses(), 1);
+
+    // The freed buckets are usable again.
+    for (int i = 0; i < 3; i++)
+        table.emplaceBack(last[i] + 0x1000 * 0x40, i);
+    EXPECT_EQ(table.numAddresses(), 4);
+    EXPECT_EQ(table.front(last[2]), 2);
+}
+
+/**
+ * Going beyond the capacity grows the pool and the index, and references
+ * to queued entries stay valid while doing so.
+ */
+TEST(RequestTableTest, Growth)
+{
+    RequestTable<int> table(2);
+
+    int &oldest = table.emplaceBack(0x40, -1);
+    for (int i = 0; i < 1000; i++)
+        table.emplaceBack(0x40 * (1 + i % 300), i);
+
+    EXPECT_EQ(&table.front(0x40), &oldest);
+    EXPECT_EQ(oldest, -1);
+    EXPECT_EQ(table.size(), 1001);
+    EXPECT_EQ(table.numAddresses(), 300);
+
+    std::map<Addr, std::vector<int>> seen;
+    table.forEach([&](Addr addr, const int &value) {
+        seen[addr].push_back(value);
+    });
+    ASSERT_EQ(seen.size(), 300);
+    for (int j = 0; j < 300; j++) {
+        const std::vector<int> &values = seen[0x40 * (1 + j)];
+        // Entries of an address are visited in queue order.
+        for (std::size_t k = 1; k < values.size(); k++)
+            EXPECT_LT(values[k - 1], values[k]);
+    }
+
+    for (int i = 0; i < 1000; i++)
+        table.popFront(0x40 * (1 + i % 300));
+    table.popFront(0x40);
+    EXPECT_TRUE(table.empty());
+    EXPECT_EQ(table.numAddresses(), 0);
+}
+
+/** Retired entries are recycled instead of growing the pool. */
+TEST(RequestTableTest, NodeReuse)
+{
+    RequestTable<int> table(4);
+
+    int *entry = &table.emplaceBack(0x40, 1);
+    table.popFront(0x40);
+    EXPECT_EQ(&table.emplaceBack(0x80, 2), entry);
+
+    // Filling the table to its capacity only uses nodes that were
+    // allocated up front.
+    std::vector<int *> entries;
+    for (int i = 0; i < 3; i++)
+        entries.push_back(&table.emplaceBack(0xc0 + 0x40 * i, i));
+    for (int i = 0; i < 3; i++)
+        table.popFront(0xc0 + 0x40 * i);
+    for (int i = 0; i < 3; i++) {
+        int *reused = &table.emplaceBack(0xc0 + 0x40 * i, i);
+        EXPECT_NE(std::find(entries.begin(), entries.end(), reused),
+                  entries.end());
+    }
+}
@@ -40,6 +40,11 @@ class RubyCache(SimObject):
     replacement_policy = Param.BaseReplacementPolicy(TreePLRURP(), "")
     start_index_bit = Param.Int(6, "index start, default 6 for 64-byte line")
     is_icache = Param.Bool(False, "is instruction only cache")
+    set_local_tags = Param.Bool(
+        False,
+        "Look tags up in a per-set array instead of a cache-wide hash map. "
+        "Lookups touch a single set, which scales better for large caches.",
+    )
     block_size = Param.MemorySize(
         "0B", "block size in bytes. 0 means default RubyBlockSize"
     )
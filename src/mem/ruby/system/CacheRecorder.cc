@@ -29,10 +29,20 @@
 
 #include "mem/ruby/system/CacheRecorder.hh"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <unordered_set>
+
+#include "base/logging.hh"
 #include "debug/RubyCacheTrace.hh"
 #include "mem/packet.hh"
+#include "mem/ruby/slicc_interface/AbstractController.hh"
 #include "mem/ruby/system/RubySystem.hh"
 #include "mem/ruby/system/Sequencer.hh"
+#include "sim/eventq.hh"
 #include "sim/sim_exit.hh"
 
 namespace gem5
@@ -50,40 +60,45 @@ TraceRecord::print(std::ostream& out) const
 }
 
 CacheRecorder::CacheRecorder()
-    : m_uncompressed_trace(NULL),
-      m_uncompressed_trace_size(0),
+    : m_install_threads(1), m_installed(false), m_outstanding(0),
+      m_records_read(0), m_records_flushed(0),
       m_block_size_bytes(RubySystem::getBlockSizeBytes())
 {
 }
 
-CacheRecorder::CacheRecorder(uint8_t* uncompressed_trace,
-                             uint64_t uncompressed_trace_size,
-                             std::vector<RubyPort*>& ruby_port_map,
-                             uint64_t block_size_bytes)
-    : m_uncompressed_trace(uncompressed_trace),
-      m_uncompressed_trace_size(uncompressed_trace_size),
-      m_ruby_port_map(ruby_port_map), m_bytes_read(0),
-      m_records_read(0), m_records_flushed(0),
-      m_block_size_bytes(block_size_bytes)
-
+CacheRecorder::CacheRecorder(std::vector<uint8_t> &&trace,
+        std::vector<RubyPort*>& ruby_port_map,
+        const std::vector<AbstractController *> &controllers,
+        unsigned install_threads)
+    : m_trace(std::move(trace)),
+      m_ruby_port_map(ruby_port_map), m_controllers(controllers),
+      m_install_threads(install_threads), m_installed(false),
+      m_outstanding(0), m_records_read(0), m_records_flushed(0),
+      m_block_size_bytes(RubySystem::getBlockSizeBytes())
 {
-    if (m_uncompressed_trace != NULL) {
-        if (m_block_size_bytes < RubySystem::getBlockSizeBytes()) {
-            // Block sizes larger than when the trace was recorded are not
-            // supported, as we cannot reliably turn accesses to smaller blocks
-            // into larger ones.
-            panic("Recorded cache block size (%d) < current block size (%d) !!",
-                    m_block_size_bytes, RubySystem::getBlockSizeBytes());
-        }
+    // Without a trace, the recorder records the contents of the caches.
+    if (m_trace.empty())
+        return;
+
+    m_block_size_bytes = cache_trace::parse(m_trace, m_fetch_records);
+    if (m_block_size_bytes < RubySystem::getBlockSizeBytes()) {
+        // Block sizes larger than when the trace was recorded are not
+        // supported, as we cannot reliably turn accesses to smaller blocks
+        // into larger ones.
+        panic("Recorded cache block size (%d) < current block size (%d) !!",
+                m_block_size_bytes, RubySystem::getBlockSizeBytes());
+    }
+    m_zero_block.resize(m_block_size_bytes, 0);
+    for (const auto &rec : m_fetch_records) {
+        fatal_if(rec.cntrl >= m_ruby_port_map.size(),
+                 "Cache trace record of unknown controller %d", rec.cntrl);
     }
 }
 
 CacheRecorder::~CacheRecorder()
 {
-    if (m_uncompressed_trace != NULL) {
-        delete [] m_uncompressed_trace;
-        m_uncompressed_trace = NULL;
-    }
+    for (auto *rec : m_records)
+        free(rec);
     m_ruby_port_map.clear();
 }
 
@@ -93,9 +108,9 @@ CacheRecorder::enqueueNextFlushRequest()
     if (m_records_flushed < m_records.size()) {
         TraceRecord* rec = m_records[m_records_flushed];
         m_records_flushed++;
-        auto req = std::make_shared<Request>(rec->m_data_address,
-                                             m_block_size_bytes, 0,
-                                             Request::funcRequestorId);
+        auto req = Request::create(rec->m_data_address,
+                                   m_block_size_bytes, 0,
+                                   Request::funcRequestorId);
         MemCmd::Command requestType = MemCmd::FlushReq;
         Packet *pkt = new Packet(req, requestType);
         pkt->req->setReqInstSeqNum(m_records_flushed);
@@ -116,61 +131,149 @@ CacheRecorder::enqueueNextFlushRequest()
 }
 
 void
-CacheRecorder::enqueueNextFetchRequest()
+CacheRecorder::installRecords()
 {
-    if (m_bytes_read < m_uncompressed_trace_size) {
-        TraceRecord* traceRecord = (TraceRecord*) (m_uncompressed_trace +
-                                                                m_bytes_read);
-
-        DPRINTF(RubyCacheTrace, "Issuing %s\n", *traceRecord);
-
-        for (int rec_bytes_read = 0; rec_bytes_read < m_block_size_bytes;
-                rec_bytes_read += RubySystem::getBlockSizeBytes()) {
-            RequestPtr req;
-            MemCmd::Command requestType;
-
-            if (traceRecord->m_type == RubyRequestType_LD) {
-                requestType = MemCmd::ReadReq;
-                req = std::make_shared<Request>(
-                    traceRecord->m_data_address + rec_bytes_read,
-                    RubySystem::getBlockSizeBytes(), 0,
-                                    Request::funcRequestorId);
-            }   else if (traceRecord->m_type == RubyRequestType_IFETCH) {
-                requestType = MemCmd::ReadReq;
-                req = std::make_shared<Request>(
-                        traceRecord->m_data_address + rec_bytes_read,
-                        RubySystem::getBlockSizeBytes(),
-                        Request::INST_FETCH, Request::funcRequestorId);
-            }   else {
-                requestType = MemCmd::WriteReq;
-                req = std::make_shared<Request>(
-                    traceRecord->m_data_address + rec_bytes_read,
-                    RubySystem::getBlockSizeBytes(), 0,
-                                Request::funcRequestorId);
+    m_installed = true;
+
+    // Blocks of a different size than the caches' are always fetched.
+    if (m_block_size_bytes != RubySystem::getBlockSizeBytes())
+        return;
+
+    // Installing a block out of the order of the trace only leaves the
+    // same coherence state as fetching it if no controller writes it.
+    std::unordered_set<Addr> written;
+    for (const auto &rec : m_fetch_records) {
+        if (rec.type == RubyRequestType_ST)
+            written.insert(rec.address);
+    }
+
+    // Every controller installs its records in the order of the trace, as
+    // they would have been fetched.
+    std::vector<std::vector<size_t>> cntrl_records(m_controllers.size());
+    for (size_t i = 0; i < m_fetch_records.size(); i++) {
+        if (!written.count(m_fetch_records[i].address))
+            cntrl_records.at(m_fetch_records[i].cntrl).push_back(i);
+    }
+
+    std::vector<uint8_t> installed(m_fetch_records.size(), false);
+    std::atomic<size_t> next_cntrl(0);
+    EventQueue *eq = curEventQueue();
+    auto install = [&]() {
+        // The caches use curTick(), e.g., in their replacement policies.
+        curEventQueue(eq);
+
+        DataBlock data;
+        for (size_t cntrl; (cntrl = next_cntrl++) < cntrl_records.size(); ) {
+            for (size_t i : cntrl_records[cntrl]) {
+                const cache_trace::Record &rec = m_fetch_records[i];
+                data.setData(rec.data ? rec.data : m_zero_block.data(), 0,
+                             m_block_size_bytes);
+                installed[i] = m_controllers[cntrl]->installCacheTraceBlock(
+                    rec.address, RubyRequestType(rec.type), data);
+                // Fetch the rest so the caches see them in trace order.
+                if (!installed[i])
+                    break;
             }
+        }
+    };
+
+    size_t threads = m_install_threads ? m_install_threads :
+        cntrl_records.size();
+    threads = std::min(threads, cntrl_records.size());
+    std::vector<std::thread> workers;
+    for (size_t t = 1; t < threads; t++)
+        workers.emplace_back(install);
+    install();
+    for (auto &worker : workers)
+        worker.join();
+
+    // Fetch the other records, in the order of the trace.
+    size_t kept = 0;
+    for (size_t i = 0; i < m_fetch_records.size(); i++) {
+        if (!installed[i])
+            m_fetch_records[kept++] = m_fetch_records[i];
+    }
+    DPRINTF(RubyCacheTrace, "Installed %d records, fetching %d\n",
+            m_fetch_records.size() - kept, kept);
+    m_fetch_records.resize(kept);
+}
+
+void
+CacheRecorder::enqueueNextFetchRequest()
+{
+    if (!m_installed)
+        installRecords();
 
-            Packet *pkt = new Packet(req, requestType);
-            pkt->dataStatic(traceRecord->m_data + rec_bytes_read);
-            pkt->req->setReqInstSeqNum(m_records_read);
+    // Wait for all the requests of the previous record.
+    if (m_outstanding > 0 && --m_outstanding > 0)
+        return;
 
+    if (m_records_read == m_fetch_records.size()) {
+        DPRINTF(RubyCacheTrace, "Fetched all %d records\n", m_records_read);
+        finishFetching();
+        return;
+    }
 
-            RubyPort* m_ruby_port_ptr =
-                m_ruby_port_map[traceRecord->m_cntrl_id];
-            assert(m_ruby_port_ptr != NULL);
-            m_ruby_port_ptr->makeRequest(pkt);
+    const cache_trace::Record &rec = m_fetch_records[m_records_read];
+    const uint8_t *data = rec.data ? rec.data : m_zero_block.data();
+    DPRINTF(RubyCacheTrace, "Issuing [Node %d, %#x, %s]\n", rec.cntrl,
+            rec.address, RubyRequestType(rec.type));
+
+    m_outstanding = divCeil(m_block_size_bytes,
+                            RubySystem::getBlockSizeBytes());
+    for (int rec_bytes_read = 0; rec_bytes_read < m_block_size_bytes;
+            rec_bytes_read += RubySystem::getBlockSizeBytes()) {
+        RequestPtr req;
+        MemCmd::Command requestType;
+
+        if (rec.type == RubyRequestType_LD) {
+            requestType = MemCmd::ReadReq;
+            req = Request::create(
+                rec.address + rec_bytes_read,
+                RubySystem::getBlockSizeBytes(), 0,
+                Request::funcRequestorId);
+        }   else if (rec.type == RubyRequestType_IFETCH) {
+            requestType = MemCmd::ReadReq;
+            req = Request::create(
+                    rec.address + rec_bytes_read,
+                    RubySystem::getBlockSizeBytes(),
+                    Request::INST_FETCH, Request::funcRequestorId);
+        }   else {
+            requestType = MemCmd::WriteReq;
+            req = Request::create(
+                rec.address + rec_bytes_read,
+                RubySystem::getBlockSizeBytes(), 0,
+                Request::funcRequestorId);
         }
 
-        m_bytes_read += (sizeof(TraceRecord) + m_block_size_bytes);
-        m_records_read++;
-    } else {
-        exitSimLoop("Finished Warmup", 0);
-        DPRINTF(RubyCacheTrace, "Fetched all %d records\n", m_records_read);
+        Packet *pkt = new Packet(req, requestType);
+        // The port may write to the data, e.g., the data of loads, so
+        // leave the trace alone.
+        pkt->allocate();
+        pkt->setData(data + rec_bytes_read);
+        pkt->req->setReqInstSeqNum(m_records_read);
+
+        RubyPort* m_ruby_port_ptr = m_ruby_port_map[rec.cntrl];
+        assert(m_ruby_port_ptr != NULL);
+        m_ruby_port_ptr->makeRequest(pkt);
     }
+
+    m_records_read++;
+}
+
+void
+CacheRecorder::finishFetching()
+{
+    if (m_fetch_done)
+        m_fetch_done();
+    else
+        exitSimLoop("Finished Warmup", 0);
 }
 
 void
 CacheRecorder::addRecord(int cntrl, Addr data_addr, Addr pc_addr,
-                         RubyRequestType type, Tick time, DataBlock& data)
+                         RubyRequestType type, Tick time,
+                         const DataBlock& data)
 {
     TraceRecord* rec = (TraceRecord*)malloc(sizeof(TraceRecord) +
                                             m_block_size_bytes);
@@ -187,40 +290,53 @@ CacheRecorder::addRecord(int cntrl, Addr data_addr, Addr pc_addr,
     m_records.push_back(rec);
 }
 
-uint64_t
-CacheRecorder::aggregateRecords(uint8_t **buf, uint64_t total_size)
+std::vector<uint8_t>
+CacheRecorder::aggregateRecords()
 {
-    std::sort(m_records.begin(), m_records.end(), compareTraceRecords);
-
-    int size = m_records.size();
-    uint64_t current_size = 0;
-    int record_size = sizeof(TraceRecord) + m_block_size_bytes;
-
-    for (int i = 0; i < size; ++i) {
-        // Determine if we need to expand the buffer size
-        if (current_size + record_size > total_size) {
-            uint8_t* new_buf = new (std::nothrow) uint8_t[total_size * 2];
-            if (new_buf == NULL) {
-                fatal("Unable to allocate buffer of size %s\n",
-                      total_size * 2);
-            }
-            total_size = total_size * 2;
-            uint8_t* old_buf = *buf;
-            memcpy(new_buf, old_buf, current_size);
-            *buf = new_buf;
-            delete [] old_buf;
-        }
+    std::stable_sort(m_records.begin(), m_records.end(),
+                     compareTraceRecords);
+
+    std::vector<uint8_t> trace;
+    trace.reserve(cache_trace::HeaderSize + m_records.size() *
+                  (cache_trace::RecordSize + m_block_size_bytes));
+    cache_trace::appendHeader(trace, m_block_size_bytes, m_records.size());
+
+    for (auto *&traceRecord : m_records) {
+        cache_trace::Record rec;
+        rec.cntrl = traceRecord->m_cntrl_id;
+        rec.type = traceRecord->m_type;
+        rec.address = traceRecord->m_data_address;
+        cache_trace::appendRecord(trace, rec, traceRecord->m_data,
+                                  m_block_size_bytes);
+
+        free(traceRecord);
+        traceRecord = NULL;
+    }
 
-        // Copy the current record into the buffer
-        memcpy(&((*buf)[current_size]), m_records[i], record_size);
-        current_size += record_size;
+    m_records.clear();
+    return trace;
+}
 
-        free(m_records[i]);
-        m_records[i] = NULL;
+std::vector<uint8_t>
+CacheRecorder::convertLegacyTrace(const uint8_t *trace, uint64_t size,
+                                  uint64_t block_size_bytes)
+{
+    CacheRecorder recorder;
+    recorder.m_block_size_bytes = block_size_bytes;
+
+    // The legacy trace is already sorted, keep its order.
+    const uint64_t record_size = sizeof(TraceRecord) + block_size_bytes;
+    Tick time = size / record_size;
+    for (uint64_t offset = 0; offset + record_size <= size;
+            offset += record_size) {
+        auto *legacy = reinterpret_cast<const TraceRecord *>(trace + offset);
+        TraceRecord* rec = (TraceRecord*)malloc(record_size);
+        memcpy(rec, legacy, record_size);
+        rec->m_time = time--;
+        recorder.m_records.push_back(rec);
     }
 
-    m_records.clear();
-    return current_size;
+    return recorder.aggregateRecords();
 }
 
 uint64_t
@@ -35,6 +35,8 @@
 #ifndef __MEM_RUBY_SYSTEM_CACHERECORDER_HH__
 #define __MEM_RUBY_SYSTEM_CACHERECORDER_HH__
 
+#include <cstdint>
+#include <functional>
 #include <vector>
 
 #include "base/types.hh"
@@ -42,6 +44,7 @@
 #include "mem/ruby/common/DataBlock.hh"
 #include "mem/ruby/common/TypeDefines.hh"
 #include "mem/ruby/protocol/RubyRequestType.hh"
+#include "mem/ruby/system/CacheTrace.hh"
 
 namespace gem5
 {
@@ -49,6 +52,7 @@ namespace gem5
 namespace ruby
 {
 
+class AbstractController;
 class Sequencer;
 class RubyPort;
 /*!
@@ -76,14 +80,36 @@ class CacheRecorder
     CacheRecorder();
     ~CacheRecorder();
 
-    CacheRecorder(uint8_t* uncompressed_trace,
-                  uint64_t uncompressed_trace_size,
+    /**
+     * Create a recorder that replays an aggregated trace.
+     *
+     * @param trace The trace, laid out as described in CacheTrace.hh.
+     * @param ruby_port_map The port used to replay the records of each
+     *        controller.
+     * @param controllers The controllers the records were taken from.
+     * @param install_threads Host threads that install records directly
+     *        into the caches of the controllers, 0 for one per controller.
+     */
+    CacheRecorder(std::vector<uint8_t> &&trace,
                   std::vector<RubyPort*>& ruby_port_map,
-                  uint64_t block_size_bytes);
+                  const std::vector<AbstractController *> &controllers,
+                  unsigned install_threads);
     void addRecord(int cntrl, Addr data_addr, Addr pc_addr,
-                   RubyRequestType type, Tick time, DataBlock& data);
+                   RubyRequestType type, Tick time, const DataBlock& data);
+
+    /**
+     * Lay the records out as a trace, from the latest to the earliest
+     * record time. The records are consumed.
+     */
+    std::vector<uint8_t> aggregateRecords();
 
-    uint64_t aggregateRecords(uint8_t **data, uint64_t size);
+    /**
+     * Convert a trace in the layout of the TraceRecords, as written by
+     * older versions of gem5, to the current layout.
+     */
+    static std::vector<uint8_t> convertLegacyTrace(const uint8_t *trace,
+                                                   uint64_t size,
+                                                   uint64_t block_size_bytes);
 
     uint64_t getNumRecords() const;
 
@@ -100,25 +126,48 @@ class CacheRecorder
     /*!
      * Function for fetching warming up the memory and the caches. It goes
      * through the recorded contents of the caches, as available in the
-     * checkpoint and issues fetch requests. Except for the first one, a
-     * fetch request is issued only after the previous one has completed.
-     * It should be possible to use this with any protocol.
+     * checkpoint. The first call installs the records the protocol
+     * supports directly into the caches, concurrently for the different
+     * controllers, and the remaining records are fetched in the order of
+     * the trace. Except for the first one, a fetch request is issued only
+     * after the previous one has completed. It should be possible to use
+     * this with any protocol.
      */
     void enqueueNextFetchRequest();
 
+    /**
+     * Call the given function, rather than exiting the simulation loop,
+     * once all records have been fetched.
+     */
+    void
+    setFetchDoneCallback(std::function<void()> callback)
+    {
+        m_fetch_done = std::move(callback);
+    }
+
   private:
     // Private copy constructor and assignment operator
     CacheRecorder(const CacheRecorder& obj);
     CacheRecorder& operator=(const CacheRecorder& obj);
 
+    /** Install the records into the caches where the protocol can. */
+    void installRecords();
+    void finishFetching();
+
     std::vector<TraceRecord*> m_records;
-    uint8_t* m_uncompressed_trace;
-    uint64_t m_uncompressed_trace_size;
+    std::vector<uint8_t> m_trace;
     std::vector<RubyPort*> m_ruby_port_map;
-    uint64_t m_bytes_read;
+    std::vector<AbstractController *> m_controllers;
+    unsigned m_install_threads;
+    /** The records of the trace, those left to fetch once installed. */
+    std::vector<cache_trace::Record> m_fetch_records;
+    std::vector<uint8_t> m_zero_block;
+    bool m_installed;
+    unsigned m_outstanding;
     uint64_t m_records_read;
     uint64_t m_records_flushed;
     uint64_t m_block_size_bytes;
+    std::function<void()> m_fetch_done;
 };
 
 inline bool
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "mem/ruby/system/CacheTrace.hh"
+
+#include <algorithm>
+#include <cstring>
+
+#include "base/logging.hh"
+#include "sim/byteswap.hh"
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+namespace cache_trace
+{
+
+namespace
+{
+
+template <class T>
+T
+loadLE(const uint8_t *p)
+{
+    T value;
+    std::memcpy(&value, p, sizeof(value));
+    return letoh(value);
+}
+
+template <class T>
+void
+appendLE(std::vector<uint8_t> &buf, T value)
+{
+    value = htole(value);
+    const auto *p = reinterpret_cast<const uint8_t *>(&value);
+    buf.insert(buf.end(), p, p + sizeof(value));
+}
+
+} // anonymous namespace
+
+void
+appendHeader(std::vector<uint8_t> &buf, uint32_t block_size,
+             uint64_t num_records)
+{
+    appendLE<uint64_t>(buf, Magic);
+    appendLE<uint32_t>(buf, block_size);
+    appendLE<uint32_t>(buf, 0);
+    appendLE<uint64_t>(buf, num_records);
+}
+
+void
+appendRecord(std::vector<uint8_t> &buf, const Record &rec,
+             const uint8_t *data, uint32_t block_size)
+{
+    const bool zero = std::all_of(data, data + block_size,
+                                  [](uint8_t b) { return b == 0; });
+
+    appendLE<uint32_t>(buf, rec.cntrl);
+    appendLE<uint8_t>(buf, rec.type);
+    appendLE<uint8_t>(buf, zero ? ZeroData : 0);
+    appendLE<uint16_t>(buf, 0);
+    appendLE<uint64_t>(buf, rec.address);
+    if (!zero)
+        buf.insert(buf.end(), data, data + block_size);
+}
+
+uint32_t
+parse(const std::vector<uint8_t> &trace, std::vector<Record> &records)
+{
+    fatal_if(trace.size() < HeaderSize, "Truncated cache trace");
+    fatal_if(loadLE<uint64_t>(trace.data()) != Magic,
+             "Unrecognized cache trace format");
+    const uint32_t block_size = loadLE<uint32_t>(trace.data() + 8);
+    const uint64_t num_records = loadLE<uint64_t>(trace.data() + 16);
+
+    records.clear();
+    size_t offset = HeaderSize;
+    for (uint64_t i = 0; i < num_records; i++) {
+        fatal_if(trace.size() - offset < RecordSize,
+                 "Truncated cache trace");
+        const uint8_t *p = trace.data() + offset;
+        offset += RecordSize;
+
+        Record rec;
+        rec.cntrl = loadLE<uint32_t>(p);
+        rec.type = loadLE<uint8_t>(p + 4);
+        rec.address = loadLE<uint64_t>(p + 8);
+        rec.data = nullptr;
+        if (!(loadLE<uint8_t>(p + 5) & ZeroData)) {
+            fatal_if(trace.size() - offset < block_size,
+                     "Truncated cache trace");
+            rec.data = trace.data() + offset;
+            offset += block_size;
+        }
+        records.push_back(rec);
+    }
+    return block_size;
+}
+
+} // namespace cache_trace
+} // namespace ruby
+} // namespace gem5
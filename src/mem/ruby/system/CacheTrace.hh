@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __MEM_RUBY_SYSTEM_CACHETRACE_HH__
+#define __MEM_RUBY_SYSTEM_CACHETRACE_HH__
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "base/types.hh"
+
+namespace gem5
+{
+
+namespace ruby
+{
+
+/**
+ * Layout of an aggregated cache trace, e.g., in a checkpoint. All fields
+ * are stored in little-endian byte order.
+ *
+ * The trace starts with a header: a magic number (8 bytes), the block
+ * size (4 bytes), 4 reserved bytes and the number of records (8 bytes).
+ * It is followed by one record per recorded block: the controller (4
+ * bytes), the RubyRequestType (1 byte), flags (1 byte), 2 reserved bytes
+ * and the address of the block (8 bytes). The data of the block follows
+ * its record, unless the block only holds zeros.
+ */
+namespace cache_trace
+{
+
+constexpr uint64_t Magic = 0x3143415254425552; // "RUBTRAC1"
+constexpr size_t HeaderSize = 24;
+constexpr size_t RecordSize = 16;
+
+/** The data of the block is all zeros and is not stored. */
+constexpr uint8_t ZeroData = 0x1;
+
+struct Record
+{
+    uint32_t cntrl;
+    uint8_t type;
+    Addr address;
+    /** The data of the block, or nullptr if it only holds zeros. */
+    const uint8_t *data;
+};
+
+/** Append the header of a trace to buf. */
+void appendHeader(std::vector<uint8_t> &buf, uint32_t block_size,
+                  uint64_t num_records);
+
+/**
+ * Append a record to buf. The data is left out if it only holds zeros.
+ *
+ * @param data The data of the block, block_size bytes.
+ */
+void appendRecord(std::vector<uint8_t> &buf, const Record &rec,
+                  const uint8_t *data, uint32_t block_size);
+
+/**
+ * Parse a trace. The data of the records points into the trace.
+ *
+ * @return The block size of the trace.
+ */
+uint32_t parse(const std::vector<uint8_t> &trace,
+               std::vector<Record> &records);
+
+} // namespace cache_trace
+} // namespace ruby
+} // namespace gem5
+
+#endif // __MEM_RUBY_SYSTEM_CACHETRACE_HH__
@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "mem/ruby/system/CacheTrace.hh"
+
+using namespace gem5;
+using namespace gem5::ruby;
+
+namespace
+{
+
+constexpr uint32_t BlockSize = 64;
+
+std::vector<uint8_t>
+makeTrace(const std::vector<cache_trace::Record> &records,
+          const std::vector<std::vector<uint8_t>> &data)
+{
+    std::vector<uint8_t> trace;
+    cache_trace::appendHeader(trace, BlockSize, records.size());
+    for (size_t i = 0; i < records.size(); i++)
+        cache_trace::appendRecord(trace, records[i], data[i].data(),
+                                  BlockSize);
+    return trace;
+}
+
+} // anonymous namespace
+
+/** Records are parsed back in the order they were appended. */
+TEST(CacheTraceTest, RoundTrip)
+{
+    std::vector<uint8_t> block(BlockSize);
+    for (uint32_t i = 0; i < BlockSize; i++)
+        block[i] = i + 1;
+    std::vector<uint8_t> trace = makeTrace(
+        {{3, 1, 0x1000, nullptr}, {0, 2, 0xffffffff00000040, nullptr}},
+        {block, block});
+
+    std::vector<cache_trace::Record> records;
+    ASSERT_EQ(cache_trace::parse(trace, records), BlockSize);
+    ASSERT_EQ(records.size(), 2);
+    EXPECT_EQ(records[0].cntrl, 3);
+    EXPECT_EQ(records[0].type, 1);
+    EXPECT_EQ(records[0].address, 0x1000);
+    EXPECT_EQ(records[1].cntrl, 0);
+    EXPECT_EQ(records[1].type, 2);
+    EXPECT_EQ(records[1].address, 0xffffffff00000040);
+    for (const auto &rec : records) {
+        ASSERT_NE(rec.data, nullptr);
+        EXPECT_EQ(std::vector<uint8_t>(rec.data, rec.data + BlockSize),
+                  block);
+    }
+}
+
+/** The trace has the same bytes on hosts of any byte order. */
+TEST(CacheTraceTest, LittleEndian)
+{
+    std::vector<uint8_t> trace = makeTrace(
+        {{0x01020304, 5, 0x1122334455667788, nullptr}},
+        {std::vector<uint8_t>(BlockSize, 0xff)});
+
+    const std::vector<uint8_t> expected = {
+        // Magic, "RUBTRAC1".
+        'R', 'U', 'B', 'T', 'R', 'A', 'C', '1',
+        // Block size and reserved bytes.
+        64, 0, 0, 0, 0, 0, 0, 0,
+        // Number of records.
+        1, 0, 0, 0, 0, 0, 0, 0,
+        // Controller, type, flags and reserved bytes.
+        0x04, 0x03, 0x02, 0x01, 5, 0, 0, 0,
+        // Address.
+        0x88, 0x77, 0x66, 0x55, 0x44, 0x33, 0x22, 0x11,
+    };
+    ASSERT_EQ(trace.size(), expected.size() + BlockSize);
+    EXPECT_EQ(std::vector<uint8_t>(trace.begin(),
+                                   trace.begin() + expected.size()),
+              expected);
+}
+
+/** Blocks that only hold zeros are stored without their data. */
+TEST(CacheTraceTest, ZeroDataOmitted)
+{
+    std::vector<uint8_t> zero(BlockSize, 0);
+    std::vector<uint8_t> one(BlockSize, 0);
+    one[BlockSize - 1] = 1;
+    std::vector<uint8_t> trace = makeTrace(
+        {{0, 0, 0x0, nullptr}, {1, 0, 0x40, nullptr}}, {zero, one});
+    EXPECT_EQ(trace.size(), cache_trace::HeaderSize +
+              2 * cache_trace::RecordSize + BlockSize);
+
+    std::vector<cache_trace::Record> records;
+    cache_trace::parse(trace, records);
+    ASSERT_EQ(records.size(), 2);
+    EXPECT_EQ(records[0].data, nullptr);
+    ASSERT_NE(records[1].data, nullptr);
+    EXPECT_EQ(records[1].data[BlockSize - 1], 1);
+}
+
+/** Traces that are cut short or of another format are rejected. */
+TEST(CacheTraceTest, Malformed)
+{
+    std::vector<uint8_t> trace = makeTrace(
+        {{0, 0, 0x0, nullptr}}, {std::vector<uint8_t>(BlockSize, 1)});
+    std::vector<cache_trace::Record> records;
+
+    std::vector<uint8_t> truncated(trace.begin(), trace.end() - 1);
+    ASSERT_ANY_THROW(cache_trace::parse(truncated, records));
+
+    truncated.resize(cache_trace::HeaderSize + 1);
+    ASSERT_ANY_THROW(cache_trace::parse(truncated, records));
+
+    truncated.resize(cache_trace::HeaderSize - 1);
+    ASSERT_ANY_THROW(cache_trace::parse(truncated, records));
+
+    std::vector<uint8_t> bad_magic = trace;
+    bad_magic[0] ^= 1;
+    ASSERT_ANY_THROW(cache_trace::parse(bad_magic, records));
+}
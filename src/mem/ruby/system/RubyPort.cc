@@ -232,8 +232,10 @@ RubyPort::PioResponsePort::recvTimingReq(PacketPtr pkt)
 Tick
 RubyPort::PioResponsePort::recvAtomic(PacketPtr pkt)
 {
-    // Only atomic_noncaching mode supported!
-    if (!owner.system->bypassCaches()) {
+    // Only atomic_noncaching mode supported, unless the caches are
+    // functionally warmed!
+    if (!owner.system->bypassCaches() &&
+        !owner.m_ruby_system->getFunctionalWarming()) {
         panic("Ruby supports atomic accesses only in noncaching mode\n");
     }
 
@@ -321,8 +323,12 @@ RubyPort::MemResponsePort::recvTimingReq(PacketPtr pkt)
 Tick
 RubyPort::MemResponsePort::recvAtomic(PacketPtr pkt)
 {
-    // Only atomic_noncaching mode supported!
-    if (!owner.system->bypassCaches()) {
+    RubySystem *rs = owner.m_ruby_system;
+
+    // Only atomic_noncaching mode supported, unless the caches are
+    // functionally warmed!
+    const bool warming = !owner.system->bypassCaches();
+    if (warming && !rs->getFunctionalWarming()) {
         panic("Ruby supports atomic accesses only in noncaching mode\n");
     }
 
@@ -347,8 +353,19 @@ RubyPort::MemResponsePort::recvAtomic(PacketPtr pkt)
                RubySystem::getBlockSizeBytes());
     }
 
+    // Functional warming: the backing store holds the data and the caches
+    // catch up on the accessed lines when the system drains.
+    if (warming) {
+        if (pkt->isRead() || pkt->isWrite()) {
+            rs->recordWarmingAccess(owner.m_controller, pkt);
+            rs->getPhysMem()->access(pkt);
+        } else if (pkt->needsResponse()) {
+            pkt->makeResponse();
+        }
+        return 0;
+    }
+
     // Find the machine type of memory controller interface
-    RubySystem *rs = owner.m_ruby_system;
     static int mem_interface_type = -1;
     if (mem_interface_type == -1) {
         if (rs->m_abstract_controls[MachineType_Directory].size() != 0) {
@@ -498,7 +515,7 @@ RubyPort::ruby_stale_translation_callback(Addr txnId)
     // Allocate the invalidate request and packet on the stack, as it is
     // assumed they will not be modified or deleted by receivers.
     // TODO: should this really be using funcRequestorId?
-    auto request = std::make_shared<Request>(
+    auto request = Request::create(
         0, RubySystem::getBlockSizeBytes(), Request::TLBI_EXT_SYNC,
         Request::funcRequestorId);
     // Store the txnId in extraData instead of the address
@@ -698,7 +715,7 @@ RubyPort::ruby_eviction_callback(Addr address)
     // Allocate the invalidate request and packet on the stack, as it is
     // assumed they will not be modified or deleted by receivers.
     // TODO: should this really be using funcRequestorId?
-    auto request = std::make_shared<Request>(
+    auto request = Request::create(
         address, RubySystem::getBlockSizeBytes(), 0,
         Request::funcRequestorId);
 
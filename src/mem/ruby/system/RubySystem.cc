@@ -41,17 +41,20 @@
 #include "mem/ruby/system/RubySystem.hh"
 
 #include <fcntl.h>
+#include <unistd.h>
 #include <zlib.h>
 
 #include <cstdio>
 #include <list>
 
+#include "base/atomicio.hh"
 #include "base/compiler.hh"
 #include "base/intmath.hh"
 #include "base/statistics.hh"
 #include "debug/RubyCacheTrace.hh"
 #include "debug/RubySystem.hh"
 #include "mem/ruby/common/Address.hh"
+#include "mem/ruby/common/Consumer.hh"
 #include "mem/ruby/network/Network.hh"
 #include "mem/ruby/system/DMASequencer.hh"
 #include "mem/ruby/system/Sequencer.hh"
@@ -78,6 +81,12 @@ bool RubySystem::m_cooldown_enabled = false;
 
 RubySystem::RubySystem(const Params &p)
     : ClockedObject(p), m_access_backing_store(p.access_backing_store),
+      m_functional_warming(p.functional_warming),
+      m_functional_warming_lines(p.functional_warming_lines),
+      m_cache_trace_install_threads(p.cache_trace_install_threads),
+      m_warming_replay(false), m_warming_fetched(false),
+      m_warming_event([this]{ checkWarmingReplay(); },
+                      "RubySystem warming replay"),
       m_cache_recorder(NULL)
 {
     m_randomization = p.randomization;
@@ -173,9 +182,7 @@ RubySystem::~RubySystem()
 }
 
 void
-RubySystem::makeCacheRecorder(uint8_t *uncompressed_trace,
-                              uint64_t cache_trace_size,
-                              uint64_t block_size_bytes)
+RubySystem::makeCacheRecorder(std::vector<uint8_t> &&trace)
 {
     std::vector<RubyPort*> ruby_port_map;
     RubyPort* ruby_port_ptr = NULL;
@@ -211,9 +218,9 @@ RubySystem::makeCacheRecorder(uint8_t *uncompressed_trace,
     }
 
     // Create the CacheRecorder and record the cache trace
-    m_cache_recorder = new CacheRecorder(uncompressed_trace, cache_trace_size,
-                                         ruby_port_map,
-                                         block_size_bytes);
+    m_cache_recorder = new CacheRecorder(std::move(trace), ruby_port_map,
+                                         m_abs_cntrl_vec,
+                                         m_cache_trace_install_threads);
 }
 
 void
@@ -223,7 +230,7 @@ RubySystem::memWriteback()
 
     // Make the trace so we know what to write back.
     DPRINTF(RubyCacheTrace, "Recording Cache Trace\n");
-    makeCacheRecorder(NULL, 0, getBlockSizeBytes());
+    makeCacheRecorder({});
     for (int cntrl = 0; cntrl < m_abs_cntrl_vec.size(); cntrl++) {
         m_abs_cntrl_vec[cntrl]->recordCacheTrace(cntrl, m_cache_recorder);
     }
@@ -297,8 +304,8 @@ RubySystem::memWriteback()
 }
 
 void
-RubySystem::writeCompressedTrace(uint8_t *raw_data, std::string filename,
-                                 uint64_t uncompressed_trace_size)
+RubySystem::writeCacheTrace(const std::vector<uint8_t> &trace,
+                            std::string filename)
 {
     // Create the checkpoint file for the memory
     std::string thefile = CheckpointIn::dir() + "/" + filename.c_str();
@@ -309,20 +316,14 @@ RubySystem::writeCompressedTrace(uint8_t *raw_data, std::string filename,
         fatal("Can't open memory trace file '%s'\n", filename);
     }
 
-    gzFile compressedMemory = gzdopen(fd, "wb");
-    if (compressedMemory == NULL)
-        fatal("Insufficient memory to allocate compression state for %s\n",
-              filename);
-
-    if (gzwrite(compressedMemory, raw_data, uncompressed_trace_size) !=
-        uncompressed_trace_size) {
+    if (atomic_write(fd, trace.data(), trace.size()) !=
+            (ssize_t)trace.size()) {
         fatal("Write failed on memory trace file '%s'\n", filename);
     }
 
-    if (gzclose(compressedMemory)) {
+    if (close(fd)) {
         fatal("Close failed on memory trace file '%s'\n", filename);
     }
-    delete[] raw_data;
 }
 
 void
@@ -343,16 +344,27 @@ RubySystem::serialize(CheckpointOut &cp) const
     }
 
     // Aggregate the trace entries together into a single array
-    uint8_t *raw_data = new uint8_t[4096];
-    uint64_t cache_trace_size = m_cache_recorder->aggregateRecords(
-                                                        &raw_data, 4096);
-    std::string cache_trace_file = name() + ".cache.gz";
-    writeCompressedTrace(raw_data, cache_trace_file, cache_trace_size);
+    std::vector<uint8_t> trace = m_cache_recorder->aggregateRecords();
+    uint64_t cache_trace_size = trace.size();
+    std::string cache_trace_file = name() + ".cache.bin";
+    writeCacheTrace(trace, cache_trace_file);
 
     SERIALIZE_SCALAR(cache_trace_file);
     SERIALIZE_SCALAR(cache_trace_size);
 }
 
+DrainState
+RubySystem::drain()
+{
+    // The CPUs are about to stop accessing memory atomically, e.g., to be
+    // switched to timing CPUs or to take a checkpoint, so bring the caches
+    // up to date with what they have accessed.
+    if (!m_warming_accesses.empty())
+        startWarmingReplay();
+
+    return m_warming_replay ? DrainState::Draining : DrainState::Drained;
+}
+
 void
 RubySystem::drainResume()
 {
@@ -364,6 +376,26 @@ RubySystem::drainResume()
     }
 }
 
+void
+RubySystem::readCacheTrace(std::string filename, std::vector<uint8_t> &trace,
+                           uint64_t trace_size)
+{
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        perror("open");
+        fatal("Unable to open trace file %s", filename);
+    }
+
+    trace.resize(trace_size);
+    if (atomic_read(fd, trace.data(), trace_size) != (ssize_t)trace_size) {
+        fatal("Unable to read complete trace from file %s\n", filename);
+    }
+
+    if (close(fd)) {
+        fatal("Failed to close cache trace file '%s'\n", filename);
+    }
+}
+
 void
 RubySystem::readCompressedTrace(std::string filename, uint8_t *&raw_data,
                                 uint64_t &uncompressed_trace_size)
@@ -398,8 +430,6 @@ RubySystem::readCompressedTrace(std::string filename, uint8_t *&raw_data,
 void
 RubySystem::unserialize(CheckpointIn &cp)
 {
-    uint8_t *uncompressed_trace = NULL;
-
     // This value should be set to the checkpoint-system's block-size.
     // Optional, as checkpoints without it can be run if the
     // checkpoint-system's block-size == current block-size.
@@ -413,19 +443,39 @@ RubySystem::unserialize(CheckpointIn &cp)
     UNSERIALIZE_SCALAR(cache_trace_size);
     cache_trace_file = cp.getCptDir() + "/" + cache_trace_file;
 
-    readCompressedTrace(cache_trace_file, uncompressed_trace,
-                        cache_trace_size);
+    std::vector<uint8_t> trace;
+    const std::string legacy_suffix = ".cache.gz";
+    if (cache_trace_file.size() >= legacy_suffix.size() &&
+        cache_trace_file.compare(cache_trace_file.size() -
+                                 legacy_suffix.size(),
+                                 std::string::npos, legacy_suffix) == 0) {
+        // Checkpoints of older versions of gem5 hold a compressed trace of
+        // TraceRecords.
+        uint8_t *uncompressed_trace = NULL;
+        readCompressedTrace(cache_trace_file, uncompressed_trace,
+                            cache_trace_size);
+        trace = CacheRecorder::convertLegacyTrace(
+            uncompressed_trace, cache_trace_size, block_size_bytes);
+        delete [] uncompressed_trace;
+    } else {
+        readCacheTrace(cache_trace_file, trace, cache_trace_size);
+    }
     m_warmup_enabled = true;
     m_systems_to_warmup++;
 
     // Create the cache recorder that will hang around until startup.
-    makeCacheRecorder(uncompressed_trace, cache_trace_size, block_size_bytes);
+    makeCacheRecorder(std::move(trace));
 }
 
 void
 RubySystem::init()
 {
     registerRequestorIDs();
+
+    // Atomic accesses only update the caches lazily, so the data of the
+    // simulated system must not live in them.
+    fatal_if(m_functional_warming && !m_access_backing_store,
+             "Ruby functional warming requires access_backing_store.");
 }
 
 void
@@ -484,6 +534,118 @@ RubySystem::startup()
     resetStats();
 }
 
+void
+RubySystem::recordWarmingAccess(AbstractController *cntrl, PacketPtr pkt)
+{
+    RubyRequestType type = RubyRequestType_LD;
+    if (pkt->req->isInstFetch())
+        type = RubyRequestType_IFETCH;
+    else if (pkt->isWrite())
+        type = RubyRequestType_ST;
+
+    Addr line = makeLineAddress(pkt->getAddr());
+    auto &lines = m_warming_index[cntrl];
+    auto it = lines.find(line);
+    if (it != lines.end()) {
+        // Move the line to the most recently used position, and keep it
+        // dirty if it has been written to.
+        if (it->second->type == RubyRequestType_ST)
+            type = RubyRequestType_ST;
+        it->second->type = type;
+        m_warming_accesses.splice(m_warming_accesses.end(),
+                                  m_warming_accesses, it->second);
+        return;
+    }
+
+    if (m_warming_accesses.size() >= m_functional_warming_lines) {
+        const WarmingAccess &oldest = m_warming_accesses.front();
+        m_warming_index[oldest.cntrl].erase(oldest.line);
+        m_warming_accesses.pop_front();
+    }
+
+    m_warming_accesses.push_back({cntrl, line, type});
+    lines.emplace(line, std::prev(m_warming_accesses.end()));
+}
+
+void
+RubySystem::startWarmingReplay()
+{
+    DPRINTF(RubyCacheTrace, "Warming up the caches with %d lines\n",
+            m_warming_accesses.size());
+
+    std::unordered_map<AbstractController *, int> cntrl_ids;
+    for (int cntrl = 0; cntrl < m_abs_cntrl_vec.size(); cntrl++)
+        cntrl_ids[m_abs_cntrl_vec[cntrl]] = cntrl;
+
+    // Record the accesses as a cache trace. The trace is replayed from the
+    // latest to the earliest record time, so give the least recently used
+    // line the latest time: the replacement state of the caches then ends
+    // up in the order of the accesses.
+    CacheRecorder warming;
+    Tick time = m_warming_accesses.size();
+    DataBlock data;
+    for (const auto &access : m_warming_accesses) {
+        // The backing store holds the data, copy it along so that the
+        // caches agree with it.
+        data.clear();
+        if (m_phys_mem->getAddrRange().contains(access.line)) {
+            auto req = Request::create(access.line, getBlockSizeBytes(), 0,
+                                       Request::funcRequestorId);
+            Packet pkt(req, MemCmd::ReadReq);
+            pkt.dataStatic(data.getDataMod(0));
+            m_phys_mem->functionalAccess(&pkt);
+        }
+        warming.addRecord(cntrl_ids.at(access.cntrl), access.line, 0,
+                          access.type, time--, data);
+    }
+    m_warming_accesses.clear();
+    m_warming_index.clear();
+
+    makeCacheRecorder(warming.aggregateRecords());
+    m_cache_recorder->setFetchDoneCallback(
+        [this]() { m_warming_fetched = true; });
+
+    // Replay the accesses while the simulated time goes on, so that no
+    // clock or message buffer sees time going backwards, and keep the
+    // system draining until the replay is over.
+    m_warmup_enabled = true;
+    m_warming_replay = true;
+    m_warming_fetched = false;
+    enqueueRubyEvent(curTick());
+    schedule(m_warming_event, clockEdge(Cycles(1)));
+}
+
+void
+RubySystem::checkWarmingReplay()
+{
+    // Wait until all lines have been fetched and the last transactions are
+    // over: their messages, e.g., unblocks, have reached their destination
+    // and no request is waiting for a sequencer or the memory.
+    bool busy = !m_warming_fetched || Consumer::anyWakeupPending();
+    for (AbstractController *cntrl : m_abs_cntrl_vec) {
+        RubyPort *ports[] = {
+            (RubyPort *)cntrl->getCPUSequencer(),
+            (RubyPort *)cntrl->getDMASequencer(),
+            (RubyPort *)cntrl->getGPUCoalescer()
+        };
+        for (RubyPort *port : ports)
+            busy = busy || (port && port->outstandingCount() > 0);
+        busy = busy || cntrl->hasOutstandingMemRequests();
+    }
+    if (busy) {
+        schedule(m_warming_event, clockEdge(Cycles(100)));
+        return;
+    }
+
+    DPRINTF(RubyCacheTrace, "Caches warmed up\n");
+    m_warmup_enabled = false;
+    m_warming_replay = false;
+    delete m_cache_recorder;
+    m_cache_recorder = NULL;
+
+    signalDrainDone();
+}
+
 void
 RubySystem::processRubyEvent()
 {
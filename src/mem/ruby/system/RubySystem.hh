@@ -35,7 +35,9 @@
 #ifndef __MEM_RUBY_SYSTEM_RUBYSYSTEM_HH__
 #define __MEM_RUBY_SYSTEM_RUBYSYSTEM_HH__
 
+#include <list>
 #include <unordered_map>
+#include <vector>
 
 #include "base/callback.hh"
 #include "base/output.hh"
@@ -78,6 +80,7 @@ class RubySystem : public ClockedObject
     memory::SimpleMemory *getPhysMem() { return m_phys_mem; }
     Cycles getStartCycle() { return m_start_cycle; }
     bool getAccessBackingStore() { return m_access_backing_store; }
+    bool getFunctionalWarming() const { return m_functional_warming; }
 
     // Public Methods
     Profiler*
@@ -96,6 +99,7 @@ class RubySystem : public ClockedObject
     void memWriteback() override;
     void serialize(CheckpointOut &cp) const override;
     void unserialize(CheckpointIn &cp) override;
+    DrainState drain() override;
     void drainResume() override;
     void process();
     void init() override;
@@ -103,6 +107,12 @@ class RubySystem : public ClockedObject
     bool functionalRead(Packet *ptr);
     bool functionalWrite(Packet *ptr);
 
+    /**
+     * Remember the line accessed by an atomic access so that it is warmed
+     * in the caches of the controller the next time the system drains.
+     */
+    void recordWarmingAccess(AbstractController *cntrl, PacketPtr pkt);
+
     void registerNetwork(Network*);
     void registerAbstractController(AbstractController*);
     void registerMachineID(const MachineID& mach_id, Network* network);
@@ -121,17 +131,38 @@ class RubySystem : public ClockedObject
     RubySystem(const RubySystem& obj);
     RubySystem& operator=(const RubySystem& obj);
 
-    void makeCacheRecorder(uint8_t *uncompressed_trace,
-                           uint64_t cache_trace_size,
-                           uint64_t block_size_bytes);
+    void makeCacheRecorder(std::vector<uint8_t> &&trace);
 
+    static void readCacheTrace(std::string filename,
+                               std::vector<uint8_t> &trace,
+                               uint64_t trace_size);
     static void readCompressedTrace(std::string filename,
                                     uint8_t *&raw_data,
                                     uint64_t &uncompressed_trace_size);
-    static void writeCompressedTrace(uint8_t *raw_data, std::string file,
-                                     uint64_t uncompressed_trace_size);
+    static void writeCacheTrace(const std::vector<uint8_t> &trace,
+                                std::string file);
 
     void processRubyEvent();
+
+    /**
+     * Start warming the caches with the recorded atomic accesses. The
+     * system keeps draining until the replay is over.
+     */
+    void startWarmingReplay();
+
+    /**
+     * Finish draining once the warming replay is over and Ruby is
+     * quiescent, or check again later.
+     */
+    void checkWarmingReplay();
+
+    struct WarmingAccess
+    {
+        AbstractController *cntrl;
+        Addr line;
+        RubyRequestType type;
+    };
+
   private:
     // configuration parameters
     static bool m_randomization;
@@ -144,6 +175,21 @@ class RubySystem : public ClockedObject
     static bool m_cooldown_enabled;
     memory::SimpleMemory *m_phys_mem;
     const bool m_access_backing_store;
+    const bool m_functional_warming;
+    const uint64_t m_functional_warming_lines;
+    const unsigned m_cache_trace_install_threads;
+
+    /** Accessed lines, from the least to the most recently used. */
+    std::list<WarmingAccess> m_warming_accesses;
+    std::unordered_map<AbstractController *,
+        std::unordered_map<Addr, std::list<WarmingAccess>::iterator>>
+        m_warming_index;
+
+    /** The caches are being warmed, the system cannot be drained yet. */
+    bool m_warming_replay;
+    /** All the lines of the warming replay have been fetched. */
+    bool m_warming_fetched;
+    EventFunctionWrapper m_warming_event;
 
     //std::vector<Network *> m_networks;
     std::vector<std::unique_ptr<Network>> m_networks;
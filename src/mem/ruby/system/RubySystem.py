@@ -57,6 +57,35 @@ class RubySystem(ClockedObject):
         store and only use ruby for timing.",
     )
 
+    # With functional warming, the CPUs may access memory atomically (e.g.,
+    # while an AtomicSimpleCPU fast-forwards). The lines they touch are
+    # remembered and replayed through the protocol when the system drains,
+    # e.g., before switching to timing CPUs, so that the tags, coherence
+    # states and replacement state of the caches are warm. The replay takes
+    # simulated time while the system drains, and its traffic is counted
+    # like any other; reset the statistics after the switch to leave it out.
+    functional_warming = Param.Bool(
+        False,
+        "Warm the caches with the accesses of atomic "
+        "CPUs; requires access_backing_store",
+    )
+    functional_warming_lines = Param.UInt64(
+        1 << 20,
+        "Maximum number of most recently accessed lines "
+        "that are replayed to warm the caches",
+    )
+
+    # The blocks of a cache trace that the controllers can install without
+    # a coherence transaction are installed directly, one controller per
+    # host thread. Replacement policies that draw random numbers, e.g., the
+    # random or BIP policies, share one generator, so only use more than
+    # one thread with policies that do not.
+    cache_trace_install_threads = Param.Unsigned(
+        1,
+        "Host threads that install the blocks of a cache "
+        "trace; 0 uses one thread per controller",
+    )
+
     # Profiler related configuration variables
     hot_lines = Param.Bool(False, "")
     all_instructions = Param.Bool(False, "")
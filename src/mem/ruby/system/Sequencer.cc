@@ -68,7 +68,8 @@ namespace ruby
 {
 
 Sequencer::Sequencer(const Params &p)
-    : RubyPort(p), m_IncompleteTimes(MachineType_NUM),
+    : RubyPort(p), m_RequestTable(p.max_outstanding_requests),
+      m_IncompleteTimes(MachineType_NUM),
       deadlockCheckEvent([this]{ wakeup(); }, "Sequencer deadlock check")
 {
     m_outstanding_count = 0;
@@ -232,25 +233,20 @@ Sequencer::wakeup()
     Cycles current_time = curCycle();
 
     // Check across all outstanding requests
-    [[maybe_unused]] int total_outstanding = 0;
-
-    for (const auto &table_entry : m_RequestTable) {
-        for (const auto &seq_req : table_entry.second) {
-            if (current_time - seq_req.issue_time < m_deadlock_threshold)
-                continue;
-
-            panic("Possible Deadlock detected. Aborting!\n version: %d "
-                  "request.paddr: 0x%x m_readRequestTable: %d current time: "
-                  "%u issue_time: %d difference: %d\n", m_version,
-                  seq_req.pkt->getAddr(), table_entry.second.size(),
-                  current_time * clockPeriod(), seq_req.issue_time
-                  * clockPeriod(), (current_time * clockPeriod())
-                  - (seq_req.issue_time * clockPeriod()));
-        }
-        total_outstanding += table_entry.second.size();
-    }
+    m_RequestTable.forEach([&](Addr addr, const SequencerRequest &seq_req) {
+        if (current_time - seq_req.issue_time < m_deadlock_threshold)
+            return;
+
+        panic("Possible Deadlock detected. Aborting!\n version: %d "
+              "request.paddr: 0x%x m_readRequestTable: %d current time: "
+              "%u issue_time: %d difference: %d\n", m_version,
+              seq_req.pkt->getAddr(), m_RequestTable.count(addr),
+              current_time * clockPeriod(), seq_req.issue_time
+              * clockPeriod(), (current_time * clockPeriod())
+              - (seq_req.issue_time * clockPeriod()));
+    });
 
-    assert(m_outstanding_count == total_outstanding);
+    assert(m_outstanding_count == (int)m_RequestTable.size());
 
     if (m_outstanding_count > 0) {
         // If there are still outstanding requests, keep checking
@@ -263,12 +259,10 @@ Sequencer::functionalWrite(Packet *func_pkt)
 {
     int num_written = RubyPort::functionalWrite(func_pkt);
 
-    for (const auto &table_entry : m_RequestTable) {
-        for (const auto& seq_req : table_entry.second) {
-            if (seq_req.functionalWrite(func_pkt))
-                ++num_written;
-        }
-    }
+    m_RequestTable.forEach([&](Addr, const SequencerRequest &seq_req) {
+        if (seq_req.functionalWrite(func_pkt))
+            ++num_written;
+    });
 
     return num_written;
 }
@@ -361,13 +355,12 @@ Sequencer::insertRequest(PacketPtr pkt, RubyRequestType primary_type,
 
     Addr line_addr = makeLineAddress(pkt->getAddr());
     // Check if there is any outstanding request for the same cache line.
-    auto &seq_req_list = m_RequestTable[line_addr];
     // Create a default entry
-    seq_req_list.emplace_back(pkt, primary_type,
+    m_RequestTable.emplaceBack(line_addr, pkt, primary_type,
         secondary_type, curCycle());
     m_outstanding_count++;
 
-    if (seq_req_list.size() > 1) {
+    if (m_RequestTable.count(line_addr) > 1) {
         return RequestStatus_Aliased;
     }
 
@@ -468,15 +461,14 @@ Sequencer::writeCallback(Addr address, DataBlock& data,
     // to this cache line when response for the write comes back
     //
     assert(address == makeLineAddress(address));
-    assert(m_RequestTable.find(address) != m_RequestTable.end());
-    auto &seq_req_list = m_RequestTable[address];
+    assert(m_RequestTable.contains(address));
 
     // Perform hitCallback on every cpu request made to this cache block while
     // ruby request was outstanding. Since only 1 ruby request was made,
     // profile the ruby latency once.
     bool ruby_request = true;
-    while (!seq_req_list.empty()) {
-        SequencerRequest &seq_req = seq_req_list.front();
+    while (m_RequestTable.contains(address)) {
+        SequencerRequest &seq_req = m_RequestTable.front(address);
         // Atomic Request may be executed remotly in the cache hierarchy
         bool atomic_req =
            ((seq_req.m_type == RubyRequestType_ATOMIC_RETURN) ||
@@ -550,12 +542,7 @@ Sequencer::writeCallback(Addr address, DataBlock& data,
                         initialRequestTime, forwardRequestTime,
                         firstResponseTime, !ruby_request);
         }
-        seq_req_list.pop_front();
-    }
-
-    // free all outstanding requests corresponding to this address
-    if (seq_req_list.empty()) {
-        m_RequestTable.erase(address);
+        m_RequestTable.popFront(address);
     }
 }
 
@@ -571,15 +558,14 @@ Sequencer::readCallback(Addr address, DataBlock& data,
     // or end of the corresponding list.
     //
     assert(address == makeLineAddress(address));
-    assert(m_RequestTable.find(address) != m_RequestTable.end());
-    auto &seq_req_list = m_RequestTable[address];
+    assert(m_RequestTable.contains(address));
 
     // Perform hitCallback on every cpu request made to this cache block while
     // ruby request was outstanding. Since only 1 ruby request was made,
     // profile the ruby latency once.
     bool ruby_request = true;
-    while (!seq_req_list.empty()) {
-        SequencerRequest &seq_req = seq_req_list.front();
+    while (m_RequestTable.contains(address)) {
+        SequencerRequest &seq_req = m_RequestTable.front(address);
         if (ruby_request) {
             assert((seq_req.m_type == RubyRequestType_LD) ||
                    (seq_req.m_type == RubyRequestType_Load_Linked) ||
@@ -603,12 +589,7 @@ Sequencer::readCallback(Addr address, DataBlock& data,
                     initialRequestTime, forwardRequestTime,
                     firstResponseTime, !ruby_request);
         ruby_request = false;
-        seq_req_list.pop_front();
-    }
-
-    // free all outstanding requests corresponding to this address
-    if (seq_req_list.empty()) {
-        m_RequestTable.erase(address);
+        m_RequestTable.popFront(address);
     }
 }
 
@@ -626,14 +607,13 @@ Sequencer::atomicCallback(Addr address, DataBlock& data,
     // (the opperation could be performed remotly)
     //
     assert(address == makeLineAddress(address));
-    assert(m_RequestTable.find(address) != m_RequestTable.end());
-    auto &seq_req_list = m_RequestTable[address];
+    assert(m_RequestTable.contains(address));
 
     // Perform hitCallback only on the first cpu request that
     // issued the ruby request
     bool ruby_request = true;
-    while (!seq_req_list.empty()) {
-        SequencerRequest &seq_req = seq_req_list.front();
+    while (m_RequestTable.contains(address)) {
+        SequencerRequest &seq_req = m_RequestTable.front(address);
 
         if (ruby_request) {
             // Check that the request was an atomic memory operation
@@ -659,12 +639,7 @@ Sequencer::atomicCallback(Addr address, DataBlock& data,
         hitCallback(&seq_req, data, true, mach, externalHit,
                     initialRequestTime, forwardRequestTime,
                     firstResponseTime, false);
-        seq_req_list.pop_front();
-    }
-
-    // free all outstanding requests corresponding to this address
-    if (seq_req_list.empty()) {
-        m_RequestTable.erase(address);
+        m_RequestTable.popFront(address);
     }
 }
 
@@ -1126,16 +1101,17 @@ Sequencer::issueRequest(PacketPtr pkt, RubyRequestType secondary_type)
     m_mandatory_q_ptr->enqueue(msg, clockEdge(), latency);
 }
 
-template <class KEY, class VALUE>
-std::ostream &
-operator<<(std::ostream &out, const std::unordered_map<KEY, VALUE> &map)
+static std::ostream &
+operator<<(std::ostream &out, const RequestTable<SequencerRequest> &table)
 {
-    for (const auto &table_entry : map) {
-        out << "[ " << table_entry.first << " =";
-        for (const auto &seq_req : table_entry.second) {
-            out << " " << RubyRequestType_to_string(seq_req.m_second_type);
+    Addr last_addr = MaxAddr;
+    table.forEach([&](Addr addr, const SequencerRequest &seq_req) {
+        if (addr != last_addr) {
+            out << "[ " << addr << " =";
+            last_addr = addr;
         }
-    }
+        out << " " << RubyRequestType_to_string(seq_req.m_second_type);
+    });
     out << " ]";
 
     return out;
@@ -50,6 +50,7 @@
 #include "mem/ruby/protocol/RubyRequestType.hh"
 #include "mem/ruby/protocol/SequencerRequestType.hh"
 #include "mem/ruby/structures/CacheMemory.hh"
+#include "mem/ruby/structures/RequestTable.hh"
 #include "mem/ruby/system/RubyPort.hh"
 #include "params/RubySequencer.hh"
 
@@ -232,8 +233,10 @@ class Sequencer : public RubyPort
     Sequencer& operator=(const Sequencer& obj);
 
   protected:
-    // RequestTable contains both read and write requests, handles aliasing
-    std::unordered_map<Addr, std::list<SequencerRequest>> m_RequestTable;
+    // RequestTable contains both read and write requests, handles aliasing.
+    // It is sized from max_outstanding_requests so that issuing and
+    // retiring requests does not allocate.
+    RequestTable<SequencerRequest> m_RequestTable;
     // UnadressedRequestTable contains "unaddressed" requests,
     // guaranteed not to alias each other
     std::unordered_map<uint64_t, SequencerRequest> m_UnaddressedRequestTable;
@@ -27,15 +27,112 @@
 
 #include "mem/thread_bridge.hh"
 
+#include "base/logging.hh"
 #include "base/trace.hh"
 #include "sim/eventq.hh"
+#include "sim/simulate.hh"
 
 namespace gem5
 {
 
 ThreadBridge::ThreadBridge(const ThreadBridgeParams &p)
-    : SimObject(p), in_port_("in_port", *this), out_port_("out_port", *this)
+    : SimObject(p), in_port_("in_port", *this), out_port_("out_port", *this),
+      initiator_eventq_(getEventQueue(p.initiator_eventq_index)),
+      delay_(p.delay)
 {
+    // Timing packets only cross the bridge as events delayed by delay_,
+    // which bounds how far the two queues can run ahead of each other.
+    if (p.initiator_eventq_index != p.eventq_index && delay_ > 0) {
+        declareLookahead(p.initiator_eventq_index, p.eventq_index, delay_);
+        declareLookahead(p.eventq_index, p.initiator_eventq_index, delay_);
+    }
+}
+
+void
+ThreadBridge::init()
+{
+    SimObject::init();
+
+    if (initiator_eventq_ == eventQueue())
+        return;
+
+    // Packets are scheduled on the other side's queue, which may already
+    // be up to one synchronization window ahead of the sender.
+    fatal_if(delay_ == 0, "%s: Bridging two event queues needs a non-zero "
+             "delay.", name());
+    fatal_if(!lookaheadSync && delay_ < simQuantum, "%s: The delay (%d) "
+             "must be at least the simulation quantum (%d).", name(), delay_,
+             simQuantum);
+}
+
+void
+ThreadBridge::deliver(EventQueue *eventq, PacketPtr pkt, bool is_resp)
+{
+    DeliveryEvent *event;
+    {
+        std::lock_guard<std::mutex> lock(delivery_lock_);
+        if (free_deliveries_.empty()) {
+            deliveries_.emplace_back(new DeliveryEvent(*this));
+            event = deliveries_.back().get();
+        } else {
+            event = free_deliveries_.back();
+            free_deliveries_.pop_back();
+        }
+    }
+
+    event->pkt = pkt;
+    event->isResp = is_resp;
+    eventq->schedule(event, curTick() + delay_);
+}
+
+void
+ThreadBridge::retire(DeliveryEvent *event)
+{
+    DeliveryEvent *&retired = event->isResp ? retired_resp_ : retired_req_;
+    if (retired) {
+        std::lock_guard<std::mutex> lock(delivery_lock_);
+        free_deliveries_.push_back(retired);
+    }
+    retired = event;
+}
+
+void
+ThreadBridge::DeliveryEvent::process()
+{
+    PacketPtr delivered = pkt;
+    pkt = nullptr;
+    device_.retire(this);
+
+    if (isResp)
+        device_.sendTimingResp(delivered);
+    else
+        device_.sendTimingReq(delivered);
+}
+
+const std::string
+ThreadBridge::DeliveryEvent::name() const
+{
+    return device_.name() + ".delivery";
+}
+
+const char *
+ThreadBridge::DeliveryEvent::description() const
+{
+    return "ThreadBridge delivery";
+}
+
+void
+ThreadBridge::sendTimingReq(PacketPtr pkt)
+{
+    if (!pending_reqs_.empty() || !out_port_.sendTimingReq(pkt))
+        pending_reqs_.push_back(pkt);
+}
+
+void
+ThreadBridge::sendTimingResp(PacketPtr pkt)
+{
+    if (!pending_resps_.empty() || !in_port_.sendTimingResp(pkt))
+        pending_resps_.push_back(pkt);
 }
 
 ThreadBridge::IncomingPort::IncomingPort(const std::string &name,
@@ -54,12 +151,17 @@ ThreadBridge::IncomingPort::getAddrRanges() const
 bool
 ThreadBridge::IncomingPort::recvTimingReq(PacketPtr pkt)
 {
-    panic("ThreadBridge only supports atomic/functional access.");
+    // Called from the initiator's thread. Never touch the other side
+    // directly, hand the packet over to the bridge's event queue instead.
+    device_.deliver(device_.eventQueue(), pkt, false);
+    return true;
 }
 void
 ThreadBridge::IncomingPort::recvRespRetry()
 {
-    panic("ThreadBridge only supports atomic/functional access.");
+    auto &pending = device_.pending_resps_;
+    while (!pending.empty() && sendTimingResp(pending.front()))
+        pending.pop_front();
 }
 
 // AtomicResponseProtocol
@@ -94,12 +196,15 @@ ThreadBridge::OutgoingPort::recvRangeChange()
 bool
 ThreadBridge::OutgoingPort::recvTimingResp(PacketPtr pkt)
 {
-    panic("ThreadBridge only supports atomic/functional access.");
+    device_.deliver(device_.initiator_eventq_, pkt, true);
+    return true;
 }
 void
 ThreadBridge::OutgoingPort::recvReqRetry()
 {
-    panic("ThreadBridge only supports atomic/functional access.");
+    auto &pending = device_.pending_reqs_;
+    while (!pending.empty() && sendTimingReq(pending.front()))
+        pending.pop_front();
 }
 
 Port &
@@ -28,8 +28,14 @@
 #ifndef __MEM_THREAD_BRIDGE_HH__
 #define __MEM_THREAD_BRIDGE_HH__
 
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
 #include "mem/port.hh"
 #include "params/ThreadBridge.hh"
+#include "sim/eventq.hh"
 #include "sim/sim_object.hh"
 
 namespace gem5
@@ -40,6 +46,8 @@ class ThreadBridge : public SimObject
   public:
     explicit ThreadBridge(const ThreadBridgeParams &p);
 
+    void init() override;
+
     Port &getPort(const std::string &if_name,
                   PortID idx = InvalidPortID) override;
 
@@ -78,8 +86,67 @@ class ThreadBridge : public SimObject
         ThreadBridge &device_;
     };
 
+    /**
+     * Delivers a timing packet on the other side of the bridge. It is
+     * scheduled from one thread and serviced on the other, so events are
+     * recycled through a pool instead of being allocated per packet.
+     */
+    class DeliveryEvent : public Event
+    {
+      public:
+        explicit DeliveryEvent(ThreadBridge &device) : device_(device) {}
+
+        void process() override;
+        const std::string name() const override;
+        const char *description() const override;
+
+        PacketPtr pkt = nullptr;
+        bool isResp = false;
+
+      private:
+        ThreadBridge &device_;
+    };
+
+    /** Schedule the delivery of a packet on the given event queue. */
+    void deliver(EventQueue *eventq, PacketPtr pkt, bool is_resp);
+
+    /** Return a serviced delivery event to the pool. */
+    void retire(DeliveryEvent *event);
+
+    /** Send a request on out_port, on the bridge's event queue. */
+    void sendTimingReq(PacketPtr pkt);
+
+    /** Send a response on in_port, on the initiator's event queue. */
+    void sendTimingResp(PacketPtr pkt);
+
     IncomingPort in_port_;
     OutgoingPort out_port_;
+
+    /** Event queue of the objects sending requests to in_port. */
+    EventQueue *initiator_eventq_;
+
+    /** Delay of timing packets crossing the bridge. */
+    const Tick delay_;
+
+    /**
+     * Packets waiting for a retry. Each queue is only accessed from the
+     * thread of the side it sends to.
+     */
+    std::deque<PacketPtr> pending_reqs_;
+    std::deque<PacketPtr> pending_resps_;
+
+    /** All delivery events, and those that can be scheduled again. */
+    std::mutex delivery_lock_;
+    std::vector<std::unique_ptr<DeliveryEvent>> deliveries_;
+    std::vector<DeliveryEvent *> free_deliveries_;
+
+    /**
+     * Last event serviced on each side. The event queue still looks at
+     * an event after processing it, so it only goes back to the pool once
+     * the next event of the same side has been serviced.
+     */
+    DeliveryEvent *retired_req_ = nullptr;
+    DeliveryEvent *retired_resp_ = nullptr;
 };
 
 }  // namespace gem5
@@ -107,6 +107,13 @@ BaseXBar::getPort(const std::string &if_name, PortID idx)
 void
 BaseXBar::calcPacketTiming(PacketPtr pkt, Tick header_delay)
 {
+    // a packet from another event queue would be handled on that queue's
+    // thread, racing with this one and depending on the host timing
+    fatal_if(curEventQueue() != eventQueue(), "%s: Timing packet sent "
+             "from %s, but the crossbar is on %s. Connect objects on other "
+             "event queues through a ThreadBridge.", name(),
+             curEventQueue()->name(), eventQueue()->name());
+
     // the crossbar will be called at a time that is not necessarily
     // coinciding with its own clock, so start by determining how long
     // until the next clock edge (could be zero)
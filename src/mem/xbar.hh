@@ -67,6 +67,10 @@ namespace gem5
  *
  * The BaseXBar is responsible for the basic flow control (busy or
  * not), the administration of retries, and the address decoding.
+ *
+ * All objects sending timing packets through a crossbar must be on its
+ * event queue. Objects on other event queues have to be connected through
+ * a ThreadBridge, which hands the packets over with a lookahead.
  */
 class BaseXBar : public ClockedObject
 {
@@ -39,6 +39,7 @@ from ..components.processors.abstract_processor import AbstractProcessor
 from ..components.processors.spatter_gen import SpatterGenerator
 from ..components.processors.switchable_processor import SwitchableProcessor
 from ..resources.resource import SimpointResource
+from ..utils.smarts import SmartsSampler
 
 """
 In this package we store generators for simulation exit events.
@@ -224,6 +225,20 @@ def looppoint_save_checkpoint_generator(
     yield True
 
 
+def smarts_sampling_generator(sampler: SmartsSampler):
+    """
+    A generator for SMARTS-style sampling, to be used for ``MAX_INSTS`` exit
+    events. At every event it switches between fast-forwarding, warming up
+    and measuring a detailed window as described in ``SmartsSampler``.
+
+    The Simulation run loop will exit once the sampler has reached its target
+    error or its maximum number of samples.
+    """
+    while not sampler.handle_max_insts():
+        yield False
+    yield True
+
+
 def spatter_exit_generator(spatter_gen: SpatterGenerator):
     while True:
         assert isinstance(spatter_gen, SpatterGenerator)
@@ -29,9 +29,11 @@ import sys
 from io import StringIO
 from pathlib import Path
 from typing import (
+    Any,
     Callable,
     Dict,
     Generator,
+    Iterable,
     List,
     Optional,
     Tuple,
@@ -782,3 +784,54 @@ class Simulator:
                                will be saved.
         """
         m5.checkpoint(str(checkpoint_dir))
+
+    def run_samples(
+        self,
+        samples: Iterable[Any],
+        run_sample: Callable[["Simulator", Any], Any],
+        max_parallel: Optional[int] = None,
+        reset_stats: bool = True,
+        dump_stats: bool = True,
+    ) -> List[Any]:
+        """
+        Simulate samples in parallel child processes forked from the current
+        state of the simulation.
+
+        This allows a checkpoint to be restored and the simulation warmed up
+        once, after which every sample (e.g., a detailed window of a SMARTS
+        or SimPoint style sampled simulation) starts from that state in its
+        own process. The children share the memory of this process
+        copy-on-write. The output of sample ``N`` is written to the output
+        directory with the suffix ``.sN`` added.
+
+        .. note::
+
+            Forking requires the listeners (e.g., the GDB and terminal ports)
+            to be disabled with ``m5.disableAllListeners()`` before the
+            simulation is instantiated.
+
+        :param samples: The sample descriptions.
+        :param run_sample: Function called in the child with this simulator
+                           and a sample description. It typically runs the
+                           simulation through ``run()``. Its return value
+                           must be picklable and becomes the result of the
+                           sample.
+        :param max_parallel: The maximum number of samples simulated at the
+                             same time. Defaults to the number of host CPUs.
+        :param reset_stats: Reset the statistics before a sample is
+                            simulated.
+        :param dump_stats: Dump the statistics after a sample has been
+                           simulated.
+
+        :returns: The results of the samples, in the order of ``samples``.
+        """
+
+        self._instantiate()
+
+        return m5.forkSamples(
+            samples,
+            lambda sample: run_sample(self, sample),
+            max_parallel=max_parallel,
+            reset_stats=reset_stats,
+            dump_stats=dump_stats,
+        )
@@ -0,0 +1,259 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+import math
+from statistics import NormalDist
+from typing import (
+    List,
+    Optional,
+)
+
+import m5
+from m5.util import warn
+
+from ..components.processors.switchable_processor import SwitchableProcessor
+
+
+class SmartsSampler:
+    """
+    This class drives a SMARTS-style sampled simulation on a
+    SwitchableProcessor.
+
+    The simulation alternates between fast-forwarding on the fast cores
+    (e.g., atomic or KVM cores) and short detailed windows on the detailed
+    cores. Every ``period`` instructions, the processor is switched to the
+    detailed cores, which first run ``warmup`` instructions to warm up the
+    state that is not kept while fast-forwarding (e.g., the pipeline and
+    branch predictors) and then ``measure`` instructions whose cycles per
+    instruction (CPI) are recorded. Caches are warmed functionally by the
+    accesses of the fast cores.
+
+    The mean CPI and its confidence interval are updated after every window,
+    and the sampling stops once the relative error of the mean is below the
+    target error.
+
+    The sampler is driven by ``MAX_INSTS`` exit events, which it schedules
+    itself, through ``smarts_sampling_generator``:
+
+    .. code-block:: python
+
+        sampler = SmartsSampler(
+            processor=processor,
+            fast_cores="start",
+            detailed_cores="switch",
+            period=1000000,
+            warmup=2000,
+            measure=1000,
+        )
+        simulator = Simulator(
+            board=board,
+            on_exit_event={
+                ExitEvent.MAX_INSTS: smarts_sampling_generator(sampler)
+            },
+        )
+        simulator.schedule_max_insts(sampler.get_fast_forward_insts())
+        simulator.run()
+        print(sampler.get_cpi_mean(), sampler.get_relative_error())
+
+    .. warning::
+
+        Sampling only works with one core.
+    """
+
+    def __init__(
+        self,
+        processor: SwitchableProcessor,
+        fast_cores: str,
+        detailed_cores: str,
+        period: int,
+        warmup: int,
+        measure: int,
+        confidence: float = 0.997,
+        target_error: float = 0.03,
+        min_samples: int = 30,
+        max_samples: Optional[int] = None,
+        reset_stats: bool = True,
+        dump_stats: bool = False,
+    ) -> None:
+        """
+        :param processor: The processor to sample. It must start on the fast
+                          cores.
+        :param fast_cores: The key of the cores used to fast-forward.
+        :param detailed_cores: The key of the cores used for the detailed
+                               windows.
+        :param period: The number of instructions between the starts of two
+                       detailed windows.
+        :param warmup: The number of instructions simulated in detail before
+                       each measurement.
+        :param measure: The number of instructions measured in each window.
+        :param confidence: The confidence level of the confidence interval.
+                           The default of 99.7% matches the SMARTS paper.
+        :param target_error: The relative half-width of the confidence
+                             interval at which the sampling stops.
+        :param min_samples: The minimum number of windows measured before
+                            the target error is checked.
+        :param max_samples: The maximum number of windows measured. There is
+                            no limit if ``None``.
+        :param reset_stats: Reset the statistics before each measurement so
+                            they only cover the measured instructions.
+        :param dump_stats: Dump the statistics after each measurement.
+        """
+
+        if period <= warmup + measure:
+            raise ValueError(
+                "The sampling period must be longer than the warmup and the "
+                "measurement."
+            )
+        if measure <= 0:
+            raise ValueError("The measurement must be at least 1 instruction.")
+        if not 0 < confidence < 1:
+            raise ValueError("The confidence must be between 0 and 1.")
+        if processor.get_num_cores() > 1:
+            warn("SMARTS sampling only works with one core")
+
+        self._processor = processor
+        self._fast_cores = fast_cores
+        self._detailed_cores = detailed_cores
+        self._fast_forward = period - warmup - measure
+        self._warmup = warmup
+        self._measure = measure
+        self._z = NormalDist().inv_cdf((1 + confidence) / 2)
+        self._target_error = target_error
+        self._min_samples = max(min_samples, 2)
+        self._max_samples = max_samples
+        self._reset_stats = reset_stats
+        self._dump_stats = dump_stats
+
+        self._cpis = []
+        # Running mean and sum of squared deviations (Welford's algorithm).
+        self._mean = 0.0
+        self._m2 = 0.0
+
+        self._detailed = False
+        self._measuring = False
+        self._start_tick = 0
+        self._start_insts = 0
+
+    def get_fast_forward_insts(self) -> int:
+        """
+        Returns the number of instructions fast-forwarded before each
+        detailed window.
+        """
+        return self._fast_forward
+
+    def get_cpis(self) -> List[float]:
+        """Returns the CPI measured in every window so far."""
+        return self._cpis
+
+    def get_num_samples(self) -> int:
+        return len(self._cpis)
+
+    def get_cpi_mean(self) -> float:
+        return self._mean
+
+    def get_cpi_stdev(self) -> float:
+        n = len(self._cpis)
+        return math.sqrt(self._m2 / (n - 1)) if n > 1 else 0.0
+
+    def get_confidence_interval(self) -> float:
+        """Returns the half-width of the confidence interval of the mean."""
+        n = len(self._cpis)
+        return self._z * self.get_cpi_stdev() / math.sqrt(n) if n else math.inf
+
+    def get_relative_error(self) -> float:
+        """
+        Returns the half-width of the confidence interval relative to the
+        mean CPI.
+        """
+        if not self._mean:
+            return math.inf
+        return self.get_confidence_interval() / self._mean
+
+    def is_done(self) -> bool:
+        """
+        Returns ``True`` when enough windows have been measured, either
+        because the target error is reached or because the maximum number
+        of samples is.
+        """
+        n = len(self._cpis)
+        if self._max_samples is not None and n >= self._max_samples:
+            return True
+        return (
+            n >= self._min_samples
+            and self.get_relative_error() <= self._target_error
+        )
+
+    def _core(self):
+        return self._processor.get_cores()[0].get_simobject()
+
+    def _schedule(self, insts: int) -> None:
+        self._processor.get_cores()[0]._set_inst_stop_any_thread(insts, True)
+
+    def handle_max_insts(self) -> bool:
+        """
+        Advances the sampling when the instruction count scheduled by the
+        sampler is reached. Returns ``True`` once the sampling is done.
+        """
+        if not self._detailed:
+            # End of a fast-forward.
+            self._processor.switch_to_processor(self._detailed_cores)
+            self._detailed = True
+            if self._warmup:
+                self._measuring = False
+                self._schedule(self._warmup)
+                return False
+        elif self._measuring:
+            self._record_window()
+            if self.is_done():
+                return True
+            self._processor.switch_to_processor(self._fast_cores)
+            self._detailed = False
+            self._schedule(self._fast_forward)
+            return False
+
+        # End of a warmup, or of a fast-forward without warmup.
+        if self._reset_stats:
+            m5.stats.reset()
+        self._measuring = True
+        self._start_tick = m5.curTick()
+        self._start_insts = self._core().totalInsts()
+        self._schedule(self._measure)
+        return False
+
+    def _record_window(self) -> None:
+        core = self._core()
+        cycles = (m5.curTick() - self._start_tick) / core.clockPeriod()
+        insts = core.totalInsts() - self._start_insts
+        if self._dump_stats:
+            m5.stats.dump()
+        if insts == 0:
+            return
+
+        cpi = cycles / insts
+        self._cpis.append(cpi)
+        delta = cpi - self._mean
+        self._mean += delta / len(self._cpis)
+        self._m2 += delta * (cpi - self._mean)
@@ -176,6 +176,23 @@ def parse_options():
     option(
         "-v", "--verbose", action="count", default=0, help="Increase verbosity"
     )
+    option(
+        "--eventq-backend",
+        metavar="{list,calendar}",
+        choices=("list", "calendar"),
+        default="list",
+        help="Data structure used to sort the events on the main event "
+        "queues. Both service events in the same order, but 'calendar' "
+        "scales better with many pending events [Default: %default]",
+    )
+    option(
+        "--no-pool-alloc",
+        action="store_true",
+        default=False,
+        help="Allocate packets, requests and their payloads from the "
+        "global heap instead of recycling them through per-thread "
+        "pools, e.g., to track leaks with a sanitizer",
+    )
 
     # To make gem5 mimic python better. After `-c` we should consume all other
     # arguments and add those to argv.
@@ -382,6 +399,7 @@ def main():
     from m5.util.terminal_formatter import TerminalFormatter
 
     import _m5.core
+    import _m5.event
 
     from . import (
         core,
@@ -402,6 +420,19 @@ def main():
 
     m5.options = options
 
+    # The backend has to be selected before the main event queues are
+    # created.
+    backends = {
+        "list": _m5.event.EventQueueBackend.List,
+        "calendar": _m5.event.EventQueueBackend.Calendar,
+    }
+    _m5.event.setMainEventQueueBackend(backends[options.eventq_backend])
+
+    # Likewise, pooling can only be switched off before the first
+    # packet is allocated.
+    if options.no_pool_alloc:
+        _m5.core.setPoolAllocEnabled(False)
+
     # Set the main event queue for the main thread.
     event.mainq = event.getEventQueue(0)
     event.setEventQueue(event.mainq)
@@ -321,7 +321,12 @@ def memInvalidate(root):
         obj.memInvalidate()
 
 
-def checkpoint(dir):
+def checkpoint(dir, binary=None):
+    """Write a checkpoint of the simulation to dir.
+
+    :param binary: Write the indexed binary format instead of the INI one.
+                   Defaults to the binary_checkpoint parameter of the root.
+    """
     root = objects.Root.getInstance()
     if not isinstance(root, objects.Root):
         raise TypeError("Checkpoint must be called on a root object.")
@@ -333,7 +338,9 @@ def checkpoint(dir):
     os.makedirs(dir, exist_ok=True)
 
     print("Writing checkpoint")
-    _m5.core.serializeAll(dir)
+    if binary is None:
+        binary = root.binary_checkpoint
+    _m5.core.serializeAll(dir, bool(binary))
 
 
 def _changeMemoryMode(system, mode):
@@ -493,6 +500,154 @@ def fork(simout="%(parent)s.f%(fork_seq)i"):
     return pid
 
 
+def forkSamples(
+    samples,
+    run_sample,
+    max_parallel=None,
+    simout="%(parent)s.s%(sample)i",
+    reset_stats=True,
+    dump_stats=True,
+):
+    """Simulate samples in parallel child processes.
+
+    Every sample is simulated in a child created with fork(), so the
+    children start from the current state of the simulator and share
+    its memory copy-on-write. This makes it cheap to restore a
+    checkpoint and warm up once and then simulate many detailed
+    windows or configurations from that point. Each child gets its own
+    output directory and the values returned by run_sample are sent
+    back to the parent.
+
+    Output directory formatting dictionary:
+      parent -- Path to the parent process's output directory.
+      sample -- Index of the sample in samples.
+
+    Arguments:
+      samples -- Iterable of sample descriptions.
+      run_sample -- Function called in the child with the sample
+                    description. It typically calls simulate() and its
+                    return value, which must be picklable, becomes the
+                    result of the sample.
+
+    Keyword Arguments:
+      max_parallel -- Maximum number of children running at the same
+                      time. Defaults to the number of host CPUs.
+      simout -- Output directory of each child.
+      reset_stats -- Reset the statistics in the child before the
+                     sample is simulated.
+      dump_stats -- Dump the statistics in the child after the sample
+                    has been simulated.
+
+    Return Value:
+      List with the result of every sample, in the order of samples.
+    """
+    import pickle
+    import selectors
+    import traceback
+
+    from m5 import options
+
+    if not _m5.core.listenersDisabled():
+        raise RuntimeError("Can not fork a simulator with listeners enabled")
+
+    samples = list(samples)
+    if max_parallel is None:
+        max_parallel = os.cpu_count() or 1
+    if max_parallel < 1:
+        raise ValueError("max_parallel must be at least 1")
+
+    results = [None] * len(samples)
+    failures = []
+    selector = selectors.DefaultSelector()
+    running = {}
+    parent = options.outdir
+    next_sample = 0
+
+    def start(index):
+        outdir = simout % {"parent": parent, "sample": index}
+        rfd, wfd = os.pipe()
+        sys.stdout.flush()
+        sys.stderr.flush()
+        pid = fork(simout=outdir.replace("%", "%%"))
+        if pid == 0:
+            os.close(rfd)
+            status = 0
+            try:
+                if reset_stats:
+                    stats.reset()
+                reply = (True, run_sample(samples[index]))
+                if dump_stats:
+                    stats.dump()
+            except BaseException:
+                reply = (False, traceback.format_exc())
+                status = 1
+            try:
+                with os.fdopen(wfd, "wb") as pipe:
+                    pickle.dump(reply, pipe)
+            except BaseException:
+                traceback.print_exc()
+                status = 1
+            sys.stdout.flush()
+            sys.stderr.flush()
+            _m5.core.doExitCleanup()
+            # Leave without running the parent's atexit handlers or
+            # unwinding through the rest of its script.
+            os._exit(status)
+
+        os.close(wfd)
+        running[rfd] = (pid, index, [])
+        selector.register(rfd, selectors.EVENT_READ)
+
+    def finish(rfd):
+        pid, index, chunks = running.pop(rfd)
+        selector.unregister(rfd)
+        os.close(rfd)
+        _, status = os.waitpid(pid, 0)
+        try:
+            ok, value = pickle.loads(b"".join(chunks))
+        except Exception:
+            ok = False
+            if os.WIFSIGNALED(status):
+                value = f"child {pid} was killed by signal "
+                value += str(os.WTERMSIG(status))
+            else:
+                value = f"child {pid} exited with status "
+                value += str(os.WEXITSTATUS(status))
+        if ok:
+            results[index] = value
+        else:
+            failures.append((index, value))
+
+    try:
+        while next_sample < len(samples) or running:
+            while next_sample < len(samples) and len(running) < max_parallel:
+                start(next_sample)
+                next_sample += 1
+
+            # Keep draining the pipes while the children run so large
+            # results never block them.
+            for key, _ in selector.select():
+                data = os.read(key.fd, 1 << 16)
+                if data:
+                    running[key.fd][2].append(data)
+                else:
+                    finish(key.fd)
+    finally:
+        selector.close()
+
+    if failures:
+        failures.sort()
+        raise RuntimeError(
+            "Sample(s) %s failed:\n%s"
+            % (
+                ", ".join(str(index) for index, _ in failures),
+                "\n".join(f"[{index}] {error}" for index, error in failures),
+            )
+        )
+
+    return results
+
+
 from _m5.core import (
     curTick,
     disableAllListeners,
@@ -190,6 +190,35 @@ def _hdf5Factory(fn, chunking=10, desc=True, formulas=True):
     return _m5.stats.initHDF5(fn, chunking, desc, formulas)
 
 
+@_url_factory(["columnar"])
+def _columnarFactory(fn, desc=True):
+    """Output stats in a binary columnar format.
+
+    The names, descriptions and units of the stats are written once,
+    after which every dump only appends the current tick and the packed
+    stat values. This makes dumps much cheaper and the files much
+    smaller than the text format, which matters when stats are dumped
+    periodically. Dumps are written as they happen, so partial files
+    from running simulations are valid. Use util/columnar_stats.py to
+    load the dumps into arrays.
+
+    Unlike in the text format, stats are not skipped when their
+    prerequisite is zero, so that every full dump has the same layout.
+
+    Known limitations:
+      * Sparse histograms are unsupported.
+
+    Parameters:
+      * desc (bool): Output stat descriptions (default: True)
+
+    Example:
+      columnar://stats.bin?desc=False
+
+    """
+
+    return _m5.stats.initColumnar(fn, desc)
+
+
 @_url_factory(["json"])
 def _jsonFactory(fn):
     """Output stats in JSON format.
@@ -343,6 +372,10 @@ def enable():
 
     _m5.stats.enable()
 
+    root = Root.getInstance()
+    if root and root.flat_stats:
+        _m5.stats.flattenStats(root.getCCObject())
+
 
 def prepare():
     """Prepare all stats for data access.  This must be done before
@@ -49,6 +49,7 @@
 #include "base/inet.hh"
 #include "base/loader/elf_object.hh"
 #include "base/logging.hh"
+#include "base/pool_alloc.hh"
 #include "base/random.hh"
 #include "base/socket.hh"
 #include "base/temperature.hh"
@@ -311,6 +312,8 @@ pybind_init_core(py::module_ &m_native)
         .def("listenersDisabled", &ListenSocket::allDisabled)
         .def("listenersLoopbackOnly", &ListenSocket::loopbackOnly)
         .def("seedRandom", [](uint64_t seed) { random_mt.init(seed); })
+        .def("setPoolAllocEnabled", &SlabPool::setEnabled)
+        .def("poolAllocEnabled", &SlabPool::enabled)
 
 
         .def("fixClockFrequency", &fixClockFrequency)
@@ -333,7 +336,8 @@ pybind_init_core(py::module_ &m_native)
      * Serialization helpers
      */
     m_core
-        .def("serializeAll", &SimObject::serializeAll)
+        .def("serializeAll", &SimObject::serializeAll,
+             py::arg("cpt_dir"), py::arg("binary") = false)
         .def("getCheckpoint", [](const std::string &cpt_dir) {
             SimObject::setSimObjectResolver(&pybindSimObjectResolver);
             return new CheckpointIn(cpt_dir);
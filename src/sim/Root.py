@@ -67,8 +67,31 @@ class Root(SimObject):
     # Needs to be set explicitly for a multi-eventq simulation.
     sim_quantum = Param.Tick(0, "simulation quantum")
 
+    # Instead of synchronizing all main event queues at a global barrier
+    # every sim_quantum, let each queue advance as far as the lookahead of
+    # the links it receives events over allows (see declareLookahead() in
+    # sim/simulate.hh). Events crossing queues are merged in a
+    # deterministic order, so results don't depend on thread scheduling.
+    # If sim_quantum is 0, it is set to the smallest declared lookahead.
+    lookahead_sync = Param.Bool(
+        False, "Use conservative lookahead synchronization between queues"
+    )
+
     full_system = Param.Bool("if this is a full system simulation")
 
+    # Checkpoints are restored in either format; util/cpt_convert.py
+    # converts between them.
+    binary_checkpoint = Param.Bool(
+        False, "Write checkpoints in the indexed binary format"
+    )
+
+    # Moving the counters of the simple stats to one array once all stats
+    # are registered makes resetting stats cheap, which matters when they
+    # are reset and dumped very often, e.g. at sampling boundaries.
+    flat_stats = Param.Bool(
+        False, "Keep the counters of scalar and vector stats contiguous"
+    )
+
     # Time syncing prevents the simulation from running faster than real time.
     time_sync_enable = Param.Bool(False, "whether time syncing is enabled")
     time_sync_period = Param.Clock("100ms", "how often to sync with real time")
@@ -49,6 +49,10 @@ class MemoryMode(Enum):
     vals = ["invalid", "atomic", "timing", "atomic_noncaching"]
 
 
+class PmemCheckpointFormat(Enum):
+    vals = ["gzip", "chunked"]
+
+
 class System(SimObject):
     type = "System"
     cxx_header = "sim/system.hh"
@@ -104,6 +108,41 @@ class System(SimObject):
         "shared_backstore is non-empty.",
     )
 
+    # Checkpoints of the backing store are written as a single gzip
+    # stream by default. The chunked format skips zero pages, is
+    # (de)compressed by several threads, and its uncompressed chunks are
+    # mapped straight into the backing store on restore. Both formats
+    # can always be restored.
+    pmem_checkpoint_format = Param.PmemCheckpointFormat(
+        "gzip", "Format of the physical memory checkpoint files"
+    )
+    pmem_checkpoint_compress = Param.Bool(
+        True, "Compress the chunks of chunked physical memory checkpoints"
+    )
+    pmem_checkpoint_threads = Param.Unsigned(
+        0,
+        "Threads used to write and restore chunked physical memory "
+        "checkpoints, 0 to use all host cores",
+    )
+    # Delta checkpoints only hold the chunks of the backing store written
+    # since the previous checkpoint taken or restored, and refer to its
+    # file for the others, so that checkpoint must be kept around. After
+    # pmem_checkpoint_max_delta_chain deltas in a row, a full checkpoint
+    # is written to bound the number of files a restore has to read.
+    pmem_checkpoint_delta = Param.Bool(
+        False, "Write chunked physical memory checkpoints as deltas"
+    )
+    pmem_checkpoint_max_delta_chain = Param.Unsigned(
+        8, "Maximum number of delta physical memory checkpoints in a row"
+    )
+    # Restoring lazily fills in the backing store from a chunked
+    # checkpoint as it is accessed, which requires userfaultfd on the
+    # host. Restores are eager where that is not available.
+    pmem_lazy_restore = Param.Bool(
+        False,
+        "Restore chunked physical memory checkpoints on first access",
+    )
+
     cache_line_size = Param.Unsigned(64, "Cache line size in bytes")
 
     redirect_paths = VectorParam.RedirectPath([], "Path redirections")
@@ -0,0 +1,430 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/binary_checkpoint.hh"
+
+#include <cassert>
+#include <cstring>
+
+#include "base/logging.hh"
+#include "sim/byteswap.hh"
+
+namespace gem5
+{
+
+namespace binary_checkpoint
+{
+
+namespace
+{
+
+constexpr char Magic[8] = {'g', 'e', 'm', '5', 'b', 'c', 'p', 't'};
+constexpr uint32_t Version = 1;
+
+// Magic, version and a reserved word.
+constexpr uint64_t HeaderSize = sizeof(Magic) + 2 * sizeof(uint32_t);
+// Index offset, number of index entries and the magic again.
+constexpr uint64_t FooterSize = 2 * sizeof(uint64_t) + sizeof(Magic);
+// Name length, type, element size and element count.
+constexpr uint64_t RecordHeaderSize =
+    sizeof(uint16_t) + 2 * sizeof(uint8_t) + sizeof(uint64_t);
+
+int
+streamIndex()
+{
+    static const int index = std::ios_base::xalloc();
+    return index;
+}
+
+template <class T>
+T
+loadLE(const char *p)
+{
+    T value;
+    std::memcpy(&value, p, sizeof(value));
+    return letoh(value);
+}
+
+template <class T>
+void
+appendLE(std::string &buf, T value)
+{
+    value = htole(value);
+    buf.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+
+bool
+validElemSize(unsigned size)
+{
+    return size == 1 || size == 2 || size == 4 || size == 8;
+}
+
+} // anonymous namespace
+
+bool
+isBinaryFile(const std::string &filename)
+{
+    std::ifstream f(filename, std::ios::binary);
+    char magic[sizeof(Magic)];
+    return f.read(magic, sizeof(magic)) &&
+        std::memcmp(magic, Magic, sizeof(Magic)) == 0;
+}
+
+Writer::Writer(std::ostream &_os)
+    : os(_os)
+{
+    os.pword(streamIndex()) = this;
+
+    std::string header(Magic, sizeof(Magic));
+    appendLE<uint32_t>(header, Version);
+    appendLE<uint32_t>(header, 0);
+    write(header.data(), header.size());
+}
+
+Writer::~Writer()
+{
+    os.pword(streamIndex()) = nullptr;
+}
+
+Writer *
+Writer::get(std::ostream &os)
+{
+    return static_cast<Writer *>(os.pword(streamIndex()));
+}
+
+void
+Writer::write(const void *data, uint64_t size)
+{
+    os.write(static_cast<const char *>(data), size);
+    offset += size;
+}
+
+void
+Writer::endSection()
+{
+    if (inSection)
+        index.push_back({sectionName, sectionStart, offset - sectionStart});
+    inSection = false;
+}
+
+void
+Writer::beginSection(const std::string &name)
+{
+    panic_if(finished, "Binary checkpoint already finished.");
+    endSection();
+    inSection = true;
+    sectionName = name;
+    sectionStart = offset;
+}
+
+void
+Writer::putRecord(const std::string &name, Type type, unsigned elem_size,
+                  uint64_t count)
+{
+    panic_if(!inSection, "Checkpoint entry %s outside of a section.", name);
+    panic_if(name.size() > std::numeric_limits<uint16_t>::max(),
+             "Checkpoint entry name %s is too long.", name);
+
+    std::string header;
+    header.reserve(RecordHeaderSize + name.size());
+    appendLE<uint16_t>(header, name.size());
+    appendLE<uint8_t>(header, uint8_t(type));
+    appendLE<uint8_t>(header, elem_size);
+    appendLE<uint64_t>(header, count);
+    header += name;
+    write(header.data(), header.size());
+}
+
+void
+Writer::putText(const std::string &name, const std::string &value)
+{
+    putRecord(name, Type::Text, 1, value.size());
+    write(value.data(), value.size());
+}
+
+void
+Writer::putIntegers(const std::string &name, const void *data,
+                    uint64_t count, unsigned elem_size, bool is_signed)
+{
+    assert(validElemSize(elem_size));
+    putRecord(name, is_signed ? Type::Signed : Type::Unsigned, elem_size,
+              count);
+
+    if (HostByteOrder == ByteOrder::little || elem_size == 1) {
+        write(data, count * elem_size);
+        return;
+    }
+
+    const char *p = static_cast<const char *>(data);
+    std::string buf;
+    buf.reserve(count * elem_size);
+    for (uint64_t i = 0; i < count; i++, p += elem_size) {
+        uint64_t v = 0;
+        switch (elem_size) {
+          case 2: { uint16_t x; std::memcpy(&x, p, 2); v = x; break; }
+          case 4: { uint32_t x; std::memcpy(&x, p, 4); v = x; break; }
+          default: std::memcpy(&v, p, 8); break;
+        }
+        for (unsigned b = 0; b < elem_size; b++)
+            buf += char(v >> (8 * b));
+    }
+    write(buf.data(), buf.size());
+}
+
+void
+Writer::finish()
+{
+    panic_if(finished, "Binary checkpoint already finished.");
+    endSection();
+
+    const uint64_t index_offset = offset;
+    std::string buf;
+    for (const auto &extent : index) {
+        appendLE<uint32_t>(buf, extent.name.size());
+        appendLE<uint64_t>(buf, extent.offset);
+        appendLE<uint64_t>(buf, extent.length);
+        buf += extent.name;
+    }
+    appendLE<uint64_t>(buf, index_offset);
+    appendLE<uint64_t>(buf, index.size());
+    buf.append(Magic, sizeof(Magic));
+    write(buf.data(), buf.size());
+    os.flush();
+    finished = true;
+}
+
+std::string
+Reader::Entry::text() const
+{
+    if (type == Type::Text)
+        return std::string(data, count);
+
+    std::string str;
+    for (uint64_t i = 0; i < count; i++) {
+        if (i)
+            str += ' ';
+        if (type == Type::Signed)
+            str += std::to_string(signedAt(i));
+        else
+            str += std::to_string(unsignedAt(i));
+    }
+    return str;
+}
+
+uint64_t
+Reader::Entry::unsignedAt(uint64_t i) const
+{
+    const char *p = data + i * elemSize;
+    switch (elemSize) {
+      case 1: return loadLE<uint8_t>(p);
+      case 2: return loadLE<uint16_t>(p);
+      case 4: return loadLE<uint32_t>(p);
+      default: return loadLE<uint64_t>(p);
+    }
+}
+
+int64_t
+Reader::Entry::signedAt(uint64_t i) const
+{
+    uint64_t v = unsignedAt(i);
+    switch (elemSize) {
+      case 1: return int8_t(v);
+      case 2: return int16_t(v);
+      case 4: return int32_t(v);
+      default: return int64_t(v);
+    }
+}
+
+bool
+Reader::Entry::copyTo(void *dst, unsigned elem_size, bool is_signed) const
+{
+    if (!isInteger() || elemSize != elem_size ||
+            is_signed != (type == Type::Signed)) {
+        return false;
+    }
+    if (HostByteOrder != ByteOrder::little && elem_size != 1)
+        return false;
+    std::memcpy(dst, data, count * elem_size);
+    return true;
+}
+
+Reader::Reader(const std::string &_filename)
+    : filename(_filename), file(filename, std::ios::binary)
+{
+    fatal_if(!file, "Can't open checkpoint file '%s'.", filename);
+    file.seekg(0, std::ios::end);
+    fileSize = file.tellg();
+    fatal_if(fileSize < HeaderSize + FooterSize,
+             "Binary checkpoint '%s' is truncated.", filename);
+
+    char header[HeaderSize];
+    file.seekg(0);
+    file.read(header, sizeof(header));
+    fatal_if(!file || std::memcmp(header, Magic, sizeof(Magic)) != 0,
+             "'%s' is not a binary checkpoint.", filename);
+    const uint32_t version = loadLE<uint32_t>(header + sizeof(Magic));
+    fatal_if(version != Version,
+             "Unsupported binary checkpoint version %d in '%s'.",
+             version, filename);
+
+    char footer[FooterSize];
+    file.seekg(fileSize - FooterSize);
+    file.read(footer, sizeof(footer));
+    fatal_if(!file ||
+             std::memcmp(footer + 16, Magic, sizeof(Magic)) != 0,
+             "Binary checkpoint '%s' is incomplete; it may not have been "
+             "finished.", filename);
+    const uint64_t index_offset = loadLE<uint64_t>(footer);
+    const uint64_t num_extents = loadLE<uint64_t>(footer + 8);
+    fatal_if(index_offset < HeaderSize ||
+             index_offset > fileSize - FooterSize,
+             "Corrupt index in binary checkpoint '%s'.", filename);
+
+    std::vector<char> index(fileSize - FooterSize - index_offset);
+    file.seekg(index_offset);
+    file.read(index.data(), index.size());
+    fatal_if(!file, "Can't read binary checkpoint '%s'.", filename);
+
+    const char *p = index.data();
+    const char *end = p + index.size();
+    constexpr uint64_t ExtentSize = sizeof(uint32_t) + 2 * sizeof(uint64_t);
+    for (uint64_t i = 0; i < num_extents; i++) {
+        fatal_if(end - p < ExtentSize,
+                 "Corrupt index in binary checkpoint '%s'.", filename);
+        const uint32_t name_len = loadLE<uint32_t>(p);
+        const uint64_t offset = loadLE<uint64_t>(p + 4);
+        const uint64_t length = loadLE<uint64_t>(p + 12);
+        p += ExtentSize;
+        fatal_if(end - p < name_len || offset < HeaderSize ||
+                 offset > index_offset || length > index_offset - offset,
+                 "Corrupt index in binary checkpoint '%s'.", filename);
+        std::string name(p, name_len);
+        p += name_len;
+
+        auto [it, inserted] = sections.try_emplace(name);
+        if (inserted)
+            names.push_back(name);
+        it->second.extents.emplace_back(offset, length);
+    }
+}
+
+bool
+Reader::sectionExists(const std::string &section) const
+{
+    return sections.count(section);
+}
+
+Reader::Section *
+Reader::load(const std::string &name)
+{
+    auto it = sections.find(name);
+    if (it == sections.end())
+        return nullptr;
+
+    Section &section = it->second;
+    if (section.loaded)
+        return &section;
+
+    uint64_t size = 0;
+    for (const auto &[offset, length] : section.extents)
+        size += length;
+    section.data.resize(size);
+    char *dst = section.data.data();
+    for (const auto &[offset, length] : section.extents) {
+        file.seekg(offset);
+        file.read(dst, length);
+        fatal_if(!file, "Can't read section %s of binary checkpoint '%s'.",
+                 name, filename);
+        dst += length;
+    }
+
+    const char *p = section.data.data();
+    const char *end = p + size;
+    while (p != end) {
+        fatal_if(end - p < RecordHeaderSize,
+                 "Corrupt section %s in binary checkpoint '%s'.",
+                 name, filename);
+        const uint16_t name_len = loadLE<uint16_t>(p);
+        Entry entry;
+        entry.type = Type(loadLE<uint8_t>(p + 2));
+        entry.elemSize = loadLE<uint8_t>(p + 3);
+        entry.count = loadLE<uint64_t>(p + 4);
+        p += RecordHeaderSize;
+
+        const bool valid = entry.type == Type::Text ?
+            entry.elemSize == 1 :
+            (entry.type == Type::Signed || entry.type == Type::Unsigned) &&
+            validElemSize(entry.elemSize);
+        fatal_if(!valid || end - p < name_len ||
+                 entry.count > uint64_t(end - p - name_len) /
+                     entry.elemSize,
+                 "Corrupt section %s in binary checkpoint '%s'.",
+                 name, filename);
+
+        std::string entry_name(p, name_len);
+        p += name_len;
+        entry.data = p;
+        p += entry.count * entry.elemSize;
+
+        // Like the INI format, later entries replace earlier ones.
+        auto [pos, inserted] =
+            section.byName.try_emplace(entry_name, section.entries.size());
+        if (inserted)
+            section.entries.emplace_back(std::move(entry_name), entry);
+        else
+            section.entries[pos->second].second = entry;
+    }
+
+    section.loaded = true;
+    return &section;
+}
+
+const Reader::Entry *
+Reader::find(const std::string &section_name, const std::string &entry)
+{
+    Section *section = load(section_name);
+    if (!section)
+        return nullptr;
+    auto it = section->byName.find(entry);
+    return it == section->byName.end() ?
+        nullptr : &section->entries[it->second].second;
+}
+
+void
+Reader::visitSection(const std::string &section_name,
+                     VisitSectionCallback cb)
+{
+    Section *section = load(section_name);
+    if (!section)
+        return;
+    for (const auto &[name, entry] : section->entries)
+        cb(name, entry);
+}
+
+} // namespace binary_checkpoint
+} // namespace gem5
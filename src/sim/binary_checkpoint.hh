@@ -0,0 +1,277 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __SIM_BINARY_CHECKPOINT_HH__
+#define __SIM_BINARY_CHECKPOINT_HH__
+
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "sim/serialize_handlers.hh"
+
+namespace gem5
+{
+
+/**
+ * Indexed binary alternative to the INI checkpoint file.
+ *
+ * The file starts with a header, followed by the records of every
+ * section in the order they were serialized, an index with the name,
+ * offset and length of every section, and a footer locating the index.
+ * Every record holds one parameter: its name, an encoding and either the
+ * text of the value or its integers in little-endian order. Sections are
+ * only read and decoded when they are first looked up, and integer
+ * arrays restored into a matching type are copied without any parsing.
+ *
+ * All lookups return the same text the INI format would contain, so
+ * anything that parses values by hand keeps working, and
+ * util/cpt_convert.py converts between the two formats.
+ */
+namespace binary_checkpoint
+{
+
+enum class Type : uint8_t
+{
+    Text = 0,
+    Signed = 1,
+    Unsigned = 2,
+};
+
+/** Whether values of type T are stored as integers rather than text. */
+template <class T>
+constexpr bool isNative = std::is_integral_v<T> &&
+    !std::is_same_v<T, bool> && sizeof(T) <= sizeof(uint64_t);
+
+/** @return Whether filename starts with the binary checkpoint magic. */
+bool isBinaryFile(const std::string &filename);
+
+/**
+ * Encodes a checkpoint into a stream. While a writer exists, the
+ * paramOut() family of functions find it through the stream and emit
+ * binary records instead of text.
+ */
+class Writer
+{
+  public:
+    /** Attach a writer to os and write the file header. */
+    Writer(std::ostream &os);
+    ~Writer();
+
+    Writer(const Writer &) = delete;
+    Writer &operator=(const Writer &) = delete;
+
+    /** @return The writer attached to os, or nullptr if there is none. */
+    static Writer *get(std::ostream &os);
+
+    /** Start a section; the records that follow belong to it. */
+    void beginSection(const std::string &name);
+
+    void putText(const std::string &name, const std::string &value);
+    void putIntegers(const std::string &name, const void *data,
+                     uint64_t count, unsigned elem_size, bool is_signed);
+
+    template <class T>
+    void
+    put(const std::string &name, const T &value)
+    {
+        if constexpr (isNative<T>) {
+            putIntegers(name, &value, 1, sizeof(T), std::is_signed_v<T>);
+        } else {
+            std::ostringstream ss;
+            ShowParam<T>::show(ss, value);
+            putText(name, ss.str());
+        }
+    }
+
+    template <class InputIterator>
+    void
+    putArray(const std::string &name, InputIterator start,
+             InputIterator end)
+    {
+        using Elem = std::remove_cv_t<
+            std::remove_reference_t<decltype(*start)>>;
+        if constexpr (isNative<Elem> && std::is_pointer_v<InputIterator>) {
+            putIntegers(name, start, end - start, sizeof(Elem),
+                        std::is_signed_v<Elem>);
+        } else if constexpr (isNative<Elem>) {
+            std::vector<Elem> values(start, end);
+            putIntegers(name, values.data(), values.size(), sizeof(Elem),
+                        std::is_signed_v<Elem>);
+        } else {
+            std::ostringstream ss;
+            for (auto it = start; it != end; ++it) {
+                if (it != start)
+                    ss << " ";
+                ShowParam<Elem>::show(ss, *it);
+            }
+            putText(name, ss.str());
+        }
+    }
+
+    /**
+     * Write the index and the footer. The file cannot be read back
+     * until this has been called.
+     */
+    void finish();
+
+  private:
+    void endSection();
+    void putRecord(const std::string &name, Type type, unsigned elem_size,
+                   uint64_t count);
+    void write(const void *data, uint64_t size);
+
+    std::ostream &os;
+    uint64_t offset = 0;
+
+    bool inSection = false;
+    std::string sectionName;
+    uint64_t sectionStart = 0;
+
+    struct Extent
+    {
+        std::string name;
+        uint64_t offset;
+        uint64_t length;
+    };
+    std::vector<Extent> index;
+    bool finished = false;
+};
+
+/** Random access reader for a binary checkpoint file. */
+class Reader
+{
+  public:
+    /** A decoded record, pointing into the data of its section. */
+    struct Entry
+    {
+        Type type;
+        unsigned elemSize;
+        uint64_t count;
+        const char *data;
+
+        bool isInteger() const { return type != Type::Text; }
+
+        /** @return The value as the INI format would have stored it. */
+        std::string text() const;
+
+        /**
+         * Copy the integers to dst if they are stored with the given
+         * element size and signedness.
+         *
+         * @return Whether the integers were copied.
+         */
+        bool copyTo(void *dst, unsigned elem_size, bool is_signed) const;
+
+        /**
+         * Convert the i-th integer to a T.
+         *
+         * @return False if the value does not fit in a T.
+         */
+        template <class T>
+        bool
+        get(uint64_t i, T &value) const
+        {
+            using Limits = std::numeric_limits<T>;
+            if (type == Type::Signed) {
+                int64_t v = signedAt(i);
+                if (v < 0) {
+                    if (!std::is_signed_v<T> || v < int64_t(Limits::min()))
+                        return false;
+                } else if (uint64_t(v) > uint64_t(Limits::max())) {
+                    return false;
+                }
+                value = static_cast<T>(v);
+                return true;
+            } else if (type == Type::Unsigned) {
+                uint64_t v = unsignedAt(i);
+                if (v > uint64_t(Limits::max()))
+                    return false;
+                value = static_cast<T>(v);
+                return true;
+            }
+            return false;
+        }
+
+      private:
+        int64_t signedAt(uint64_t i) const;
+        uint64_t unsignedAt(uint64_t i) const;
+    };
+
+    using VisitSectionCallback = std::function<void(
+        const std::string &name, const Entry &entry)>;
+
+    /** Open filename and read its index; fatal if it is malformed. */
+    Reader(const std::string &filename);
+
+    Reader(const Reader &) = delete;
+    Reader &operator=(const Reader &) = delete;
+
+    /** Names of all sections, in the order they were written. */
+    const std::vector<std::string> &sectionNames() const { return names; }
+
+    bool sectionExists(const std::string &section) const;
+
+    /** @return The entry, or nullptr if it does not exist. */
+    const Entry *find(const std::string &section, const std::string &entry);
+
+    /** Visit the entries of section in the order they were written. */
+    void visitSection(const std::string &section, VisitSectionCallback cb);
+
+  private:
+    struct Section
+    {
+        std::vector<std::pair<uint64_t, uint64_t>> extents;
+        bool loaded = false;
+        std::vector<char> data;
+        std::vector<std::pair<std::string, Entry>> entries;
+        std::unordered_map<std::string, size_t> byName;
+    };
+
+    Section *load(const std::string &section);
+
+    const std::string filename;
+    std::ifstream file;
+    uint64_t fileSize = 0;
+    std::vector<std::string> names;
+    std::unordered_map<std::string, Section> sections;
+};
+
+} // namespace binary_checkpoint
+} // namespace gem5
+
+#endif // __SIM_BINARY_CHECKPOINT_HH__
@@ -0,0 +1,233 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <list>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/gtest/cur_tick_fake.hh"
+#include "base/gtest/logging.hh"
+#include "base/gtest/serialization_fixture.hh"
+#include "sim/serialize.hh"
+
+using namespace gem5;
+
+// Instantiate the mock class to have a valid curTick of 0
+GTestTickHandler tickHandler;
+
+namespace
+{
+
+using BinaryCheckpointFixture = SerializationFixture;
+
+/** Serialize the same set of entries, nested sections included. */
+void
+serializeSample(CheckpointOut &cp)
+{
+    const int16_t int16[] = {-3, 0, 32767};
+    std::vector<uint64_t> uint64 = {12751928501, 13, 0xffffffffffffffff};
+    std::list<bool> boolean = {true, false};
+    std::array<double, 2> real = {0.5, 1e+10};
+    std::vector<uint8_t> empty;
+
+    Serializable::ScopedCheckpointSection scs(cp, "Section1");
+    paramOut(cp, "int", -42);
+    paramOut(cp, "char", 'a');
+    paramOut(cp, "string", std::string("a string"));
+    paramOut(cp, "double", 0.25);
+    paramOut(cp, "bool", true);
+    arrayParamOut(cp, "int16", int16, 3);
+    arrayParamOut(cp, "uint64", uint64);
+    arrayParamOut(cp, "boolean", boolean);
+    arrayParamOut(cp, "real", real);
+    arrayParamOut(cp, "empty", empty);
+    {
+        Serializable::ScopedCheckpointSection scs_2(cp, "Section2");
+        {
+            Serializable::ScopedCheckpointSection scs_3(cp, "Section3");
+            paramOut(cp, "uint8", uint8_t(255));
+        }
+    }
+}
+
+std::vector<std::pair<std::string, std::string>>
+sectionContents(CheckpointIn &cp, const std::string &section)
+{
+    std::vector<std::pair<std::string, std::string>> contents;
+    cp.visitSection(section,
+        [&contents](const std::string &name, const std::string &value) {
+            contents.emplace_back(name, value);
+        });
+    return contents;
+}
+
+} // anonymous namespace
+
+/** Values are restored exactly, whatever type they were written with. */
+TEST_F(BinaryCheckpointFixture, ParamOutIn)
+{
+    {
+        std::ofstream cpt;
+        auto writer =
+            Serializable::generateBinaryCheckpointOut(getDirName(), cpt);
+        serializeSample(cpt);
+        writer->finish();
+    }
+    ASSERT_TRUE(binary_checkpoint::isBinaryFile(getCptPath()));
+
+    CheckpointIn cpt(getDirName());
+    EXPECT_TRUE(cpt.sectionExists("Section1"));
+    EXPECT_TRUE(cpt.sectionExists("Section1.Section2"));
+    EXPECT_FALSE(cpt.sectionExists("Section2"));
+    EXPECT_TRUE(cpt.entryExists("Section1.Section2.Section3", "uint8"));
+    EXPECT_FALSE(cpt.entryExists("Section1", "uint8"));
+
+    Serializable::ScopedCheckpointSection scs(cpt, "Section1");
+    int integer;
+    char character;
+    std::string str;
+    double real;
+    bool boolean;
+    paramIn(cpt, "int", integer);
+    paramIn(cpt, "char", character);
+    paramIn(cpt, "string", str);
+    paramIn(cpt, "double", real);
+    paramIn(cpt, "bool", boolean);
+    EXPECT_EQ(integer, -42);
+    EXPECT_EQ(character, 'a');
+    EXPECT_EQ(str, "a string");
+    EXPECT_EQ(real, 0.25);
+    EXPECT_TRUE(boolean);
+
+    int16_t int16[3];
+    std::vector<uint64_t> uint64;
+    std::list<bool> booleans;
+    std::array<double, 2> reals;
+    std::vector<uint8_t> empty = {1};
+    arrayParamIn(cpt, "int16", int16, 3);
+    arrayParamIn(cpt, "uint64", uint64);
+    arrayParamIn(cpt, "boolean", booleans);
+    arrayParamIn(cpt, "real", reals.data(), reals.size());
+    arrayParamIn(cpt, "empty", empty);
+    EXPECT_THAT(int16, testing::ElementsAre(-3, 0, 32767));
+    EXPECT_THAT(uint64, testing::ElementsAre(
+        12751928501, 13, 0xffffffffffffffff));
+    EXPECT_THAT(booleans, testing::ElementsAre(true, false));
+    EXPECT_THAT(reals, testing::ElementsAre(0.5, 1e+10));
+    EXPECT_TRUE(empty.empty());
+}
+
+/** Both formats present the same text to anything parsing it by hand. */
+TEST_F(BinaryCheckpointFixture, SameTextAsIni)
+{
+    const std::vector<std::string> sections = {
+        "Section1", "Section1.Section2", "Section1.Section2.Section3"};
+    std::vector<std::vector<std::pair<std::string, std::string>>> ini;
+    {
+        std::ofstream cpt;
+        Serializable::generateCheckpointOut(getDirName(), cpt);
+        serializeSample(cpt);
+    }
+    {
+        CheckpointIn cpt(getDirName());
+        for (const auto &section : sections)
+            ini.push_back(sectionContents(cpt, section));
+    }
+    {
+        std::ofstream cpt;
+        auto writer =
+            Serializable::generateBinaryCheckpointOut(getDirName(), cpt);
+        serializeSample(cpt);
+        writer->finish();
+    }
+
+    CheckpointIn cpt(getDirName());
+    for (size_t i = 0; i < sections.size(); i++) {
+        EXPECT_THAT(sectionContents(cpt, sections[i]),
+                    testing::UnorderedElementsAreArray(ini[i]));
+    }
+
+    std::string value;
+    ASSERT_TRUE(cpt.find("Section1", "int16", value));
+    EXPECT_EQ(value, "-3 0 32767");
+    ASSERT_TRUE(cpt.find("Section1", "char", value));
+    EXPECT_EQ(value, "97");
+    ASSERT_TRUE(cpt.find("Section1", "empty", value));
+    EXPECT_EQ(value, "");
+}
+
+/** Integers convert to other types, as long as they fit. */
+TEST_F(BinaryCheckpointFixture, IntegerConversion)
+{
+    {
+        std::ofstream cpt;
+        auto writer =
+            Serializable::generateBinaryCheckpointOut(getDirName(), cpt);
+        Serializable::ScopedCheckpointSection scs(cpt, "Section1");
+        std::vector<uint16_t> values = {1, 300};
+        arrayParamOut(cpt, "values", values);
+        paramOut(cpt, "negative", -1);
+        writer->finish();
+    }
+
+    CheckpointIn cpt(getDirName());
+    Serializable::ScopedCheckpointSection scs(cpt, "Section1");
+
+    int64_t wide[2];
+    arrayParamIn(cpt, "values", wide, 2);
+    EXPECT_THAT(wide, testing::ElementsAre(1, 300));
+
+    std::vector<uint8_t> narrow;
+    ASSERT_ANY_THROW(arrayParamIn(cpt, "values", narrow));
+    ASSERT_ANY_THROW(arrayParamIn(cpt, "values", wide, 3));
+
+    unsigned u;
+    int8_t i;
+    EXPECT_FALSE(optParamIn(cpt, "negative", u, false));
+    EXPECT_TRUE(optParamIn(cpt, "negative", i, false));
+    EXPECT_EQ(i, -1);
+}
+
+/** A checkpoint whose writer was never finished is rejected. */
+TEST_F(BinaryCheckpointFixture, Unfinished)
+{
+    {
+        std::ofstream cpt;
+        auto writer =
+            Serializable::generateBinaryCheckpointOut(getDirName(), cpt);
+        serializeSample(cpt);
+    }
+    ASSERT_ANY_THROW(CheckpointIn cpt(getDirName()));
+}
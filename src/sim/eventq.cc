@@ -41,6 +41,7 @@
 #include "base/trace.hh"
 #include "cpu/smt.hh"
 #include "debug/Checkpoint.hh"
+#include "sim/eventq_calendar.hh"
 
 namespace gem5
 {
@@ -57,14 +58,18 @@ uint32_t numMainEventQueues = 0;
 std::vector<EventQueue *> mainEventQueue;
 __thread EventQueue *_curEventQueue = NULL;
 bool inParallelMode = false;
+EventQueue::Backend mainEventQueueBackend = EventQueue::Backend::List;
 
 EventQueue *
 getEventQueue(uint32_t index)
 {
     while (numMainEventQueues <= index) {
+        EventQueue *eq = new EventQueue(
+            csprintf("MainEventQueue-%d", numMainEventQueues),
+            mainEventQueueBackend);
+        eq->index(numMainEventQueues);
+        mainEventQueue.push_back(eq);
         numMainEventQueues++;
-        mainEventQueue.push_back(
-            new EventQueue(csprintf("MainEventQueue-%d", index)));
     }
 
     return mainEventQueue[index];
@@ -137,6 +142,11 @@ Event::releaseImpl()
 void
 EventQueue::insert(Event *event)
 {
+    if (calendar) {
+        head = calendar->insert(event);
+        return;
+    }
+
     // Deal with the head case
     if (!head || *event <= *head) {
         head = Event::insertBefore(event, head);
@@ -196,6 +206,11 @@ EventQueue::remove(Event *event)
 
     assert(event->queue == this);
 
+    if (calendar) {
+        head = calendar->remove(event);
+        return;
+    }
+
     // deal with an event on the head's 'in bin' list (event has the same
     // time as the head)
     if (*head == *event) {
@@ -228,7 +243,9 @@ EventQueue::serviceOne()
     Event *next = head->nextInBin;
     event->flags.clear(Event::Scheduled);
 
-    if (next) {
+    if (calendar) {
+        head = calendar->remove(event);
+    } else if (next) {
         // update the next bin pointer since it could be stale
         next->nextBin = head->nextBin;
 
@@ -321,15 +338,11 @@ EventQueue::dump() const
     if (empty())
         cprintf("<No Events>\n");
     else {
-        Event *nextBin = head;
-        while (nextBin) {
-            Event *nextInBin = nextBin;
+        for (Event *nextInBin : pendingBins()) {
             while (nextInBin) {
                 nextInBin->dump();
                 nextInBin = nextInBin->nextInBin;
             }
-
-            nextBin = nextBin->nextBin;
         }
     }
 
@@ -344,9 +357,7 @@ EventQueue::debugVerify() const
     Tick time = 0;
     short priority = 0;
 
-    Event *nextBin = head;
-    while (nextBin) {
-        Event *nextInBin = nextBin;
+    for (Event *nextInBin : pendingBins()) {
         while (nextInBin) {
             if (nextInBin->when() < time) {
                 cprintf("time goes backwards!");
@@ -371,16 +382,34 @@ EventQueue::debugVerify() const
 
             nextInBin = nextInBin->nextInBin;
         }
-
-        nextBin = nextBin->nextBin;
     }
 
     return true;
 }
 
+std::vector<Event *>
+EventQueue::pendingBins() const
+{
+    if (calendar)
+        return calendar->sortedBins();
+
+    std::vector<Event *> bins;
+    for (Event *bin = head; bin; bin = bin->nextBin)
+        bins.push_back(bin);
+    return bins;
+}
+
 Event*
 EventQueue::replaceHead(Event* s)
 {
+    if (calendar) {
+        // Hand out the pending events in the list format so that they
+        // can be put back on any queue, irrespective of its backend.
+        Event *t = calendar->release();
+        head = calendar->adopt(s);
+        return t;
+    }
+
     Event* t = head;
     head = s;
     return t;
@@ -441,30 +470,58 @@ Event::dump() const
     }
 }
 
-EventQueue::EventQueue(const std::string &n)
-    : objName(n), head(NULL), _curTick(0)
+EventQueue::EventQueue(const std::string &n, Backend backend)
+    : objName(n), head(NULL), _curTick(0), _index(0), asyncSent(0),
+      asyncHeadTick(MaxTick)
+{
+    if (backend == Backend::Calendar)
+        calendar.reset(new EventCalendar());
+}
+
+EventQueue::~EventQueue()
 {
+    while (!empty())
+        deschedule(getHead());
 }
 
 void
 EventQueue::asyncInsert(Event *event)
 {
+    // Remember who scheduled the event so that events from different
+    // threads are merged in a deterministic order.
+    EventQueue *source = curEventQueue();
+    AsyncEvent entry = { event, 0, 0 };
+    if (source) {
+        entry.source = source->_index;
+        entry.seq = source->asyncSent++;
+    }
+
     async_queue_mutex.lock();
-    async_queue.push_back(event);
+    async_queue.push(entry);
+    asyncHeadTick = async_queue.top().event->when();
     async_queue_mutex.unlock();
 }
 
 void
 EventQueue::handleAsyncInsertions()
+{
+    handleAsyncInsertions(MaxTick);
+}
+
+void
+EventQueue::handleAsyncInsertions(Tick until)
 {
     assert(this == curEventQueue());
     async_queue_mutex.lock();
 
-    while (!async_queue.empty()) {
-        insert(async_queue.front());
-        async_queue.pop_front();
+    while (!async_queue.empty() && async_queue.top().event->when() <= until) {
+        insert(async_queue.top().event);
+        async_queue.pop();
     }
 
+    asyncHeadTick = async_queue.empty() ?
+        MaxTick : async_queue.top().event->when();
+
     async_queue_mutex.unlock();
 }
 
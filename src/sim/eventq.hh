@@ -36,13 +36,17 @@
 #define __SIM_EVENTQ_HH__
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <climits>
 #include <functional>
 #include <iosfwd>
 #include <list>
 #include <memory>
+#include <queue>
 #include <string>
+#include <tuple>
+#include <vector>
 
 #include "base/debug.hh"
 #include "base/flags.hh"
@@ -59,6 +63,7 @@ namespace gem5
 {
 
 class EventQueue;       // forward declaration
+class EventCalendar;
 class BaseGlobalEvent;
 
 //! Simulation Quantum for multiple eventq simulation.
@@ -254,6 +259,7 @@ class EventBase
 class Event : public EventBase, public Serializable
 {
     friend class EventQueue;
+    friend class EventCalendar;
 
   private:
     // The event queue is now a linked list of linked lists.  The
@@ -611,9 +617,31 @@ operator!=(const Event &l, const Event &r)
  * events must happen at least one simulation quantum into the future,
  * otherwise they risk being scheduled in the past by
  * handleAsyncInsertions().
+ *
+ * Asynchronous events are merged in a deterministic order that does
+ * not depend on when the scheduling threads got to run: they are
+ * sorted by time and priority, then by the index of the queue whose
+ * thread scheduled them and the order in which that thread did so.
  */
 class EventQueue
 {
+  public:
+    /**
+     * Data structures that can be used to keep the pending events
+     * sorted. All backends service events in exactly the same order.
+     *
+     * @ingroup api_eventq
+     */
+    enum class Backend
+    {
+        /** Sorted list of bins, insertion is linear in the number of
+         *  distinct pending time/priority pairs. */
+        List,
+        /** Calendar queue of bins with amortized constant-time
+         *  insertion, see EventCalendar. */
+        Calendar,
+    };
+
   private:
     friend void curEventQueue(EventQueue *);
 
@@ -621,11 +649,46 @@ class EventQueue
     Event *head;
     Tick _curTick;
 
+    //! Calendar holding the pending events when the calendar backend
+    //! is used, nullptr for the list backend.
+    std::unique_ptr<EventCalendar> calendar;
+
+    //! Index of this queue in mainEventQueue, or zero for queues that
+    //! are not main event queues.
+    uint32_t _index;
+
+    //! Number of asynchronous insertions done by this queue's thread.
+    uint64_t asyncSent;
+
+    /** An event scheduled by another thread, see asyncInsert(). */
+    struct AsyncEvent
+    {
+        Event *event;
+        //! Index of the queue whose thread scheduled the event
+        uint32_t source;
+        //! Value of the source queue's asyncSent counter
+        uint64_t seq;
+
+        bool
+        operator>(const AsyncEvent &r) const
+        {
+            if (*event != *r.event)
+                return *event > *r.event;
+            return std::tie(source, seq) > std::tie(r.source, r.seq);
+        }
+    };
+
     //! Mutex to protect async queue.
     UncontendedMutex async_queue_mutex;
 
-    //! List of events added by other threads to this event queue.
-    std::list<Event*> async_queue;
+    //! Events added by other threads to this event queue, sorted in
+    //! the order they will be merged into the main queue.
+    std::priority_queue<AsyncEvent, std::vector<AsyncEvent>,
+                        std::greater<AsyncEvent>> async_queue;
+
+    //! Time of the earliest event in async_queue, or MaxTick if it's
+    //! empty. Can be read without holding async_queue_mutex.
+    std::atomic<Tick> asyncHeadTick;
 
     /**
      * Lock protecting event handling.
@@ -738,7 +801,7 @@ class EventQueue
     /**
      * @ingroup api_eventq
      */
-    EventQueue(const std::string &n);
+    EventQueue(const std::string &n, Backend backend=Backend::List);
 
     /**
      * @ingroup api_eventq
@@ -900,11 +963,47 @@ class EventQueue
 
     bool debugVerify() const;
 
+    /**
+     * Get the top event of every bin (events with the same time and
+     * priority) in the order they will be serviced.
+     */
+    std::vector<Event *> pendingBins() const;
+
+    /**
+     * Get the backend used to keep the events on this queue sorted.
+     *
+     * @ingroup api_eventq
+     */
+    Backend backend() const
+    {
+        return calendar ? Backend::Calendar : Backend::List;
+    }
+
     /**
      * Function for moving events from the async_queue to the main queue.
      */
     void handleAsyncInsertions();
 
+    /**
+     * Move the events scheduled no later than the given tick from the
+     * async_queue to the main queue.
+     */
+    void handleAsyncInsertions(Tick until);
+
+    /**
+     * Time of the earliest event waiting in the async_queue, or MaxTick
+     * if there is none. Safe to call from any thread.
+     */
+    Tick nextAsyncTick() const { return asyncHeadTick.load(); }
+
+    /**
+     * Index of this queue in mainEventQueue.
+     *
+     * @ingroup api_eventq
+     */
+    uint32_t index() const { return _index; }
+    void index(uint32_t idx) { _index = idx; }
+
     /**
      *  Function to signal that the event loop should be woken up because
      *  an event has been scheduled by an agent outside the gem5 event
@@ -961,13 +1060,13 @@ class EventQueue
      */
     void checkpointReschedule(Event *event);
 
-    virtual ~EventQueue()
-    {
-        while (!empty())
-            deschedule(getHead());
-    }
+    virtual ~EventQueue();
 };
 
+//! Backend used when allocating main event queues. It needs to be set
+//! before the first call to getEventQueue() to take effect.
+extern EventQueue::Backend mainEventQueueBackend;
+
 inline void
 curEventQueue(EventQueue *q)
 {
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "sim/eventq.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+/** Event recording the order in which it is serviced. */
+class TraceEvent : public Event
+{
+  private:
+    std::vector<int> &trace;
+    const int id;
+
+  public:
+    TraceEvent(std::vector<int> &_trace, int _id, Priority p)
+        : Event(p), trace(_trace), id(_id)
+    {}
+
+    void process() override { trace.push_back(id); }
+};
+
+/**
+ * Apply the same pseudo-random sequence of schedule, deschedule,
+ * reschedule and service operations to a queue and return the order
+ * in which the events were serviced.
+ */
+std::vector<int>
+runRandomTrace(EventQueue::Backend backend, unsigned seed)
+{
+    const int num_events = 2000;
+    const Event::Priority priorities[] = {
+        Event::Default_Pri, Event::CPU_Tick_Pri, Event::Delayed_Writeback_Pri,
+        Event::Stat_Event_Pri
+    };
+
+    std::vector<int> trace;
+    EventQueue eq("test", backend);
+    std::vector<std::unique_ptr<TraceEvent>> events;
+    for (int i = 0; i < num_events; ++i) {
+        events.emplace_back(new TraceEvent(trace, i, priorities[i % 4]));
+    }
+
+    std::mt19937 rng(seed);
+    // Mostly clock-aligned delays with a few far-away events
+    std::uniform_int_distribution<int> cycles(0, 64);
+    std::uniform_int_distribution<int> op(0, 9);
+    std::uniform_int_distribution<int> pick(0, num_events - 1);
+
+    for (int step = 0; step < 50000; ++step) {
+        TraceEvent *event = events[pick(rng)].get();
+        const Tick delay = (op(rng) == 0) ?
+            cycles(rng) * 1000000 : cycles(rng) * 500;
+        switch (op(rng)) {
+          case 0:
+            if (event->scheduled())
+                eq.deschedule(event);
+            break;
+          case 1:
+            eq.reschedule(event, eq.getCurTick() + delay, true);
+            break;
+          case 2:
+          case 3:
+          case 4:
+            if (!eq.empty())
+                eq.serviceOne();
+            break;
+          default:
+            if (!event->scheduled())
+                eq.schedule(event, eq.getCurTick() + delay);
+            break;
+        }
+        EXPECT_TRUE(eq.empty() || eq.nextTick() >= eq.getCurTick());
+    }
+
+    while (!eq.empty())
+        eq.serviceOne();
+
+    return trace;
+}
+
+} // anonymous namespace
+
+/** Events on the same tick are ordered by priority, newest first. */
+TEST(EventQueueTest, SameTickOrdering)
+{
+    for (auto backend : { EventQueue::Backend::List,
+                          EventQueue::Backend::Calendar }) {
+        std::vector<int> trace;
+        EventQueue eq("test", backend);
+        TraceEvent e0(trace, 0, Event::Default_Pri);
+        TraceEvent e1(trace, 1, Event::CPU_Tick_Pri);
+        TraceEvent e2(trace, 2, Event::Default_Pri);
+        TraceEvent e3(trace, 3, Event::Delayed_Writeback_Pri);
+        TraceEvent e4(trace, 4, Event::Default_Pri);
+
+        eq.schedule(&e0, 100);
+        eq.schedule(&e1, 100);
+        eq.schedule(&e2, 100);
+        eq.schedule(&e3, 100);
+        eq.schedule(&e4, 50);
+        eq.reschedule(&e4, 100);
+
+        ASSERT_TRUE(eq.debugVerify());
+        while (!eq.empty())
+            eq.serviceOne();
+
+        EXPECT_EQ(trace, std::vector<int>({3, 4, 2, 0, 1}));
+        EXPECT_EQ(eq.getCurTick(), (Tick)100);
+    }
+}
+
+/** Both backends service a random schedule in exactly the same order. */
+TEST(EventQueueTest, BackendsAgree)
+{
+    for (unsigned seed = 1; seed <= 4; ++seed) {
+        const auto list = runRandomTrace(EventQueue::Backend::List, seed);
+        const auto calendar =
+            runRandomTrace(EventQueue::Backend::Calendar, seed);
+        ASSERT_FALSE(list.empty());
+        EXPECT_EQ(list, calendar);
+    }
+}
+
+/** Events can be moved out of and back into a calendar queue. */
+TEST(EventQueueTest, CalendarReplaceHead)
+{
+    std::vector<int> trace;
+    EventQueue eq("test", EventQueue::Backend::Calendar);
+    std::vector<std::unique_ptr<TraceEvent>> events;
+    for (int i = 0; i < 100; ++i) {
+        events.emplace_back(new TraceEvent(trace, i, Event::Default_Pri));
+        eq.schedule(events.back().get(), (i % 10) * 1000 + 1000);
+    }
+
+    Event *saved = eq.replaceHead(nullptr);
+    ASSERT_NE(saved, nullptr);
+    EXPECT_TRUE(eq.empty());
+
+    TraceEvent other(trace, 100, Event::Default_Pri);
+    eq.schedule(&other, 10);
+    eq.serviceOne();
+    EXPECT_TRUE(eq.empty());
+
+    EXPECT_EQ(eq.replaceHead(saved), nullptr);
+    ASSERT_TRUE(eq.debugVerify());
+    EXPECT_EQ(eq.pendingBins().size(), 10u);
+    while (!eq.empty())
+        eq.serviceOne();
+
+    ASSERT_EQ(trace.size(), 101u);
+    EXPECT_EQ(trace[0], 100);
+    // Events in a bin are serviced in LIFO order
+    EXPECT_EQ(trace[1], 90);
+    EXPECT_EQ(trace[100], 9);
+}
@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/eventq_calendar.hh"
+
+#include <algorithm>
+#include <cassert>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+#include "sim/eventq.hh"
+
+namespace gem5
+{
+
+namespace
+{
+
+bool
+binLess(const Event *l, const Event *r)
+{
+    return *l < *r;
+}
+
+} // anonymous namespace
+
+EventCalendar::EventCalendar()
+    : buckets(MinBuckets, nullptr),
+      // Start with buckets of roughly a nanosecond at the default tick
+      // resolution, the width is re-estimated on the first resize.
+      widthShift(10), numBins(0), _head(nullptr)
+{
+}
+
+void
+EventCalendar::insertBin(Event *bin)
+{
+    Event **link = &buckets[bucketIndex(bin->when())];
+    while (*link && **link < *bin)
+        link = &(*link)->nextBin;
+
+    bin->nextBin = *link;
+    *link = bin;
+}
+
+Event *
+EventCalendar::insert(Event *event)
+{
+    Event *&top = buckets[bucketIndex(event->when())];
+
+    // Find either the bin the event belongs to or where a new bin
+    // needs to be inserted, exactly like EventQueue::insert() does on
+    // the full list of bins.
+    Event *prev = nullptr;
+    Event *curr = top;
+    while (curr && *curr < *event) {
+        prev = curr;
+        curr = curr->nextBin;
+    }
+
+    const bool new_bin = !curr || *curr != *event;
+    Event *bin = Event::insertBefore(event, curr);
+    if (prev)
+        prev->nextBin = bin;
+    else
+        top = bin;
+
+    // An event goes on top of its bin, so it becomes the new head if it
+    // is scheduled no later than the current one.
+    if (!_head || *event <= *_head)
+        _head = event;
+
+    if (new_bin) {
+        ++numBins;
+        maybeResize();
+    }
+
+    return _head;
+}
+
+Event *
+EventCalendar::remove(Event *event)
+{
+    Event *&top = buckets[bucketIndex(event->when())];
+
+    Event *prev = nullptr;
+    Event *curr = top;
+    while (curr && *curr < *event) {
+        prev = curr;
+        curr = curr->nextBin;
+    }
+
+    if (!curr || *curr != *event)
+        panic("event not found!");
+
+    const bool last_in_bin = curr == event && !event->nextInBin;
+    Event *bin = Event::removeItem(event, curr);
+    if (prev)
+        prev->nextBin = bin;
+    else
+        top = bin;
+
+    if (last_in_bin)
+        --numBins;
+
+    if (event == _head) {
+        // The head is always on top of its bin. If there are other
+        // events in the bin, the next one is the new head. Otherwise,
+        // all remaining events are scheduled after the old head, which
+        // is where the search for the next bin starts.
+        _head = last_in_bin ? findHead(event->when()) : bin;
+    }
+
+    if (last_in_bin)
+        maybeResize();
+
+    return _head;
+}
+
+Event *
+EventCalendar::findHead(Tick from) const
+{
+    if (numBins == 0)
+        return nullptr;
+
+    // Walk the buckets one year ahead of 'from'. The first bin of a
+    // bucket is the earliest one in it, so the first bucket whose first
+    // bin falls into the time slot we are looking at holds the head.
+    const size_t mask = buckets.size() - 1;
+    Tick slot = from >> widthShift;
+    for (size_t i = 0; i < buckets.size(); ++i, ++slot) {
+        Event *bin = buckets[slot & mask];
+        if (bin && (bin->when() >> widthShift) == slot)
+            return bin;
+    }
+
+    // Nothing within a year, fall back to a direct search.
+    Event *head = nullptr;
+    for (Event *bin : buckets) {
+        if (bin && (!head || *bin < *head))
+            head = bin;
+    }
+
+    assert(head);
+    return head;
+}
+
+void
+EventCalendar::collectBins(std::vector<Event *> &bins) const
+{
+    bins.reserve(bins.size() + numBins);
+    for (Event *bin : buckets) {
+        for (; bin; bin = bin->nextBin)
+            bins.push_back(bin);
+    }
+    assert(bins.size() == numBins);
+}
+
+void
+EventCalendar::maybeResize()
+{
+    size_t num_buckets = buckets.size();
+    while (numBins > 2 * num_buckets)
+        num_buckets *= 2;
+    while (num_buckets > MinBuckets && numBins < num_buckets / 2)
+        num_buckets /= 2;
+
+    if (num_buckets != buckets.size())
+        resize(num_buckets);
+}
+
+void
+EventCalendar::resize(size_t num_buckets)
+{
+    std::vector<Event *> bins;
+    collectBins(bins);
+    rehash(bins, num_buckets);
+}
+
+void
+EventCalendar::rehash(std::vector<Event *> &bins, size_t num_buckets)
+{
+    assert(isPowerOf2(num_buckets));
+
+    // Estimate the bucket width from the average separation of the
+    // earliest bins. Large gaps (e.g., an exit event scheduled far in
+    // the future) are left out of the estimate so they don't stretch
+    // the buckets, and each bucket is made to cover about three bins.
+    const size_t samples = std::min(bins.size(), WidthSamples);
+    std::partial_sort(bins.begin(), bins.begin() + samples, bins.end(),
+                      binLess);
+
+    double total = 0;
+    size_t gaps = 0;
+    for (size_t i = 1; i < samples; ++i) {
+        const Tick gap = bins[i]->when() - bins[i - 1]->when();
+        if (gap) {
+            total += gap;
+            ++gaps;
+        }
+    }
+
+    if (gaps) {
+        const double mean = total / gaps;
+        double trimmed_total = 0;
+        size_t trimmed_gaps = 0;
+        for (size_t i = 1; i < samples; ++i) {
+            const Tick gap = bins[i]->when() - bins[i - 1]->when();
+            if (gap && gap <= 2 * mean) {
+                trimmed_total += gap;
+                ++trimmed_gaps;
+            }
+        }
+
+        const double width = 3 * trimmed_total / trimmed_gaps;
+        widthShift = std::min(ceilLog2(std::max<Tick>(width, 1)), 62);
+    }
+
+    buckets.assign(num_buckets, nullptr);
+    for (Event *bin : bins)
+        insertBin(bin);
+}
+
+std::vector<Event *>
+EventCalendar::sortedBins() const
+{
+    std::vector<Event *> bins;
+    collectBins(bins);
+    std::sort(bins.begin(), bins.end(), binLess);
+    return bins;
+}
+
+Event *
+EventCalendar::release()
+{
+    const std::vector<Event *> bins = sortedBins();
+
+    Event *list = nullptr;
+    for (auto it = bins.rbegin(); it != bins.rend(); ++it) {
+        (*it)->nextBin = list;
+        list = *it;
+    }
+
+    std::fill(buckets.begin(), buckets.end(), nullptr);
+    numBins = 0;
+    _head = nullptr;
+
+    return list;
+}
+
+Event *
+EventCalendar::adopt(Event *bins)
+{
+    assert(empty());
+
+    std::vector<Event *> all_bins;
+    for (; bins; bins = bins->nextBin)
+        all_bins.push_back(bins);
+
+    if (all_bins.empty())
+        return nullptr;
+
+    numBins = all_bins.size();
+    size_t num_buckets = MinBuckets;
+    while (numBins > 2 * num_buckets)
+        num_buckets *= 2;
+    rehash(all_bins, num_buckets);
+
+    _head = all_bins.front();
+    return _head;
+}
+
+} // namespace gem5
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* @file
+ * Calendar queue used as an alternative backend for EventQueue
+ */
+
+#ifndef __SIM_EVENTQ_CALENDAR_HH__
+#define __SIM_EVENTQ_CALENDAR_HH__
+
+#include <cstddef>
+#include <vector>
+
+#include "base/types.hh"
+
+namespace gem5
+{
+
+class Event;
+
+/**
+ * Calendar queue (R. Brown, CACM 1988) of event bins.
+ *
+ * Like the default EventQueue implementation, events are grouped into
+ * bins, where a bin holds all events with the same time and priority
+ * as a LIFO stack linked through Event::nextInBin. Instead of keeping
+ * every bin on a single sorted list, the bins are hashed by time into
+ * an array of buckets, each holding a short sorted list of bins
+ * linked through Event::nextBin. Each bucket covers 2^widthShift
+ * ticks of one "year" and the bucket array is resized (and the bucket
+ * width re-estimated from the pending events) whenever the number of
+ * bins gets too large or too small for it, which makes insertion and
+ * removal of the head amortized constant time.
+ *
+ * Since only the placement of bins differs, events are serviced in
+ * exactly the same order as with the list backend.
+ */
+class EventCalendar
+{
+  private:
+    /** Sorted lists of bins, indexed by bucketIndex(). */
+    std::vector<Event *> buckets;
+
+    /** Log2 of the number of ticks covered by a bucket. */
+    int widthShift;
+
+    /** Number of distinct bins (time/priority pairs) in the calendar. */
+    size_t numBins;
+
+    /** Top of the earliest bin, or nullptr if the calendar is empty. */
+    Event *_head;
+
+    /** The bucket array never shrinks below this many buckets. */
+    static const size_t MinBuckets = 16;
+
+    /** Number of bins sampled to estimate the bucket width. */
+    static const size_t WidthSamples = 25;
+
+    size_t
+    bucketIndex(Tick when) const
+    {
+        return (when >> widthShift) & (buckets.size() - 1);
+    }
+
+    /** Link a complete bin into the bucket covering its time. */
+    void insertBin(Event *bin);
+
+    /**
+     * Find the earliest bin, assuming that no bin is scheduled before
+     * the given tick.
+     */
+    Event *findHead(Tick from) const;
+
+    /** Collect the top of every bin in no particular order. */
+    void collectBins(std::vector<Event *> &bins) const;
+
+    /** Grow or shrink the bucket array if it is over- or under-full. */
+    void maybeResize();
+
+    /**
+     * Rehash all bins into a new bucket array, re-estimating the bucket
+     * width from the earliest pending bins.
+     */
+    void resize(size_t num_buckets);
+
+    /**
+     * Hash the given bins into a new bucket array of the requested
+     * size. The bins are partially sorted in the process.
+     */
+    void rehash(std::vector<Event *> &bins, size_t num_buckets);
+
+  public:
+    EventCalendar();
+
+    /** Top of the earliest bin, or nullptr if there are no events. */
+    Event *head() const { return _head; }
+
+    bool empty() const { return _head == nullptr; }
+
+    /** Insert an event and return the new head. */
+    Event *insert(Event *event);
+
+    /** Remove a pending event and return the new head. */
+    Event *remove(Event *event);
+
+    /**
+     * Get the top of every bin sorted in service order. The bin
+     * pointers (nextBin) of the returned events are not updated.
+     */
+    std::vector<Event *> sortedBins() const;
+
+    /**
+     * Move all events out of the calendar, returning them as a single
+     * sorted list of bins in the format used by the list backend.
+     */
+    Event *release();
+
+    /**
+     * Take ownership of a sorted list of bins, as returned by
+     * release(), and return the new head. The calendar must be empty.
+     */
+    Event *adopt(Event *bins);
+};
+
+} // namespace gem5
+
+#endif // __SIM_EVENTQ_CALENDAR_HH__
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026 The Regents of the University of California
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* @file
+ * Microbenchmark comparing the EventQueue backends.
+ *
+ * The benchmark mimics the event mix of a large timing simulation:
+ * a number of clocked objects in a few clock domains tick every cycle,
+ * and each tick occasionally issues a "memory access" whose response
+ * comes back after a random latency.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "base/cprintf.hh"
+#include "sim/eventq.hh"
+
+using namespace gem5;
+
+namespace
+{
+
+std::mt19937 rng;
+
+class ResponseEvent : public Event
+{
+  public:
+    ResponseEvent() : Event(Default_Pri, AutoDelete) {}
+    void process() override {}
+};
+
+class TickEvent : public Event
+{
+  private:
+    EventQueue &eq;
+    const Tick period;
+    std::bernoulli_distribution issue;
+    std::uniform_int_distribution<Tick> latency;
+
+  public:
+    TickEvent(EventQueue &_eq, Tick _period)
+        : Event(CPU_Tick_Pri), eq(_eq), period(_period), issue(0.3),
+          latency(10, 300)
+    {}
+
+    void
+    process() override
+    {
+        if (issue(rng)) {
+            eq.schedule(new ResponseEvent(),
+                        eq.getCurTick() + latency(rng) * period);
+        }
+        eq.schedule(this, eq.getCurTick() + period);
+    }
+};
+
+void
+run(EventQueue::Backend backend, const char *name, int num_objects,
+    Tick duration)
+{
+    // A few clock domains: 4GHz, 3GHz, 2GHz and 1GHz
+    const Tick periods[] = { 250, 333, 500, 1000 };
+
+    rng.seed(1);
+    EventQueue eq(name, backend);
+    std::vector<std::unique_ptr<TickEvent>> objects;
+    for (int i = 0; i < num_objects; ++i) {
+        const Tick period = periods[i % 4];
+        objects.emplace_back(new TickEvent(eq, period));
+        eq.schedule(objects.back().get(), period);
+    }
+
+    uint64_t serviced = 0;
+    const auto start = std::chrono::steady_clock::now();
+    while (!eq.empty() && eq.nextTick() <= duration) {
+        eq.serviceOne();
+        ++serviced;
+    }
+    const std::chrono::duration<double> secs =
+        std::chrono::steady_clock::now() - start;
+
+    cprintf("%-8s %6d objects: %10d events in %6.3fs, %10d events/s\n",
+            name, num_objects, serviced, secs.count(),
+            (uint64_t)(serviced / secs.count()));
+
+    // Drop any remaining events so the queue can be destroyed.
+    while (!eq.empty())
+        eq.deschedule(eq.getHead());
+}
+
+} // anonymous namespace
+
+int
+main(int argc, char *argv[])
+{
+    const Tick duration = argc > 1 ? std::atoll(argv[1]) : 20000000;
+
+    for (int num_objects : { 16, 256, 4096 }) {
+        run(EventQueue::Backend::List, "list", num_objects,
+            duration * 16 / num_objects);
+        run(EventQueue::Backend::Calendar, "calendar", num_objects,
+            duration * 16 / num_objects);
+    }
+
+    return 0;
+}
@@ -48,6 +48,7 @@
 #include "sim/eventq.hh"
 #include "sim/full_system.hh"
 #include "sim/root.hh"
+#include "sim/simulate.hh"
 
 namespace gem5
 {
@@ -75,6 +76,12 @@ Root::RootStats::RootStats()
              "The number of ticks simulated per host second (ticks/s)"),
     ADD_STAT(hostMemory, statistics::units::Byte::get(),
              "Number of bytes of host memory used"),
+    ADD_STAT(hostPoolHits, statistics::units::Count::get(),
+             "Number of pooled allocations served from a recycled object"),
+    ADD_STAT(hostPoolMisses, statistics::units::Count::get(),
+             "Number of pooled allocations that needed fresh memory"),
+    ADD_STAT(hostPoolHitRate, statistics::units::Ratio::get(),
+             "Fraction of pooled allocations served from a recycled object"),
 
     statTime(true),
     startTick(0)
@@ -99,8 +106,16 @@ Root::RootStats::RootStats()
 
     hostTickRate.precision(0);
 
+    hostPoolHits.functor([this]() {
+            return SlabPool::totals().hits - startPool.hits;
+        });
+    hostPoolMisses.functor([this]() {
+            return SlabPool::totals().misses - startPool.misses;
+        });
+
     simSeconds = simTicks / simFreq;
     hostTickRate = simTicks / hostSeconds;
+    hostPoolHitRate = hostPoolHits / (hostPoolHits + hostPoolMisses);
 }
 
 void
@@ -108,6 +123,7 @@ Root::RootStats::resetStats()
 {
     statTime.setTimer();
     startTick = curTick();
+    startPool = SlabPool::totals();
 
     statistics::Group::resetStats();
 }
@@ -187,6 +203,7 @@ Root::Root(const RootParams &p, int)
     lastTime.setTimer();
 
     simQuantum = p.sim_quantum;
+    lookaheadSync = p.lookahead_sync;
 
     // Some of the statistics are global and need to be accessed by
     // stat formulas. The most convenient way to implement that is by
@@ -51,6 +51,7 @@
 #ifndef __SIM_ROOT_HH__
 #define __SIM_ROOT_HH__
 
+#include "base/pool_alloc.hh"
 #include "base/statistics.hh"
 #include "base/time.hh"
 #include "base/types.hh"
@@ -110,6 +111,10 @@ class Root : public SimObject
         statistics::Formula hostTickRate;
         statistics::Value hostMemory;
 
+        statistics::Value hostPoolHits;
+        statistics::Value hostPoolMisses;
+        statistics::Formula hostPoolHitRate;
+
         static RootStats instance;
 
       private:
@@ -120,6 +125,7 @@ class Root : public SimObject
 
         Time statTime;
         Tick startTick;
+        SlabPool::Counts startPool;
     };
 
   public:
@@ -85,21 +85,37 @@ Serializable::unserializeSection(CheckpointIn &cp, const char *name)
 }
 
 void
-Serializable::generateCheckpointOut(const std::string &cpt_dir,
-        std::ofstream &outstream)
+Serializable::openCheckpointOut(const std::string &cpt_dir,
+        std::ofstream &outstream, std::ios_base::openmode mode)
 {
     std::string dir = CheckpointIn::setDir(cpt_dir);
     if (mkdir(dir.c_str(), 0775) == -1 && errno != EEXIST)
             fatal("couldn't mkdir %s\n", dir);
 
     std::string cpt_file = dir + CheckpointIn::baseFilename;
-    outstream = std::ofstream(cpt_file.c_str());
-    time_t t = time(NULL);
+    outstream = std::ofstream(cpt_file.c_str(), mode);
     if (!outstream)
         fatal("Unable to open file %s for writing\n", cpt_file.c_str());
+}
+
+void
+Serializable::generateCheckpointOut(const std::string &cpt_dir,
+        std::ofstream &outstream)
+{
+    openCheckpointOut(cpt_dir, outstream, std::ios_base::out);
+    time_t t = time(NULL);
     outstream << "## checkpoint generated: " << ctime(&t);
 }
 
+std::unique_ptr<binary_checkpoint::Writer>
+Serializable::generateBinaryCheckpointOut(const std::string &cpt_dir,
+        std::ofstream &outstream)
+{
+    openCheckpointOut(cpt_dir, outstream,
+                      std::ios_base::out | std::ios_base::binary);
+    return std::make_unique<binary_checkpoint::Writer>(outstream);
+}
+
 Serializable::ScopedCheckpointSection::~ScopedCheckpointSection()
 {
     assert(!path.empty());
@@ -123,6 +139,10 @@ Serializable::ScopedCheckpointSection::nameOut(CheckpointOut &cp)
 {
     DPRINTF(Checkpoint, "ScopedCheckpointSection::nameOut: %s\n",
             Serializable::currentSection());
+    if (auto *writer = binary_checkpoint::Writer::get(cp)) {
+        writer->beginSection(Serializable::currentSection());
+        return;
+    }
     cp << "\n[" << Serializable::currentSection() << "]\n";
 }
 
@@ -163,7 +183,9 @@ CheckpointIn::CheckpointIn(const std::string &cpt_dir)
     : db(), _cptDir(setDir(cpt_dir))
 {
     std::string filename = getCptDir() + "/" + CheckpointIn::baseFilename;
-    if (!db.load(filename)) {
+    if (binary_checkpoint::isBinaryFile(filename)) {
+        binary = std::make_unique<binary_checkpoint::Reader>(filename);
+    } else if (!db.load(filename)) {
         fatal("Can't load checkpoint file '%s'\n", filename);
     }
 }
@@ -180,6 +202,8 @@ CheckpointIn::CheckpointIn(const std::string &cpt_dir)
 bool
 CheckpointIn::entryExists(const std::string &section, const std::string &entry)
 {
+    if (binary)
+        return binary->find(section, entry) != nullptr;
     return db.entryExists(section, entry);
 }
 /**
@@ -196,12 +220,20 @@ bool
 CheckpointIn::find(const std::string &section, const std::string &entry,
         std::string &value)
 {
+    if (binary) {
+        auto *e = binary->find(section, entry);
+        if (e)
+            value = e->text();
+        return e != nullptr;
+    }
     return db.find(section, entry, value);
 }
 
 bool
 CheckpointIn::sectionExists(const std::string &section)
 {
+    if (binary)
+        return binary->sectionExists(section);
     return db.sectionExists(section);
 }
 
@@ -209,7 +241,21 @@ void
 CheckpointIn::visitSection(const std::string &section,
     IniFile::VisitSectionCallback cb)
 {
+    if (binary) {
+        binary->visitSection(section,
+            [&cb](const std::string &name,
+                  const binary_checkpoint::Reader::Entry &entry) {
+                cb(name, entry.text());
+            });
+        return;
+    }
     db.visitSection(section, cb);
 }
 
+const binary_checkpoint::Reader::Entry *
+CheckpointIn::findBinary(const std::string &section, const std::string &entry)
+{
+    return binary ? binary->find(section, entry) : nullptr;
+}
+
 } // namespace gem5
@@ -50,6 +50,7 @@
 #include <fstream>
 #include <iostream>
 #include <iterator>
+#include <memory>
 #include <stack>
 #include <string>
 #include <type_traits>
@@ -58,6 +59,7 @@
 
 #include "base/inifile.hh"
 #include "base/logging.hh"
+#include "sim/binary_checkpoint.hh"
 #include "sim/serialize_handlers.hh"
 
 namespace gem5
@@ -69,6 +71,8 @@ class CheckpointIn
 {
   private:
     IniFile db;
+    /** Set instead of db if the checkpoint is in the binary format. */
+    std::unique_ptr<binary_checkpoint::Reader> binary;
 
     const std::string _cptDir;
 
@@ -93,6 +97,16 @@ class CheckpointIn
         IniFile::VisitSectionCallback cb);
     /** @}*/ //end of api_checkout group
 
+    /**
+     * Look up an entry of a binary checkpoint so that integers can be
+     * restored without going through their text representation.
+     *
+     * @return The entry, or nullptr if it does not exist or this is not a
+     * binary checkpoint.
+     */
+    const binary_checkpoint::Reader::Entry *findBinary(
+        const std::string &section, const std::string &entry);
+
     // The following static functions have to do with checkpoint
     // creation rather than restoration.  This class makes a handy
     // namespace for them though.  Currently no Checkpoint object is
@@ -311,7 +325,24 @@ class Serializable
     static void generateCheckpointOut(const std::string &cpt_dir,
         std::ofstream &outstream);
 
+    /**
+     * Like generateCheckpointOut(), but the checkpoint is written in the
+     * indexed binary format. The returned writer must be finished once
+     * all objects have been serialized.
+     *
+     * @param cpt_dir The dir at which the cpt file will be created.
+     * @param outstream The cpt file.
+     * @return The writer attached to outstream.
+     * @ingroup api_serialize
+     */
+    static std::unique_ptr<binary_checkpoint::Writer>
+    generateBinaryCheckpointOut(const std::string &cpt_dir,
+        std::ofstream &outstream);
+
   private:
+    static void openCheckpointOut(const std::string &cpt_dir,
+        std::ofstream &outstream, std::ios_base::openmode mode);
+
     static std::stack<std::string> path;
 };
 
@@ -326,6 +357,10 @@ template <class T>
 void
 paramOut(CheckpointOut &os, const std::string &name, const T &param)
 {
+    if (auto *writer = binary_checkpoint::Writer::get(os)) {
+        writer->put(name, param);
+        return;
+    }
     os << name << "=";
     ShowParam<T>::show(os, param);
     os << "\n";
@@ -336,6 +371,11 @@ bool
 paramInImpl(CheckpointIn &cp, const std::string &name, T &param)
 {
     const std::string &section(Serializable::currentSection());
+    if constexpr (binary_checkpoint::isNative<T>) {
+        auto *entry = cp.findBinary(section, name);
+        if (entry && entry->isInteger())
+            return entry->count == 1 && entry->get(0, param);
+    }
     std::string str;
     return cp.find(section, name, str) && ParseParam<T>::parse(str, param);
 }
@@ -388,6 +428,10 @@ void
 arrayParamOut(CheckpointOut &os, const std::string &name,
               InputIterator start, InputIterator end)
 {
+    if (auto *writer = binary_checkpoint::Writer::get(os)) {
+        writer->putArray(name, start, end);
+        return;
+    }
     os << name << "=";
     auto it = start;
     using Elem = std::remove_cv_t<std::remove_reference_t<decltype(*it)>>;
@@ -442,6 +486,23 @@ arrayParamIn(CheckpointIn &cp, const std::string &name,
              InsertIterator inserter, ssize_t fixed_size=-1)
 {
     const std::string &section = Serializable::currentSection();
+    if constexpr (binary_checkpoint::isNative<T>) {
+        auto *entry = cp.findBinary(section, name);
+        if (entry && entry->isInteger()) {
+            fatal_if(fixed_size >= 0 && entry->count != fixed_size,
+                     "Array size mismatch on %s:%s (Got %u, expected %u)'\n",
+                     section, name, entry->count, fixed_size);
+            for (uint64_t i = 0; i < entry->count; i++) {
+                T value;
+                fatal_if(!entry->get(i, value),
+                         "Value %d of %s:%s does not fit its type.",
+                         i, section, name);
+                *inserter = value;
+            }
+            return;
+        }
+    }
+
     std::string str;
     fatal_if(!cp.find(section, name, str),
         "Can't unserialize '%s:%s'.", section, name);
@@ -494,6 +555,15 @@ void
 arrayParamIn(CheckpointIn &cp, const std::string &name,
              T *param, unsigned size)
 {
+    if constexpr (binary_checkpoint::isNative<T>) {
+        // Integers stored with the same layout are copied in one go.
+        auto *entry = cp.findBinary(Serializable::currentSection(), name);
+        if (entry && entry->count == size &&
+                entry->copyTo(param, sizeof(T), std::is_signed_v<T>)) {
+            return;
+        }
+    }
+
     struct ArrayInserter
     {
         T *data;
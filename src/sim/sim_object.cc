@@ -30,6 +30,7 @@
 #include "sim/sim_object.hh"
 
 #include <cassert>
+#include <memory>
 
 #include "base/logging.hh"
 #include "base/match.hh"
@@ -129,10 +130,14 @@ SimObject::getPort(const std::string &if_name, PortID idx)
 // static function: serialize all SimObjects.
 //
 void
-SimObject::serializeAll(const std::string &cpt_dir)
+SimObject::serializeAll(const std::string &cpt_dir, bool binary)
 {
     std::ofstream cp;
-    Serializable::generateCheckpointOut(cpt_dir, cp);
+    std::unique_ptr<binary_checkpoint::Writer> writer;
+    if (binary)
+        writer = Serializable::generateBinaryCheckpointOut(cpt_dir, cp);
+    else
+        Serializable::generateCheckpointOut(cpt_dir, cp);
 
     SimObjectList::reverse_iterator ri = simObjectList.rbegin();
     SimObjectList::reverse_iterator rend = simObjectList.rend();
@@ -143,6 +148,9 @@ SimObject::serializeAll(const std::string &cpt_dir)
         // since we are at the top level.
         obj->serializeSection(cp, obj->name());
    }
+
+    if (writer)
+        writer->finish();
 }
 
 SimObject *
@@ -42,8 +42,13 @@
 
 #include "sim/simulate.hh"
 
+#include <algorithm>
 #include <atomic>
+#include <map>
+#include <memory>
 #include <thread>
+#include <utility>
+#include <vector>
 
 #include "base/logging.hh"
 #include "base/pollevent.hh"
@@ -63,6 +68,102 @@ Event *doSimLoop(EventQueue *);
 
 GlobalSimLoopExitEvent *simulate_limit_event = nullptr;
 
+bool lookaheadSync = false;
+
+namespace
+{
+
+//! Lookahead declared for pairs of (source, destination) main event
+//! queues, see declareLookahead().
+std::map<std::pair<uint32_t, uint32_t>, Tick> declaredLookahead;
+
+} // anonymous namespace
+
+void
+declareLookahead(uint32_t src, uint32_t dst, Tick latency)
+{
+    if (src == dst)
+        return;
+
+    auto it = declaredLookahead.emplace(std::make_pair(src, dst), latency);
+    if (!it.second)
+        it.first->second = std::min(it.first->second, latency);
+}
+
+/**
+ * Conservative synchronization of the main event queues.
+ *
+ * Every queue publishes a lower bound on the time of any event it may
+ * still service (its safe time). An event serviced on queue j at time
+ * t can only cause events on queue i at t + L(j, i) or later, where
+ * the lookahead L(j, i) is the smallest latency declared for links
+ * from j to i, capped at simQuantum since global events (exits, stat
+ * dumps, ...) are scheduled one quantum into the future on all
+ * queues. Queue i can therefore service any event scheduled before
+ * its horizon, min over j of safe(j) + L(j, i), without waiting for
+ * the other queues.
+ *
+ * Events scheduled by other threads are merged into a queue right
+ * before servicing the first event at or after their time, and in the
+ * deterministic order kept by EventQueue::handleAsyncInsertions().
+ * Since a queue only does so once the horizon guarantees that all
+ * such events have arrived, the outcome does not depend on how the
+ * host threads are scheduled.
+ */
+class LookaheadSynchronizer
+{
+  public:
+    LookaheadSynchronizer(uint32_t num_queues, Tick quantum)
+        : numQueues(num_queues),
+          lookahead(num_queues * num_queues, quantum),
+          safeTick(new std::atomic<Tick>[num_queues])
+    {
+        for (const auto &[link, latency] : declaredLookahead) {
+            const auto [src, dst] = link;
+            if (src >= numQueues || dst >= numQueues)
+                continue;
+            fatal_if(latency == 0, "Zero lookahead declared from event "
+                     "queue %d to %d.", src, dst);
+            Tick &la = lookahead[src * numQueues + dst];
+            la = std::min(la, latency);
+        }
+
+        for (uint32_t i = 0; i < numQueues; ++i)
+            safeTick[i] = mainEventQueue[i]->getCurTick();
+    }
+
+    /** Publish a new safe time for a queue. */
+    void
+    publish(uint32_t queue, Tick when)
+    {
+        safeTick[queue].store(when, std::memory_order_release);
+    }
+
+    /** Time before which a queue can service events. */
+    Tick
+    horizon(uint32_t queue) const
+    {
+        Tick horizon = MaxTick;
+        for (uint32_t src = 0; src < numQueues; ++src) {
+            if (src == queue)
+                continue;
+            const Tick safe = safeTick[src].load(std::memory_order_acquire);
+            const Tick la = lookahead[src * numQueues + queue];
+            horizon = std::min(horizon,
+                               safe > MaxTick - la ? MaxTick : safe + la);
+        }
+        return horizon;
+    }
+
+  private:
+    const uint32_t numQueues;
+    //! Lookahead from queue j to queue i, stored at j * numQueues + i
+    std::vector<Tick> lookahead;
+    std::unique_ptr<std::atomic<Tick>[]> safeTick;
+};
+
+static std::unique_ptr<LookaheadSynchronizer> lookaheadSynchronizer;
+
 class SimulatorThreads
 {
   public:
@@ -220,12 +321,25 @@ simulate(Tick num_cycles)
     }
 
     if (numMainEventQueues > 1) {
+        if (lookaheadSync && simQuantum == 0) {
+            // Derive the quantum from the links between the queues.
+            for (const auto &[link, latency] : declaredLookahead) {
+                if (simQuantum == 0 || latency < simQuantum)
+                    simQuantum = latency;
+            }
+        }
+
         fatal_if(simQuantum == 0,
                  "Quantum for multi-eventq simulation not specified");
 
-        quantum_event.reset(
-            new GlobalSyncEvent(curTick() + simQuantum, simQuantum,
-                                EventBase::Progress_Event_Pri, 0));
+        if (lookaheadSync) {
+            lookaheadSynchronizer.reset(
+                new LookaheadSynchronizer(numMainEventQueues, simQuantum));
+        } else {
+            quantum_event.reset(
+                new GlobalSyncEvent(curTick() + simQuantum, simQuantum,
+                                    EventBase::Progress_Event_Pri, 0));
+        }
 
         inParallelMode = true;
     }
@@ -290,17 +404,19 @@ doSimLoop(EventQueue *eventq)
 {
     // set the per thread current eventq pointer
     curEventQueue(eventq);
-    eventq->handleAsyncInsertions();
+
+    LookaheadSynchronizer *sync =
+        inParallelMode ? lookaheadSynchronizer.get() : nullptr;
+    const uint32_t index = eventq->index();
+    Tick horizon = 0;
+    Tick published = MaxTick;
+
+    if (!sync)
+        eventq->handleAsyncInsertions();
 
     bool mainQueue = eventq == getEventQueue(0);
 
     while (1) {
-        // there should always be at least one event (the SimLoopExitEvent
-        // we just scheduled) in the queue
-        assert(!eventq->empty());
-        assert(curTick() <= eventq->nextTick() &&
-               "event scheduled in the past");
-
         if (mainQueue && async_event) {
             async_event = false;
             // Take the event queue lock in case any of the service
@@ -328,6 +444,37 @@ doSimLoop(EventQueue *eventq)
             }
         }
 
+        if (sync) {
+            // Wait until the other queues have made enough progress for
+            // the next event to be safe, then merge the events they
+            // scheduled up to that point.
+            const Tick next = std::min(
+                eventq->empty() ? MaxTick : eventq->nextTick(),
+                eventq->nextAsyncTick());
+            if (next >= horizon)
+                horizon = sync->horizon(index);
+
+            const Tick safe = std::min(next, horizon);
+            if (safe != published) {
+                sync->publish(index, safe);
+                published = safe;
+            }
+
+            if (next >= horizon) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            if (eventq->nextAsyncTick() <= next)
+                eventq->handleAsyncInsertions(next);
+        }
+
+        // there should always be at least one event (the SimLoopExitEvent
+        // we just scheduled) in the queue
+        assert(!eventq->empty());
+        assert(curTick() <= eventq->nextTick() &&
+               "event scheduled in the past");
+
         Event *exit_event = eventq->serviceOne();
         if (exit_event != NULL) {
             return exit_event;
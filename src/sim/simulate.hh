@@ -77,4 +77,24 @@ void terminateEventQueueThreads();
 
 extern GlobalSimLoopExitEvent *simulate_limit_event;
 
+/**
+ * Synchronize the main event queues using the lookahead of the links
+ * between them instead of a global barrier every simQuantum. See
+ * LookaheadSynchronizer in simulate.cc.
+ */
+extern bool lookaheadSync;
+
+/**
+ * Declare that servicing an event on main event queue src can only
+ * cause events on main event queue dst at least latency ticks later,
+ * e.g., because the only path between them is a link with that
+ * latency. Used by lookahead synchronization; if several values are
+ * declared for the same pair of queues, the smallest one is used.
+ *
+ * @param src Index of the queue sending events
+ * @param dst Index of the queue receiving them
+ * @param latency Minimum delay of the events
+ */
+void declareLookahead(uint32_t src, uint32_t dst, Tick latency);
+
 } // namespace gem5
@@ -171,7 +171,10 @@ System::System(const Params &p)
       physProxy(_systemPort, p.cache_line_size),
       workload(p.workload),
       physmem(name() + ".physmem", p.memories, p.mmap_using_noreserve,
-              p.shared_backstore, p.auto_unlink_shared_backstore),
+              p.shared_backstore, p.auto_unlink_shared_backstore,
+              p.pmem_checkpoint_format, p.pmem_checkpoint_compress,
+              p.pmem_checkpoint_threads, p.pmem_lazy_restore,
+              p.pmem_checkpoint_delta, p.pmem_checkpoint_max_delta_chain),
       ShadowRomRanges(p.shadow_rom_ranges.begin(),
                       p.shadow_rom_ranges.end()),
       memoryMode(p.mem_mode),
@@ -340,6 +343,12 @@ System::serialize(CheckpointOut &cp) const
 }
 
 
+void
+System::notifyFork()
+{
+    physmem.notifyFork();
+}
+
 void
 System::unserialize(CheckpointIn &cp)
 {
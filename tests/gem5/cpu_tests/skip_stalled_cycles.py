@@ -0,0 +1,177 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All Rights Reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Runs a workload on two identical O3 CPUs, one of which skips the cycles
+its pipeline only spends stalled, and checks that skipping does not change
+the timing of the workload. The stall statistics of the skipped cycles are
+reconstructed when the CPU wakes up; differences in those are reported, and
+only fail the run with --all-stats.
+"""
+
+import argparse
+import os
+import sys
+
+import m5
+from m5.objects import *
+
+valid_cpu = {
+    "X86DerivO3CPU": X86O3CPU,
+    "ArmDerivO3CPU": ArmO3CPU,
+    "RiscvDerivO3CPU": RiscvO3CPU,
+}
+
+parser = argparse.ArgumentParser()
+parser.add_argument("binary", type=str)
+parser.add_argument("--cpu", choices=valid_cpu.keys())
+parser.add_argument(
+    "--all-stats",
+    action="store_true",
+    help="Fail if any CPU statistic differs, not only the timing ones",
+)
+
+args = parser.parse_args()
+
+
+class L1Cache(Cache):
+    size = "32kB"
+    assoc = 8
+    tag_latency = 1
+    data_latency = 1
+    response_latency = 1
+    mshrs = 16
+    tgts_per_mshr = 20
+
+
+def make_system(skip_stalled_cycles):
+    system = System()
+
+    system.workload = SEWorkload.init_compatible(args.binary)
+
+    system.clk_domain = SrcClockDomain()
+    system.clk_domain.clock = "1GHz"
+    system.clk_domain.voltage_domain = VoltageDomain()
+
+    system.mem_mode = "timing"
+    system.mem_ranges = [AddrRange("512MB")]
+
+    system.cpu = valid_cpu[args.cpu](skipStalledCycles=skip_stalled_cycles)
+
+    system.membus = SystemXBar()
+    system.cpu.l1d = L1Cache()
+    system.cpu.l1i = L1Cache()
+    system.cpu.l1d.cpu_side = system.cpu.dcache_port
+    system.cpu.l1i.cpu_side = system.cpu.icache_port
+    system.cpu.l1d.mem_side = system.membus.cpu_side_ports
+    system.cpu.l1i.mem_side = system.membus.cpu_side_ports
+
+    system.cpu.createInterruptController()
+    if args.cpu == "X86DerivO3CPU":
+        system.cpu.interrupts[0].pio = system.membus.mem_side_ports
+        system.cpu.interrupts[0].int_requestor = system.membus.cpu_side_ports
+        system.cpu.interrupts[0].int_responder = system.membus.mem_side_ports
+
+    # Slow enough memory for the pipeline to stall on it.
+    system.mem_ctrl = SimpleMemory(latency="50ns")
+    system.mem_ctrl.range = system.mem_ranges[0]
+    system.mem_ctrl.port = system.membus.mem_side_ports
+    system.system_port = system.membus.cpu_side_ports
+
+    process = Process()
+    process.cmd = [args.binary]
+    system.cpu.workload = process
+    system.cpu.createThreads()
+
+    return system
+
+
+root = Root(full_system=False)
+root.ticking = make_system(False)
+root.skipping = make_system(True)
+m5.instantiate()
+
+# The simulation exits once the workload finished on both systems.
+exit_event = m5.simulate()
+if exit_event.getCause() != "exiting with last active thread context":
+    print(f"Unexpected exit: {exit_event.getCause()}", file=sys.stderr)
+    sys.exit(1)
+
+m5.stats.dump()
+
+
+def cpu_stats(lines, system):
+    prefix = f"{system}.cpu."
+    stats = {}
+    for line in lines:
+        fields = line.split()
+        if len(fields) >= 2 and fields[0].startswith(prefix):
+            stats[fields[0][len(prefix) :]] = fields[1]
+    return stats
+
+
+with open(os.path.join(m5.options.outdir, "stats.txt")) as f:
+    lines = f.readlines()
+
+ticking = cpu_stats(lines, "ticking")
+skipping = cpu_stats(lines, "skipping")
+if not ticking:
+    print("No CPU statistics found", file=sys.stderr)
+    sys.exit(1)
+
+# Statistics that only match if skipping kept the timing of the workload.
+timing_stats = (
+    "numCycles",
+    "idleCycles",
+    "cpi",
+    "ipc",
+    "commitStats0.numInsts",
+    "commitStats0.numOps",
+)
+
+mismatches = [
+    name
+    for name in sorted(ticking.keys() | skipping.keys())
+    if ticking.get(name) != skipping.get(name)
+]
+for name in mismatches:
+    print(
+        f"{name}: {ticking.get(name)} when ticking, "
+        f"{skipping.get(name)} when skipping stalled cycles",
+        file=sys.stderr,
+    )
+
+missing = [name for name in timing_stats if name not in ticking]
+if missing:
+    print(f"Missing statistics: {', '.join(missing)}", file=sys.stderr)
+    sys.exit(1)
+
+if args.all_stats and mismatches:
+    sys.exit(1)
+if any(name in timing_stats for name in mismatches):
+    sys.exit(1)
+
+print(f"Timing matches, {len(mismatches)} other statistics differ")
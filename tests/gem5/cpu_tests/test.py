@@ -95,3 +95,23 @@ for isa in valid_isas:
                 valid_isas=(constants.all_compiled_tag,),
                 fixtures=[workload_binary],
             )
+
+# Skipping stalled cycles must not change the statistics of the O3 CPU.
+for isa in valid_isas:
+    path = joinpath(base_path, isa.lower())
+    for workload in workloads:
+        url = isa_url[isa] + "/" + workload
+        workload_binary = DownloadedProgram(url, path, workload)
+        binary = joinpath(workload_binary.path, workload)
+
+        for cpu in valid_isas[isa]:
+            if not cpu.endswith("DerivO3CPU"):
+                continue
+            gem5_verify_config(
+                name=f"cpu_test_{cpu}_{workload}_skip_stalled_cycles",
+                verifiers=(),
+                config=joinpath(getcwd(), "skip_stalled_cycles.py"),
+                config_args=[f"--cpu={cpu}", binary],
+                valid_isas=(constants.all_compiled_tag,),
+                fixtures=[workload_binary],
+            )
@@ -0,0 +1,128 @@
+# Copyright (c) 2026 The Regents of the University of California
+# All Rights Reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""
+Runs garnet_synth_traffic.py once with the garnet routers woken up as
+separate events and once per given number of router threads, and checks
+that the statistics of all runs are the same.
+
+The runs are separate gem5 processes, started with the gem5 binary that
+runs this script, since only one Ruby system can be simulated at a time.
+"""
+
+import argparse
+import os
+import subprocess
+import sys
+
+import m5
+
+parser = argparse.ArgumentParser()
+parser.add_argument(
+    "--router-threads",
+    type=int,
+    nargs="+",
+    default=[1, 4],
+    help="Numbers of router threads to compare against no threads",
+)
+parser.add_argument("--sim-cycles", type=int, default=20000)
+parser.add_argument("--injectionrate", type=float, default=0.1)
+
+args = parser.parse_args()
+
+config = os.path.join(
+    os.path.dirname(os.path.abspath(__file__)),
+    os.pardir,
+    os.pardir,
+    os.pardir,
+    "configs",
+    "example",
+    "garnet_synth_traffic.py",
+)
+
+# Routers that may route randomly are woken up as separate events even
+# with router threads, so use XY routing to evaluate all of them in
+# parallel.
+config_args = [
+    "--network=garnet",
+    "--topology=Mesh_XY",
+    "--mesh-rows=4",
+    "--num-cpus=16",
+    "--num-dirs=16",
+    "--routing-algorithm=1",
+    f"--sim-cycles={args.sim_cycles}",
+    f"--injectionrate={args.injectionrate}",
+]
+
+# Statistics of the host rather than the simulation.
+host_stats = (
+    "hostSeconds",
+    "hostTickRate",
+    "hostMemory",
+    "hostInstRate",
+    "hostOpRate",
+)
+
+
+def run(threads):
+    outdir = os.path.join(m5.options.outdir, f"router-threads-{threads}")
+    subprocess.run(
+        [sys.executable, "-re", f"--outdir={outdir}", config]
+        + config_args
+        + [f"--garnet-router-threads={threads}"],
+        check=True,
+    )
+
+    stats = {}
+    with open(os.path.join(outdir, "stats.txt")) as f:
+        for line in f:
+            fields = line.split()
+            if len(fields) >= 2 and fields[0] not in host_stats:
+                stats[fields[0]] = fields[1]
+    return stats
+
+
+reference = run(0)
+if not reference:
+    print("No statistics found", file=sys.stderr)
+    sys.exit(1)
+
+failed = False
+for threads in args.router_threads:
+    stats = run(threads)
+    for name in sorted(reference.keys() | stats.keys()):
+        if reference.get(name) != stats.get(name):
+            print(
+                f"{name}: {reference.get(name)} without router threads, "
+                f"{stats.get(name)} with {threads}",
+                file=sys.stderr,
+            )
+            failed = True
+
+if failed:
+    sys.exit(1)
+
+print("Statistics match")
@@ -137,3 +137,16 @@ for test_name, basename_noext, args in null_tests:
         valid_hosts=constants.supported_hosts,
         length=constants.long_tag,
     )
+
+# Evaluating the garnet routers of a cycle on several threads must not
+# change the statistics.
+gem5_verify_config(
+    name="garnet_router_threads",
+    fixtures=(),
+    verifiers=(),
+    config=joinpath(getcwd(), "garnet-router-threads.py"),
+    config_args=[],
+    valid_isas=(constants.null_tag,),
+    valid_hosts=constants.supported_hosts,
+    length=constants.long_tag,
+)
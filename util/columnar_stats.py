@@ -0,0 +1,243 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""Read gem5 stats files written in the binary columnar format.
+
+The format is written by the columnar stats output (see
+src/base/stats/columnar.hh), which is enabled with e.g.
+--stats-file=columnar://stats.bin. Every dump is loaded into numpy
+arrays, one row per dump:
+
+    from columnar_stats import ColumnarStats
+
+    stats = ColumnarStats("m5out/stats.bin")
+    ipc = stats["system.cpu.ipc"]          # shape (dumps,)
+    misses = stats["system.l2.overallMisses"]  # shape (dumps, values)
+    print(stats.ticks, stats.labels("system.l2.overallMisses"))
+
+Dumps that did not include a stat, e.g., dumps of a different sub-tree,
+hold NaN for it.
+
+Usage:
+    columnar_stats.py <file>                 list the stats in a file
+    columnar_stats.py <file> <stat> [...]    print stats as CSV
+"""
+
+import argparse
+import csv
+import struct
+import sys
+from collections import namedtuple
+
+import numpy as np
+
+MAGIC = b"gem5stcl"
+VERSION = 1
+
+COLUMN_RECORD, LAYOUT_RECORD, DUMP_RECORD = 1, 2, 3
+KINDS = ("scalar", "vector", "vector2d", "formula", "dist", "vectordist")
+
+FILE_HEADER = struct.Struct("<8sII")
+RECORD_HEADER = struct.Struct("<BQ")
+DUMP_HEADER = struct.Struct("<IQ")
+U32 = struct.Struct("<I")
+
+Column = namedtuple("Column", "id kind name desc unit labels")
+
+
+class ColumnarStats:
+    """All the dumps in a columnar stats file."""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            data = f.read()
+
+        magic, version, _ = FILE_HEADER.unpack_from(data, 0)
+        if magic != MAGIC:
+            raise ValueError(f"{path} is not a columnar stats file")
+        if version != VERSION:
+            raise ValueError(f"Unsupported columnar stats version {version}")
+
+        self.columns = []
+        # Column ids by stat name, a stat gets a new column whenever its
+        # number of values changes.
+        self._by_name = {}
+        layouts = []
+        # Per dump: layout, tick and offset of the values in data.
+        dumps = []
+
+        pos = FILE_HEADER.size
+        while pos + RECORD_HEADER.size <= len(data):
+            rtype, size = RECORD_HEADER.unpack_from(data, pos)
+            start = pos + RECORD_HEADER.size
+            end = start + size
+            if end > len(data):
+                # The last record is still being written.
+                break
+            if rtype == COLUMN_RECORD:
+                self._add_column(data, start)
+            elif rtype == LAYOUT_RECORD:
+                (count,) = U32.unpack_from(data, start + 4)
+                layouts.append(
+                    np.frombuffer(data, "<u4", count, start + 8).tolist()
+                )
+            elif rtype == DUMP_RECORD:
+                layout, tick = DUMP_HEADER.unpack_from(data, start)
+                dumps.append((layout, tick, start + DUMP_HEADER.size))
+            pos = end
+
+        self.ticks = np.array([tick for _, tick, _ in dumps], dtype=np.uint64)
+
+        # Gather the values of all the dumps of a layout in one array, and
+        # remember where each column is in it.
+        self._values = {}
+        self._where = {}
+        for layout_id, ids in enumerate(layouts):
+            rows = [i for i, dump in enumerate(dumps) if dump[0] == layout_id]
+            if not rows:
+                continue
+            width = sum(len(self.columns[c].labels) for c in ids)
+            values = np.empty((len(rows), width))
+            for row, i in enumerate(rows):
+                values[row] = np.frombuffer(data, "<f8", width, dumps[i][2])
+            self._values[layout_id] = (np.array(rows), values)
+
+            offset = 0
+            for c in ids:
+                count = len(self.columns[c].labels)
+                self._where.setdefault(c, []).append(
+                    (layout_id, offset, count)
+                )
+                offset += count
+
+    def _add_column(self, data, pos):
+        def string():
+            nonlocal pos
+            (length,) = U32.unpack_from(data, pos)
+            pos += U32.size + length
+            return data[pos - length : pos].decode()
+
+        (cid,) = U32.unpack_from(data, pos)
+        kind = KINDS[data[pos + 4]]
+        pos += 5
+        name = string()
+        desc = string()
+        unit = string()
+        (count,) = U32.unpack_from(data, pos)
+        pos += U32.size
+        labels = [string() for _ in range(count)]
+
+        assert cid == len(self.columns), "Unexpected column id"
+        self.columns.append(Column(cid, kind, name, desc, unit, labels))
+        self._by_name.setdefault(name, []).append(cid)
+
+    def __len__(self):
+        """The number of dumps."""
+        return len(self.ticks)
+
+    def __contains__(self, name):
+        return name in self._by_name
+
+    def names(self):
+        """The names of all the stats in the file."""
+        return list(self._by_name)
+
+    def column(self, name):
+        """The description of a stat. If the number of values of the stat
+        changed, this is the latest description with the most values."""
+        ids = self._by_name[name]
+        return max(
+            (self.columns[c] for c in reversed(ids)),
+            key=lambda column: len(column.labels),
+        )
+
+    def labels(self, name):
+        """The labels of the values of a stat, see column()."""
+        return self.column(name).labels
+
+    def __getitem__(self, name):
+        """The values of a stat in every dump.
+
+        Scalars are returned as a 1-dimensional array, other stats as an
+        array with one row per dump and one column per value, labelled by
+        labels(). Rows of dumps without the stat are NaN.
+        """
+        ids = self._by_name[name]
+        width = len(self.labels(name))
+        result = np.full((len(self), width), np.nan)
+        for c in ids:
+            for layout_id, offset, count in self._where.get(c, []):
+                rows, values = self._values[layout_id]
+                result[rows, :count] = values[:, offset : offset + count]
+
+        if self.column(name).kind == "scalar":
+            return result[:, 0]
+        return result
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Inspect a gem5 columnar stats file."
+    )
+    parser.add_argument("file", help="Columnar stats file")
+    parser.add_argument("stats", nargs="*", help="Stats to print as CSV")
+    args = parser.parse_args()
+
+    stats = ColumnarStats(args.file)
+
+    if not args.stats:
+        print(f"{len(stats)} dumps")
+        for name in stats.names():
+            column = stats.column(name)
+            print(f"{name} ({column.kind}, {len(column.labels)} values)")
+        return
+
+    header = ["tick"]
+    arrays = []
+    for name in args.stats:
+        if name not in stats:
+            sys.exit(f"Unknown stat '{name}'")
+        values = stats[name]
+        if values.ndim == 1:
+            header.append(name)
+            values = values[:, None]
+        else:
+            header += [f"{name}::{label}" for label in stats.labels(name)]
+        arrays.append(values)
+
+    writer = csv.writer(sys.stdout)
+    writer.writerow(header)
+    for i, tick in enumerate(stats.ticks):
+        row = [int(tick)]
+        for values in arrays:
+            row += values[i].tolist()
+        writer.writerow(row)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,237 @@
+#!/usr/bin/env python3
+
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+"""Convert gem5 checkpoints between the INI and the binary m5.cpt formats.
+
+The binary format (see src/sim/binary_checkpoint.hh) stores the same
+sections and entries as the INI one, but keeps integers in their native
+encoding and adds an index so that sections can be read on demand. gem5
+restores either format; this script is mostly useful to inspect binary
+checkpoints or to run tools such as cpt_upgrader.py on them.
+
+Usage:
+    cpt_convert.py [--to {ini,binary}] <input> <output>
+
+Both input and output can be an m5.cpt file or a checkpoint directory.
+Without --to, the input is converted to the other format.
+Only m5.cpt is converted; the other files of a checkpoint directory, such
+as the memory images, are not copied to the output.
+"""
+
+import argparse
+import os.path as osp
+import re
+import struct
+import sys
+import time
+
+MAGIC = b"gem5bcpt"
+VERSION = 1
+
+TEXT, SIGNED, UNSIGNED = 0, 1, 2
+ELEM_FORMATS = {1: "B", 2: "H", 4: "I", 8: "Q"}
+
+RECORD_HEADER = struct.Struct("<HBBQ")
+INDEX_ENTRY = struct.Struct("<IQQ")
+FILE_HEADER = struct.Struct("<8sII")
+FILE_FOOTER = struct.Struct("<QQ8s")
+
+INT_RE = re.compile(r"-?(0|[1-9][0-9]*)$")
+
+
+def cpt_path(path):
+    return osp.join(path, "m5.cpt") if osp.isdir(path) else path
+
+
+def is_binary(path):
+    with open(path, "rb") as f:
+        return f.read(len(MAGIC)) == MAGIC
+
+
+def read_ini(path):
+    """Return the sections of an INI checkpoint as a list of
+    (name, [(key, value)]) pairs, merging repeated sections and entries
+    the way gem5 does."""
+    sections = {}
+    section = None
+    with open(path) as f:
+        for line in f:
+            line = line.rstrip()
+            if not line:
+                continue
+            if line[0] == "[" and line[-1] == "]":
+                section = sections.setdefault(line[1:-1].strip(), {})
+                continue
+            if section is None:
+                continue
+            key, sep, value = line.partition("=")
+            if not sep:
+                sys.exit(f"Can't parse .ini line {line}")
+            value = value.strip()
+            if key.endswith("+"):
+                key = key[:-1].strip()
+                if key in section:
+                    value = section[key] + " " + value
+            section[key.strip()] = value
+    return [
+        (name, list(entries.items())) for name, entries in sections.items()
+    ]
+
+
+def read_binary(path):
+    with open(path, "rb") as f:
+        data = f.read()
+
+    magic, version, _ = FILE_HEADER.unpack_from(data, 0)
+    if magic != MAGIC or version != VERSION:
+        sys.exit(f"{path} is not a version {VERSION} binary checkpoint")
+    index_offset, num_extents, magic = FILE_FOOTER.unpack_from(
+        data, len(data) - FILE_FOOTER.size
+    )
+    if magic != MAGIC:
+        sys.exit(f"{path} is incomplete")
+
+    sections = {}
+    pos = index_offset
+    for _ in range(num_extents):
+        name_len, offset, length = INDEX_ENTRY.unpack_from(data, pos)
+        pos += INDEX_ENTRY.size
+        name = data[pos : pos + name_len].decode()
+        pos += name_len
+
+        entries = sections.setdefault(name, {})
+        rec, end = offset, offset + length
+        while rec < end:
+            key_len, kind, elem_size, count = RECORD_HEADER.unpack_from(
+                data, rec
+            )
+            rec += RECORD_HEADER.size
+            key = data[rec : rec + key_len].decode()
+            rec += key_len
+            payload = data[rec : rec + count * elem_size]
+            rec += count * elem_size
+            if kind == TEXT:
+                entries[key] = payload.decode()
+            else:
+                fmt = ELEM_FORMATS[elem_size]
+                if kind == SIGNED:
+                    fmt = fmt.lower()
+                values = struct.unpack(f"<{count}{fmt}", payload)
+                entries[key] = " ".join(str(v) for v in values)
+    return [
+        (name, list(entries.items())) for name, entries in sections.items()
+    ]
+
+
+def write_ini(path, sections):
+    with open(path, "w") as f:
+        f.write(f"## checkpoint generated: {time.ctime()}\n")
+        for name, entries in sections:
+            f.write(f"\n[{name}]\n")
+            for key, value in entries:
+                f.write(f"{key}={value}\n")
+
+
+def encode_value(value):
+    """Encode a value as integers if it is a list of them in canonical
+    form, so that converting back yields the same text."""
+    tokens = value.split(" ") if value else []
+    if tokens and all(INT_RE.match(t) and t != "-0" for t in tokens):
+        ints = [int(t) for t in tokens]
+        lo, hi = min(ints), max(ints)
+        signed = lo < 0
+        for size in (1, 2, 4, 8):
+            bits = 8 * size
+            if signed and -(1 << (bits - 1)) <= lo and hi < 1 << (bits - 1):
+                break
+            if not signed and hi < 1 << bits:
+                break
+        else:
+            size = None
+        if size:
+            fmt = ELEM_FORMATS[size]
+            if signed:
+                fmt = fmt.lower()
+            kind = SIGNED if signed else UNSIGNED
+            payload = struct.pack(f"<{len(ints)}{fmt}", *ints)
+            return kind, size, len(ints), payload
+    payload = value.encode()
+    return TEXT, 1, len(payload), payload
+
+
+def write_binary(path, sections):
+    with open(path, "wb") as f:
+        f.write(FILE_HEADER.pack(MAGIC, VERSION, 0))
+        index = []
+        for name, entries in sections:
+            start = f.tell()
+            for key, value in entries:
+                kind, size, count, payload = encode_value(value)
+                key = key.encode()
+                f.write(RECORD_HEADER.pack(len(key), kind, size, count))
+                f.write(key)
+                f.write(payload)
+            index.append((name.encode(), start, f.tell() - start))
+
+        index_offset = f.tell()
+        for name, offset, length in index:
+            f.write(INDEX_ENTRY.pack(len(name), offset, length))
+            f.write(name)
+        f.write(FILE_FOOTER.pack(index_offset, len(index), MAGIC))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Convert gem5 checkpoints between the INI and the "
+        "binary formats."
+    )
+    parser.add_argument(
+        "--to",
+        choices=["ini", "binary"],
+        help="Output format; defaults to the one the input is not in",
+    )
+    parser.add_argument("input", help="Checkpoint file or directory")
+    parser.add_argument("output", help="Checkpoint file or directory")
+    args = parser.parse_args()
+
+    src = cpt_path(args.input)
+    dst = cpt_path(args.output)
+    if osp.abspath(src) == osp.abspath(dst):
+        parser.error("The input and the output must be different")
+
+    binary = is_binary(src)
+    sections = read_binary(src) if binary else read_ini(src)
+    to = args.to or ("ini" if binary else "binary")
+    if to == "ini":
+        write_ini(dst, sections)
+    else:
+        write_binary(dst, sections)
+
+
+if __name__ == "__main__":
+    main()
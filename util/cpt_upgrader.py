@@ -200,6 +200,14 @@ def process_file(path, **kwargs):
 
     verboseprint(f"Processing file {path}....")
 
+    with open(path, "rb") as f:
+        if f.read(8) == b"gem5bcpt":
+            print(
+                f"Error: {path} is a binary checkpoint. Convert it to INI "
+                "with util/cpt_convert.py first."
+            )
+            sys.exit(1)
+
     if kwargs.get("backup", True):
         import shutil
 
@@ -0,0 +1,108 @@
+#! /usr/bin/env python3
+
+# Copyright (c) 2026 The Regents of the University of California
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+# Measure the host throughput of the Garnet network model, in simulated
+# flits per host second, by running the garnet_synth_traffic.py example on
+# square meshes of increasing size. The binary must be built with the
+# Garnet_standalone protocol, e.g.:
+#
+#   util/garnet-throughput.py build/NULL/gem5.opt --rows 8 16
+
+import argparse
+import os
+import re
+import subprocess
+import sys
+import tempfile
+
+parser = argparse.ArgumentParser()
+
+parser.add_argument("binary")
+parser.add_argument(
+    "--rows",
+    type=int,
+    nargs="+",
+    default=[8, 16],
+    help="Mesh rows to run; each mesh has rows * rows nodes",
+)
+parser.add_argument("--sim-cycles", type=int, default=100000)
+parser.add_argument("--injectionrate", type=float, default=0.1)
+parser.add_argument("--synthetic", default="uniform_random")
+parser.add_argument(
+    "--router-threads",
+    type=int,
+    default=0,
+    help="Host threads evaluating the routers (--garnet-router-threads)",
+)
+
+args = parser.parse_args()
+
+
+def read_stat(stats, name):
+    m = re.search(r"^%s\s+([0-9.e+-]+)" % re.escape(name), stats, re.M)
+    if not m:
+        print(f"Error: {name} not found in the stats")
+        sys.exit(1)
+    return float(m.group(1))
+
+
+print(f"{'nodes':>6} {'flits':>12} {'host s':>9} {'flits/host s':>14}")
+for rows in args.rows:
+    nodes = rows * rows
+    with tempfile.TemporaryDirectory() as outdir:
+        status = subprocess.call(
+            [
+                args.binary,
+                "-d",
+                outdir,
+                "configs/example/garnet_synth_traffic.py",
+                "--network=garnet",
+                "--topology=Mesh_XY",
+                f"--num-cpus={nodes}",
+                f"--num-dirs={nodes}",
+                f"--mesh-rows={rows}",
+                f"--sim-cycles={args.sim_cycles}",
+                f"--injectionrate={args.injectionrate}",
+                f"--synthetic={args.synthetic}",
+                f"--garnet-router-threads={args.router_threads}",
+            ],
+            stdout=subprocess.DEVNULL,
+        )
+        if status != 0:
+            print(f"Error: garnet run with {nodes} nodes failed")
+            sys.exit(1)
+
+        with open(os.path.join(outdir, "stats.txt")) as f:
+            stats = f.read()
+
+    flits = read_stat(stats, "system.ruby.network.flits_received::total")
+    host_seconds = read_stat(stats, "hostSeconds")
+    print(
+        f"{nodes:>6} {int(flits):>12} {host_seconds:>9.2f} "
+        f"{flits / host_seconds:>14.0f}"
+    )